@@ -121,6 +121,13 @@ public:
     void setDie(bool die);
     bool isValid() const;
 
+    /**
+     * Simulation time skipped by the AI manager while updating this object
+     * at a reduced rate; it is passed on with the next update() call.
+     */
+    double getSkippedUpdateDt() const { return _skippedUpdateDt; }
+    void setSkippedUpdateDt(double dt) { _skippedUpdateDt = dt; }
+
     void setCollisionData(bool i, double lat, double lon, double elev);
     void setImpactData(bool d);
     void setImpactLat(double lat);
@@ -296,6 +303,7 @@ private:
     int _refID;
     object_type _otype;
     bool _initialized = false;
+    double _skippedUpdateDt = 0.0;
     osg::ref_ptr<osg::LOD> _model;
     osg::ref_ptr<osg::PagedLOD> _low_res;
     osg::ref_ptr<osg::PagedLOD> _high_res;
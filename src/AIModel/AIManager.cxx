@@ -156,6 +156,29 @@ void FGAIManager::init()
     _radarRangeNode = fgGetNode("/instrumentation/radar/range", true);
     _radarDebugNode = fgGetNode("/instrumentation/radar/debug-mode", true);
 
+    // update tier properties, keeping any values set by the user
+    SGPropertyNode* tiers = fgGetNode("/sim/ai/update-tiers", true);
+    _updateTiersEnabledNode = tiers->getNode("enabled", true);
+    _updateTiersNearRangeNode = tiers->getNode("near-range-nm", true);
+    _updateTiersFarRangeNode = tiers->getNode("far-range-nm", true);
+    _updateTiersMidIntervalNode = tiers->getNode("mid-interval-sec", true);
+    _updateTiersFarIntervalNode = tiers->getNode("far-interval-sec", true);
+    if (!_updateTiersEnabledNode->hasValue()) {
+        _updateTiersEnabledNode->setBoolValue(true);
+    }
+    if (!_updateTiersNearRangeNode->hasValue()) {
+        _updateTiersNearRangeNode->setDoubleValue(20.0);
+    }
+    if (!_updateTiersFarRangeNode->hasValue()) {
+        _updateTiersFarRangeNode->setDoubleValue(60.0);
+    }
+    if (!_updateTiersMidIntervalNode->hasValue()) {
+        _updateTiersMidIntervalNode->setDoubleValue(0.1);
+    }
+    if (!_updateTiersFarIntervalNode->hasValue()) {
+        _updateTiersFarIntervalNode->setDoubleValue(0.5);
+    }
+
     // register scenarios if we didn't do it already
     registerScenarios();
 }
@@ -305,6 +328,7 @@ void FGAIManager::shutdown()
     }
 
     ai_list.clear();
+    _trafficSnapshot.clear();
     _environmentVisiblity.clear();
 
     if (_userAircraft) {
@@ -355,8 +379,10 @@ void FGAIManager::update(double dt)
     range_nearest = 10000.0;
     strength = 0.0;
 
-    if (!enabled->getBoolValue())
+    if (!enabled->getBoolValue()) {
+        _trafficSnapshot.clear();
         return;
+    }
 
     fetchUserState(dt);
 
@@ -376,15 +402,26 @@ void FGAIManager::update(double dt)
 
     ai_list.erase(ai_list.begin(), firstAlive);
 
+    const bool tiersEnabled = _updateTiersEnabledNode->getBoolValue();
+    // tiers follow what the user sees, e.g. from a tower or tracking view
+    const SGVec3d viewCart = globals->get_view_position_cart();
+
     // every remaining item is alive. update them in turn, but guard for
     // exceptions, so a single misbehaving AI object doesn't bring down the
     // entire subsystem.
     for (FGAIBase* base : ai_list) {
+        const double updateDt = dt + base->getSkippedUpdateDt();
+        if (tiersEnabled && (updateDt < updateIntervalSec(base, viewCart))) {
+            base->setSkippedUpdateDt(updateDt);
+            continue;
+        }
+        base->setSkippedUpdateDt(0.0);
+
         try {
             if (base->isa(FGAIBase::object_type::otThermal)) {
-                processThermal(dt, static_cast<FGAIThermal*>(base));
+                processThermal(updateDt, static_cast<FGAIThermal*>(base));
             } else {
-                base->update(dt);
+                base->update(updateDt);
             }
         } catch (sg_exception& e) {
             SG_LOG(SG_AI, SG_WARN, "caught exception updating AI model:" << base->_getName() << ", which will be killed."
@@ -394,9 +431,39 @@ void FGAIManager::update(double dt)
         }
     }                                            // of live AI objects iteration
 
+    _trafficSnapshot.rebuild(ai_list);
+
     thermal_lift_node->setDoubleValue(strength); // for thermals
 }
 
+double FGAIManager::updateIntervalSec(FGAIBase* base, const SGVec3d& viewCart) const
+{
+    // objects the user can interact with closely, or which move too fast
+    // to step coarsely, are always updated every frame. So are multiplayer
+    // aircraft: they interpolate between received packets on each update,
+    // and feed the multiplayer properties and protocol every frame.
+    switch (base->getType()) {
+    case FGAIBase::object_type::otAircraft:
+    case FGAIBase::object_type::otShip:
+    case FGAIBase::object_type::otGroundVehicle:
+    case FGAIBase::object_type::otStatic:
+        break;
+    default:
+        return 0.0;
+    }
+
+    const double distNm = dist(viewCart, base->getCartPos()) * SG_METER_TO_NM;
+    if (distNm < _updateTiersNearRangeNode->getDoubleValue()) {
+        return 0.0;
+    }
+
+    if (distNm < _updateTiersFarRangeNode->getDoubleValue()) {
+        return _updateTiersMidIntervalNode->getDoubleValue();
+    }
+
+    return _updateTiersFarIntervalNode->getDoubleValue();
+}
+
 /** update LOD settings of all AI/MP models */
 void FGAIManager::updateLOD(SGPropertyNode* node)
 {
@@ -16,6 +16,8 @@
 #include <simgear/structure/SGSharedPtr.hxx>
 #include <simgear/structure/subsystem_mgr.hxx>
 
+#include "AITrafficSnapshot.hxx"
+
 class FGAIBase;
 class FGAIThermal;
 class FGAIAircraft;
@@ -81,6 +83,15 @@ public:
 
     double calcRangeFt(const SGVec3d& aCartPos, const FGAIBase* aObject) const;
 
+    /**
+     * @brief packed copy of all live AI/MP objects, as of the end of the
+     * last update. Use this rather than scanning /ai/models each frame.
+     */
+    const FGAITrafficSnapshot& trafficSnapshot() const
+    {
+        return _trafficSnapshot;
+    }
+
     /**
      * @brief Retrieve the representation of the user's aircraft in the AI manager
      * the position and velocity of this object are slaved to the user's aircraft,
@@ -104,6 +115,12 @@ public:
         return _radarRangeM;
     }
 
+    /**
+     * @brief minimum time between updates of an AI object, from its update
+     * tier given the view position. Zero for objects updated every frame.
+     */
+    double updateIntervalSec(FGAIBase* base, const SGVec3d& viewCart) const;
+
 private:
     // FGSubmodelMgr is a friend for access to the AI_list
     friend class FGSubmodelMgr;
@@ -149,6 +166,19 @@ private:
 
     void fetchUserState(double dt);
 
+    /**
+     * Distance based update tiers: objects within the near range of the
+     * view are updated every frame, further ones at most every mid/far
+     * interval, with the skipped time accumulated into the next update.
+     * Configured under /sim/ai/update-tiers.
+     */
+    SGPropertyNode_ptr _updateTiersEnabledNode;
+    SGPropertyNode_ptr _updateTiersNearRangeNode;
+    SGPropertyNode_ptr _updateTiersFarRangeNode;
+    SGPropertyNode_ptr _updateTiersMidIntervalNode;
+    SGPropertyNode_ptr _updateTiersFarIntervalNode;
+
+
     // used by thermals
     double range_nearest = 0.0;
     double strength = 0.0;
@@ -169,4 +199,6 @@ private:
     bool _radarEnabled = true,
          _radarDebugMode = false;
     double _radarRangeM = 0.0;
+
+    FGAITrafficSnapshot _trafficSnapshot;
 };
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileName: AIMotionHistory.cxx
+ * SPDX-FileComment: fixed-capacity time-ordered buffer of multiplayer motion samples
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <config.h>
+
+#include "AIMotionHistory.hxx"
+
+namespace {
+
+void releaseProperties(FGExternalMotionData& data)
+{
+    for (auto p : data.properties) {
+        delete p;
+    }
+    data.properties.clear();
+}
+
+// FGExternalMotionData deletes its properties when destroyed, so it can't
+// be copied around freely: hand the property list over explicitly.
+void moveSample(FGExternalMotionData& dst, FGExternalMotionData& src)
+{
+    releaseProperties(dst);
+    std::vector<FGPropertyData*> properties;
+    properties.swap(src.properties);
+    dst = src; // copies the motion data, and the now empty property list
+    dst.properties.swap(properties);
+}
+
+} // of anonymous namespace
+
+FGAIMotionHistory::FGAIMotionHistory(size_t capacity)
+{
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    _slots.resize(size);
+    _mask = size - 1;
+}
+
+FGAIMotionHistory::~FGAIMotionHistory()
+{
+    clear();
+}
+
+void FGAIMotionHistory::insert(double key, FGExternalMotionData& motionInfo)
+{
+    // search from the back: almost all samples arrive in order
+    size_t pos = _size;
+    while (pos > 0 && slot(pos - 1).key > key) {
+        --pos;
+    }
+
+    if (pos > 0 && slot(pos - 1).key == key) {
+        moveSample(slot(pos - 1).data, motionInfo);
+        return;
+    }
+
+    if (_size == _slots.size()) {
+        if (pos == 0) {
+            // older than anything we have, and no room left for it
+            releaseProperties(motionInfo);
+            return;
+        }
+        eraseFront(1);
+        --pos;
+    }
+
+    // make room at pos by shifting the later samples up by one
+    for (size_t i = _size; i > pos; --i) {
+        slot(i).key = slot(i - 1).key;
+        moveSample(slot(i).data, slot(i - 1).data);
+    }
+    ++_size;
+
+    slot(pos).key = key;
+    moveSample(slot(pos).data, motionInfo);
+}
+
+size_t FGAIMotionHistory::upperBound(double t) const
+{
+    size_t lo = 0, hi = _size;
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        if (slot(mid).key <= t) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void FGAIMotionHistory::eraseFront(size_t n)
+{
+    if (n > _size) {
+        n = _size;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        releaseProperties(slot(i).data);
+    }
+    _head = (_head + n) & _mask;
+    _size -= n;
+}
+
+void FGAIMotionHistory::clear()
+{
+    eraseFront(_size);
+    _head = 0;
+}
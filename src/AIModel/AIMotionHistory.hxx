@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileName: AIMotionHistory.hxx
+ * SPDX-FileComment: fixed-capacity time-ordered buffer of multiplayer motion samples
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <MultiPlayer/mpmessages.hxx>
+
+/**
+ * The recent position messages of a multiplayer aircraft, ordered by their
+ * (compensated) packet time, in a ring buffer allocated once.
+ *
+ * Samples normally arrive in time order and are appended; late packets are
+ * sorted in, and a packet with the time of an existing sample replaces it.
+ * When the buffer is full the oldest sample is dropped, so a model which
+ * isn't updated for a while doesn't grow without bound.
+ *
+ * The buffer owns the FGPropertyData of its samples. Samples are addressed
+ * by index, 0 being the oldest.
+ */
+class FGAIMotionHistory
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    /// the capacity is rounded up to a power of two
+    explicit FGAIMotionHistory(size_t capacity = DEFAULT_CAPACITY);
+    ~FGAIMotionHistory();
+
+    FGAIMotionHistory(const FGAIMotionHistory&) = delete;
+    FGAIMotionHistory& operator=(const FGAIMotionHistory&) = delete;
+
+    bool empty() const { return _size == 0; }
+    size_t size() const { return _size; }
+    size_t capacity() const { return _slots.size(); }
+
+    double key(size_t i) const { return slot(i).key; }
+    const FGExternalMotionData& operator[](size_t i) const { return slot(i).data; }
+
+    /**
+     * Add a sample with the given time. The properties are moved out of
+     * motionInfo, leaving its property list empty.
+     */
+    void insert(double key, FGExternalMotionData& motionInfo);
+
+    /// index of the first sample later than t, size() if there is none
+    size_t upperBound(double t) const;
+
+    /// drop the n oldest samples
+    void eraseFront(size_t n);
+
+    void clear();
+
+private:
+    struct Slot {
+        double key = 0.0;
+        FGExternalMotionData data;
+    };
+
+    Slot& slot(size_t i) { return _slots[(_head + i) & _mask]; }
+    const Slot& slot(size_t i) const { return _slots[(_head + i) & _mask]; }
+
+    std::vector<Slot> _slots;
+    size_t _mask = 0;
+    size_t _head = 0;
+    size_t _size = 0;
+};
@@ -8,6 +8,7 @@
 
 #include <config.h>
 
+#include <algorithm>
 #include <string>
 #include <stdio.h>
 
@@ -113,9 +114,30 @@ SGRawValueMethods<FGAIMultiplayer, type>(*this, \
 }
 
 
+void FGAIMultiplayer::addPropertyId(unsigned id, const char* name)
+{
+    auto it = std::lower_bound(mPropertyMap.begin(), mPropertyMap.end(), id,
+        [](const PropertyMap::value_type& entry, unsigned id) { return entry.first < id; });
+    if (it != mPropertyMap.end() && it->first == id) {
+        it->second = props->getNode(name, true);
+    } else {
+        mPropertyMap.emplace(it, id, props->getNode(name, true));
+    }
+}
+
+SGPropertyNode* FGAIMultiplayer::findProperty(unsigned id) const
+{
+    auto it = std::lower_bound(mPropertyMap.begin(), mPropertyMap.end(), id,
+        [](const PropertyMap::value_type& entry, unsigned id) { return entry.first < id; });
+    if (it != mPropertyMap.end() && it->first == id) {
+        return it->second;
+    }
+    return nullptr;
+}
+
 void FGAIMultiplayer::FGAIMultiplayerInterpolate(
-        MotionInfo::iterator prevIt,
-        MotionInfo::iterator nextIt,
+        const FGExternalMotionData& prev,
+        const FGExternalMotionData& next,
         double tau,
         SGVec3d& ecPos,
         SGQuatf& ecOrient,
@@ -123,31 +145,36 @@ void FGAIMultiplayer::FGAIMultiplayerInterpolate(
         )
 {
     // Here we do just linear interpolation on the position
-    ecPos = interpolate(tau, prevIt->second.position, nextIt->second.position);
-    ecOrient = interpolate((float)tau, prevIt->second.orientation,
-        nextIt->second.orientation);
-    ecLinearVel = interpolate((float)tau, prevIt->second.linearVel, nextIt->second.linearVel);
+    ecPos = interpolate(tau, prev.position, next.position);
+    ecOrient = interpolate((float)tau, prev.orientation,
+        next.orientation);
+    ecLinearVel = interpolate((float)tau, prev.linearVel, next.linearVel);
     speed = norm(ecLinearVel) * SG_METER_TO_NM * 3600.0;
 
-    if (prevIt->second.properties.size() == nextIt->second.properties.size()) {
+    // Packets with a different property layout (a delta packet, a peer
+    // moving in or out of the full detail range, or a truncated packet)
+    // can't be interpolated: take the newer values as they are.
+    if (prev.properties.size() != next.properties.size()) {
+        applyProperties(next);
+    } else {
         std::vector<FGPropertyData*>::const_iterator prevPropIt;
         std::vector<FGPropertyData*>::const_iterator prevPropItEnd;
         std::vector<FGPropertyData*>::const_iterator nextPropIt;
         std::vector<FGPropertyData*>::const_iterator nextPropItEnd;
 
-        prevPropIt = prevIt->second.properties.begin();
-        prevPropItEnd = prevIt->second.properties.end();
-        nextPropIt = nextIt->second.properties.begin();
-        nextPropItEnd = nextIt->second.properties.end();
+        prevPropIt = prev.properties.begin();
+        prevPropItEnd = prev.properties.end();
+        nextPropIt = next.properties.begin();
+        nextPropItEnd = next.properties.end();
 
         while (prevPropIt != prevPropItEnd)
         {
-            PropertyMap::iterator pIt = mPropertyMap.find((*prevPropIt)->id);
+            SGPropertyNode* pNode = findProperty((*prevPropIt)->id);
             //cout << " Setting property..." << (*prevPropIt)->id;
 
-            if (pIt != mPropertyMap.end())
+            if (pNode)
             {
-                //cout << "Found " << pIt->second->getPath() << ":";
+                //cout << "Found " << pNode->getPath() << ":";
 
                 /*
                  * RJH - 2017-01-25
@@ -171,7 +198,7 @@ void FGAIMultiplayer::FGAIMultiplayerInterpolate(
                             // Jean Pellotier, 2018-01-02 : we don't want interpolation for integer values, they are mostly used
                             // for non linearly changing values (e.g. transponder etc ...)
                             // fixes: https://sourceforge.net/p/flightgear/codetickets/1885/
-                            pIt->second->setIntValue((*nextPropIt)->int_value);
+                            pNode->setIntValue((*nextPropIt)->int_value);
                             break;
 
                         case simgear::props::FLOAT:
@@ -179,14 +206,14 @@ void FGAIMultiplayer::FGAIMultiplayerInterpolate(
                             {
                                 float val = (1 - tau)*(*prevPropIt)->float_value +
                                             tau*(*nextPropIt)->float_value;
-                                pIt->second->setFloatValue(val);
+                                pNode->setFloatValue(val);
                             }
                             break;
                         
                         case simgear::props::STRING:
                         case simgear::props::UNSPECIFIED:
                             //cout << "Str: " << (*nextPropIt)->string_value << "\n";
-                            pIt->second->setStringValue((*nextPropIt)->string_value);
+                            pNode->setStringValue((*nextPropIt)->string_value);
                             break;
 
                         default:
@@ -194,14 +221,16 @@ void FGAIMultiplayer::FGAIMultiplayerInterpolate(
                             {
                                 float val = (1 - tau)*(*prevPropIt)->float_value +
                                             tau*(*nextPropIt)->float_value;
-                                pIt->second->setFloatValue(val);
+                                pNode->setFloatValue(val);
                             }
                             break;
                     }
                 }
                 else
                 {
-                    SG_LOG(SG_AI, SG_WARN, "MP packet mismatch during lag interpolation: " << (*prevPropIt)->id << " != " << (*nextPropIt)->id << "\n");
+                    SG_LOG(SG_AI, SG_DEBUG, "MP packet mismatch during lag interpolation: " << (*prevPropIt)->id << " != " << (*nextPropIt)->id << "\n");
+                    applyProperties(next);
+                    return;
                 }
             }
             else
@@ -216,7 +245,8 @@ void FGAIMultiplayer::FGAIMultiplayerInterpolate(
 }
 
 void FGAIMultiplayer::FGAIMultiplayerExtrapolate(
-        MotionInfo::iterator nextIt,
+        const FGExternalMotionData& motionInfo,
+        double nextTime,
         double tInterp,
         bool motion_logging,
         SGVec3d& ecPos,
@@ -224,12 +254,10 @@ void FGAIMultiplayer::FGAIMultiplayerExtrapolate(
         SGVec3f& ecLinearVel
         )
 {
-    const FGExternalMotionData& motionInfo = nextIt->second;
-
     // The time to predict, limit to 3 seconds. But don't do this if we are
     // running motion tests, because it can mess up the results.
     //
-    double t = tInterp - nextIt->first;
+    double t = tInterp - nextTime;
     if (!motion_logging)
     {
         props->setDoubleValue("lag/extrapolation-t", t);
@@ -276,39 +304,44 @@ void FGAIMultiplayer::FGAIMultiplayerExtrapolate(
         ecPos += t*(ecVel);
     }
 
+    speed = norm(ecLinearVel) * SG_METER_TO_NM * 3600.0;
+    applyProperties(motionInfo);
+}
+
+void FGAIMultiplayer::applyProperties(const FGExternalMotionData& motionInfo)
+{
     std::vector<FGPropertyData*>::const_iterator firstPropIt;
     std::vector<FGPropertyData*>::const_iterator firstPropItEnd;
-    speed = norm(ecLinearVel) * SG_METER_TO_NM * 3600.0;
     firstPropIt = motionInfo.properties.begin();
     firstPropItEnd = motionInfo.properties.end();
     while (firstPropIt != firstPropItEnd)
     {
-        PropertyMap::iterator pIt = mPropertyMap.find((*firstPropIt)->id);
+        SGPropertyNode* pNode = findProperty((*firstPropIt)->id);
         //cout << " Setting property..." << (*firstPropIt)->id;
 
-        if (pIt != mPropertyMap.end())
+        if (pNode)
         {
             switch ((*firstPropIt)->type)
             {
               case simgear::props::INT:
               case simgear::props::BOOL:
               case simgear::props::LONG:
-                  pIt->second->setIntValue((*firstPropIt)->int_value);
+                  pNode->setIntValue((*firstPropIt)->int_value);
                   //cout << "Int: " << (*firstPropIt)->int_value << "\n";
                   break;
               case simgear::props::FLOAT:
               case simgear::props::DOUBLE:
-                  pIt->second->setFloatValue((*firstPropIt)->float_value);
+                  pNode->setFloatValue((*firstPropIt)->float_value);
                   //cout << "Flo: " << (*firstPropIt)->float_value << "\n";
                   break;
               case simgear::props::STRING:
               case simgear::props::UNSPECIFIED:
-                  pIt->second->setStringValue((*firstPropIt)->string_value);
+                  pNode->setStringValue((*firstPropIt)->string_value);
                   //cout << "Str: " << (*firstPropIt)->string_value << "\n";
                   break;
               default:
                   // FIXME - currently defaults to float values
-                  pIt->second->setFloatValue((*firstPropIt)->float_value);
+                  pNode->setFloatValue((*firstPropIt)->float_value);
                   //cout << "Unk: " << (*firstPropIt)->float_value << "\n";
                   break;
             }
@@ -447,8 +480,8 @@ void FGAIMultiplayer::update(double dt)
     else
     {
         // Get the last available time
-        MotionInfo::reverse_iterator motioninfo_back = mMotionInfo.rbegin();
-        const double curentPkgTime = motioninfo_back->first;
+        const size_t back = mMotionInfo.size() - 1;
+        const double curentPkgTime = mMotionInfo.key(back);
 
         // The current simulation time we need to update for,
         // note that the simulation time is updated before calling all the
@@ -465,7 +498,7 @@ void FGAIMultiplayer::update(double dt)
         // component will provide this. We just take the error of the currently
         // requested time to the most recent available packet. This is the
         // target we want to reach in average.
-        double lag = motioninfo_back->second.lag;
+        double lag = mMotionInfo[back].lag;
 
         rawLag = curentPkgTime - curtime;
         realTime = false; //default behaviour
@@ -588,27 +621,27 @@ void FGAIMultiplayer::update(double dt)
     SGQuatf ecOrient;
     SGVec3f ecLinearVel;
 
-    MotionInfo::iterator nextIt = mMotionInfo.upper_bound(tInterp);
-    MotionInfo::iterator prevIt = nextIt;
+    size_t nextIdx = mMotionInfo.upperBound(tInterp);
+    size_t prevIdx = nextIdx;
     
-    if (nextIt != mMotionInfo.end() && nextIt->first >= tInterp)
+    if (nextIdx < mMotionInfo.size() && mMotionInfo.key(nextIdx) >= tInterp)
     {
         // Ok, we need a time previous to the last available packet,
         // that is good ...
         // the case tInterp = curentPkgTime need to be in the interpolation, to avoid a bug zeroing the position
 
         double tau = 0;
-        if (nextIt == mMotionInfo.begin())
+        if (nextIdx == 0)
         {
-            // Leave prevIt and nextIt pointing at same item.
+            // Leave prevIdx and nextIdx pointing at same item.
             SG_LOG(SG_GENERAL, SG_DEBUG, "Only one frame for interpolation: " << _callsign);
         }
         else
         {
-            --prevIt;
+            --prevIdx;
             // Interpolation coefficient is between 0 and 1
-            double intervalStart = prevIt->first;
-            double intervalEnd = nextIt->first;
+            double intervalStart = mMotionInfo.key(prevIdx);
+            double intervalEnd = mMotionInfo.key(nextIdx);
 
             double intervalLen = intervalEnd - intervalStart;
             if (intervalLen != 0.0)
@@ -617,21 +650,21 @@ void FGAIMultiplayer::update(double dt)
             }
         }
         
-        FGAIMultiplayerInterpolate(prevIt, nextIt, tau, ecPos, ecOrient, ecLinearVel);
+        FGAIMultiplayerInterpolate(mMotionInfo[prevIdx], mMotionInfo[nextIdx], tau, ecPos, ecOrient, ecLinearVel);
     }
     else
     {
         // Ok, we need to predict the future, so, take the best data we can have
         // and do some eom computation to guess that for now.
-        --nextIt;
-        --prevIt;   // so mMotionInfo.erase() does the right thing below.
-        FGAIMultiplayerExtrapolate(nextIt, tInterp, motion_logging, ecPos, ecOrient, ecLinearVel);
+        --nextIdx;
+        --prevIdx;   // so mMotionInfo.eraseFront() does the right thing below.
+        FGAIMultiplayerExtrapolate(mMotionInfo[nextIdx], mMotionInfo.key(nextIdx), tInterp, motion_logging, ecPos, ecOrient, ecLinearVel);
     }
 
-    // Remove any motion information before <prevIt> - we will not need this in
+    // Remove any motion information before <prevIdx> - we will not need this in
     // the future.
     //
-    mMotionInfo.erase(mMotionInfo.begin(), prevIt);
+    mMotionInfo.eraseFront(prevIdx);
     
     // extract the position
     pos = SGGeod::fromCart(ecPos);
@@ -848,20 +881,20 @@ FGAIMultiplayer::addMotionInfo(FGExternalMotionData& motionInfo,
         // m_time_compensation is set to non-zero if packets seem to have
         // wildly different times from us, if simple-time mode is enabled.
         //
-        // So most code with an <iterator> into mMotionInfo that needs to
-        // use the MP packet's time, will actually use iterator->first, not
-        // iterator->second.time..
+        // So most code with an index into mMotionInfo that needs to
+        // use the MP packet's time, will actually use mMotionInfo.key(), not
+        // mMotionInfo[].time..
         //
-        mMotionInfo[t_key] = motionInfo;
+        mMotionInfo.insert(t_key, motionInfo);
     }
     else
     {
-        mMotionInfo[motionInfo.time] = motionInfo;
+        mMotionInfo.insert(motionInfo.time, motionInfo);
     }
 
-    // We just copied the property (pointer) list - they are ours now. Clear the
-    // properties list in given/returned object, so former owner won't deallocate them.
-    motionInfo.properties.clear();
+    // insert() took the property (pointer) list - they are ours now, and
+    // the list in given/returned object is empty, so former owner won't
+    // deallocate them.
   
     {
         // Gather data on multiplayer speed, used by scripts/python/recordreplay.py.
@@ -7,13 +7,15 @@
 
 #pragma once
 
-#include <map>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <MultiPlayer/mpmessages.hxx>
 
 #include "AIBase.hxx"
+#include "AIMotionHistory.hxx"
 
 
 class FGAIMultiplayer : public FGAIBase
@@ -59,10 +61,7 @@ public:
         return mLagAdjustSystemSpeed;
     }
 
-    void addPropertyId(unsigned id, const char* name)
-    {
-        mPropertyMap[id] = props->getNode(name, true);
-    }
+    void addPropertyId(unsigned id, const char* name);
 
     double getplayerLag() const
     {
@@ -92,34 +91,39 @@ public:
     void clearMotionInfo();
 
 private:
-    // Automatic sorting of motion data according to its timestamp
-    typedef std::map<double, FGExternalMotionData> MotionInfo;
-    MotionInfo mMotionInfo;
+    // Motion data sorted according to its timestamp
+    FGAIMotionHistory mMotionInfo;
 
     // Map between the property id's from the multiplayer network packets
-    // and the property nodes
-    typedef std::map<unsigned, SGSharedPtr<SGPropertyNode>> PropertyMap;
+    // and the property nodes, sorted by id
+    typedef std::vector<std::pair<unsigned, SGSharedPtr<SGPropertyNode>>> PropertyMap;
     PropertyMap mPropertyMap;
 
+    SGPropertyNode* findProperty(unsigned id) const;
+
+    // Sets the properties received in motionInfo, without interpolation.
+    void applyProperties(const FGExternalMotionData& motionInfo);
+
     // Calculates position, orientation and velocity using interpolation between
-    // *prevIt and *nextIt, specifically (1-tau)*(*prevIt) + tau*(*nextIt).
+    // prev and next, specifically (1-tau)*prev + tau*next.
     //
     // Cannot call this method 'interpolate' because that would hide the name in
     // OSG.
     //
     void FGAIMultiplayerInterpolate(
-        MotionInfo::iterator prevIt,
-        MotionInfo::iterator nextIt,
+        const FGExternalMotionData& prev,
+        const FGExternalMotionData& next,
         double tau,
         SGVec3d& ecPos,
         SGQuatf& ecOrient,
         SGVec3f& ecLinearVel);
 
     // Calculates position, orientation and velocity using extrapolation from
-    // *nextIt.
+    // next, whose time is nextTime.
     //
     void FGAIMultiplayerExtrapolate(
-        MotionInfo::iterator nextIt,
+        const FGExternalMotionData& next,
+        double nextTime,
         double tInterp,
         bool motion_logging,
         SGVec3d& ecPos,
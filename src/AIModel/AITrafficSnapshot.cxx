@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileName: AITrafficSnapshot.cxx
+ * SPDX-FileComment: per-frame packed snapshot of AI/MP traffic with a spatial index
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <config.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <simgear/constants.h>
+
+#include "AITrafficSnapshot.hxx"
+
+namespace {
+
+// Grid cells are cubes of this size in cartesian (ECEF) space. Typical
+// queries (TCAS, Flarm) cover only a few cells; the large radar ranges
+// fall back to scanning the occupied cells.
+const double CELL_SIZE_M = 20.0 * SG_NM_TO_METER;
+
+// 21 bits per axis are plenty: the earth spans ~700 cells per axis
+const int CELL_COORD_BIAS = 1 << 20;
+const uint64_t CELL_COORD_MASK = (1 << 21) - 1;
+
+int cellCoord(double v)
+{
+    return static_cast<int>(std::floor(v / CELL_SIZE_M));
+}
+
+uint64_t cellKey(int x, int y, int z)
+{
+    return ((static_cast<uint64_t>(x + CELL_COORD_BIAS) & CELL_COORD_MASK) << 42) |
+           ((static_cast<uint64_t>(y + CELL_COORD_BIAS) & CELL_COORD_MASK) << 21) |
+           (static_cast<uint64_t>(z + CELL_COORD_BIAS) & CELL_COORD_MASK);
+}
+
+void decodeCellKey(uint64_t key, int& x, int& y, int& z)
+{
+    x = static_cast<int>((key >> 42) & CELL_COORD_MASK) - CELL_COORD_BIAS;
+    y = static_cast<int>((key >> 21) & CELL_COORD_MASK) - CELL_COORD_BIAS;
+    z = static_cast<int>(key & CELL_COORD_MASK) - CELL_COORD_BIAS;
+}
+
+} // of anonymous namespace
+
+void FGAITrafficSnapshot::clear()
+{
+    _cartPos.clear();
+    _latitudeDeg.clear();
+    _longitudeDeg.clear();
+    _altitudeFt.clear();
+    _headingDeg.clear();
+    _speedKts.clear();
+    _speedNorthFps.clear();
+    _speedEastFps.clear();
+    _verticalSpeedFps.clear();
+    _id.clear();
+    _type.clear();
+    _callsignId.clear();
+    _props.clear();
+
+    _cellKeys.clear();
+    _cellStart.clear();
+    _cellTargets.clear();
+}
+
+int FGAITrafficSnapshot::internCallsign(const std::string& callsign)
+{
+    auto it = _callsignIds.find(callsign);
+    if (it != _callsignIds.end()) {
+        return it->second;
+    }
+
+    const int id = static_cast<int>(_callsigns.size());
+    _callsigns.push_back(callsign);
+    _callsignIds.emplace(callsign, id);
+    return id;
+}
+
+void FGAITrafficSnapshot::rebuild(const ObjectList& objects)
+{
+    // clear() keeps the capacity, so steady-state rebuilds don't allocate
+    clear();
+
+    for (FGAIBase* base : objects) {
+        if (base->getDie()) {
+            continue;
+        }
+
+        _cartPos.push_back(base->getCartPos());
+        _latitudeDeg.push_back(base->_getLatitude());
+        _longitudeDeg.push_back(base->_getLongitude());
+        _altitudeFt.push_back(base->_getAltitude());
+        _headingDeg.push_back(base->_getHeading());
+        _speedKts.push_back(base->_getSpeed());
+        _speedNorthFps.push_back(base->_get_speed_north_fps());
+        _speedEastFps.push_back(base->_get_speed_east_fps());
+        _verticalSpeedFps.push_back(base->_getVS_fps());
+        _id.push_back(base->getID());
+        _type.push_back(base->getType());
+        _callsignId.push_back(internCallsign(base->getCallSign()));
+        _props.push_back(base->_getProps());
+    }
+
+    buildGrid();
+}
+
+void FGAITrafficSnapshot::buildGrid()
+{
+    const int count = static_cast<int>(_cartPos.size());
+
+    std::vector<std::pair<uint64_t, int>> keyed;
+    keyed.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const SGVec3d& p = _cartPos[i];
+        keyed.emplace_back(cellKey(cellCoord(p.x()), cellCoord(p.y()), cellCoord(p.z())), i);
+    }
+
+    std::sort(keyed.begin(), keyed.end());
+
+    _cellTargets.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        if (_cellKeys.empty() || (_cellKeys.back() != keyed[i].first)) {
+            _cellKeys.push_back(keyed[i].first);
+            _cellStart.push_back(i);
+        }
+        _cellTargets.push_back(keyed[i].second);
+    }
+    _cellStart.push_back(count);
+}
+
+void FGAITrafficSnapshot::findWithinRange(const SGVec3d& cartPos, double rangeNm, std::vector<size_t>& result) const
+{
+    if (_cellKeys.empty() || (rangeNm < 0.0)) {
+        return;
+    }
+
+    const double rangeM = rangeNm * SG_NM_TO_METER;
+    const double rangeSqr = rangeM * rangeM;
+    const size_t firstResult = result.size();
+
+    const int x0 = cellCoord(cartPos.x() - rangeM), x1 = cellCoord(cartPos.x() + rangeM);
+    const int y0 = cellCoord(cartPos.y() - rangeM), y1 = cellCoord(cartPos.y() + rangeM);
+    const int z0 = cellCoord(cartPos.z() - rangeM), z1 = cellCoord(cartPos.z() + rangeM);
+
+    auto collectCell = [&](size_t c) {
+        for (int k = _cellStart[c]; k < _cellStart[c + 1]; ++k) {
+            const int t = _cellTargets[k];
+            if (distSqr(cartPos, _cartPos[t]) <= rangeSqr) {
+                result.push_back(t);
+            }
+        }
+    };
+
+    const double boxCells = double(x1 - x0 + 1) * double(y1 - y0 + 1) * double(z1 - z0 + 1);
+    if (boxCells > _cellKeys.size()) {
+        // large range: cheaper to test every occupied cell against the box
+        for (size_t c = 0; c < _cellKeys.size(); ++c) {
+            int x, y, z;
+            decodeCellKey(_cellKeys[c], x, y, z);
+            if ((x >= x0) && (x <= x1) && (y >= y0) && (y <= y1) && (z >= z0) && (z <= z1)) {
+                collectCell(c);
+            }
+        }
+    } else {
+        for (int x = x0; x <= x1; ++x) {
+            for (int y = y0; y <= y1; ++y) {
+                for (int z = z0; z <= z1; ++z) {
+                    auto it = std::lower_bound(_cellKeys.begin(), _cellKeys.end(), cellKey(x, y, z));
+                    if ((it != _cellKeys.end()) && (*it == cellKey(x, y, z))) {
+                        collectCell(it - _cellKeys.begin());
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin() + firstResult, result.end());
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileName: AITrafficSnapshot.hxx
+ * SPDX-FileComment: per-frame packed snapshot of AI/MP traffic with a spatial index
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <simgear/math/SGMath.hxx>
+#include <simgear/props/props.hxx>
+
+#include "AIBase.hxx"
+
+/**
+ * Structure-of-arrays copy of the state of all live AI and multiplayer
+ * objects, rebuilt by FGAIManager once per frame after the objects have
+ * been updated. Instruments and protocols which scan the traffic every
+ * frame (TCAS, radar, Flarm, ...) can use this instead of walking
+ * /ai/models, and ask for the targets within some range through a uniform
+ * grid over the cartesian positions.
+ *
+ * Targets are addressed by their index in the snapshot, which is only
+ * valid until the next rebuild.
+ */
+class FGAITrafficSnapshot
+{
+public:
+    typedef std::vector<SGSharedPtr<FGAIBase>> ObjectList;
+
+    void rebuild(const ObjectList& objects);
+    void clear();
+
+    size_t size() const { return _id.size(); }
+    bool empty() const { return _id.empty(); }
+
+    const SGVec3d& cartPos(size_t i) const { return _cartPos[i]; }
+    double latitudeDeg(size_t i) const { return _latitudeDeg[i]; }
+    double longitudeDeg(size_t i) const { return _longitudeDeg[i]; }
+    double altitudeFt(size_t i) const { return _altitudeFt[i]; }
+    double headingDeg(size_t i) const { return _headingDeg[i]; }
+    double speedKts(size_t i) const { return _speedKts[i]; }
+    double speedNorthFps(size_t i) const { return _speedNorthFps[i]; }
+    double speedEastFps(size_t i) const { return _speedEastFps[i]; }
+    double verticalSpeedFps(size_t i) const { return _verticalSpeedFps[i]; }
+    int id(size_t i) const { return _id[i]; }
+    FGAIBase::object_type type(size_t i) const { return _type[i]; }
+
+    /// interned callsign: equal callsigns share an id, stable across rebuilds
+    int callsignId(size_t i) const { return _callsignId[i]; }
+    const std::string& callsign(size_t i) const { return _callsigns[_callsignId[i]]; }
+
+    /// the object's node under /ai/models, for the few values not copied here
+    SGPropertyNode* props(size_t i) const { return _props[i]; }
+
+    /**
+     * Append to 'result' the indices of all targets within rangeNm of the
+     * cartesian position, sorted by index.
+     */
+    void findWithinRange(const SGVec3d& cartPos, double rangeNm, std::vector<size_t>& result) const;
+
+private:
+    void buildGrid();
+    int internCallsign(const std::string& callsign);
+
+    std::vector<SGVec3d> _cartPos;
+    std::vector<double> _latitudeDeg;
+    std::vector<double> _longitudeDeg;
+    std::vector<double> _altitudeFt;
+    std::vector<double> _headingDeg;
+    std::vector<double> _speedKts;
+    std::vector<double> _speedNorthFps;
+    std::vector<double> _speedEastFps;
+    std::vector<double> _verticalSpeedFps;
+    std::vector<int> _id;
+    std::vector<FGAIBase::object_type> _type;
+    std::vector<int> _callsignId;
+    std::vector<SGPropertyNode*> _props;
+
+    std::vector<std::string> _callsigns;
+    std::unordered_map<std::string, int> _callsignIds;
+
+    // uniform grid: occupied cell keys in ascending order, with the targets
+    // of cell _cellKeys[c] at _cellTargets[_cellStart[c] .. _cellStart[c+1])
+    std::vector<uint64_t> _cellKeys;
+    std::vector<int> _cellStart;
+    std::vector<int> _cellTargets;
+};
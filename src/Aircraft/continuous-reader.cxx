@@ -0,0 +1,377 @@
+/*
+ * SPDX-FileName: continuous-reader.cxx
+ * SPDX-FileComment: reading Continuous recordings, without depending on the rest of Flightgear
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "continuous-reader.hxx"
+
+#include <simgear/debug/logstream.hxx>
+#include <simgear/io/sg_mmap.hxx>
+#include <simgear/props/props_io.hxx>
+
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+#include <string.h>
+
+
+const char* const FlightRecorderFileMagic = "FlightGear Flight Recorder Tape";
+
+// Reads binary data from a stream into an instance of a type.
+template<typename T>
+static void readRaw(std::istream& in, T& data)
+{
+    in.read(reinterpret_cast<char*>(&data), sizeof(data));
+}
+
+// Read properties from stream into *node.
+static int PropertiesRead(std::istream& in, SGPropertyNode* node)
+{
+    uint32_t buffer_len;
+    readRaw(in, buffer_len);
+    std::vector<char> buffer(buffer_len);
+    in.read(&buffer.front(), buffer.size());
+    readProperties(&buffer.front(), buffer.size() - 1, node);
+    return 0;
+}
+
+int loadContinuousHeader(const std::string& path, std::istream* in, SGPropertyNode* properties)
+{
+    std::ifstream in0;
+    if (!in) {
+        in0.open(path);
+        in = &in0;
+    }
+    if (!*in) {
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to open path=" << path);
+        return +1;
+    }
+    std::vector<char> buffer(strlen(FlightRecorderFileMagic) + 1);
+    in->read(&buffer.front(), buffer.size());
+    SG_LOG(SG_SYSTEMS, SG_DEBUG, "in->gcount()=" << in->gcount() << " buffer.size()=" << buffer.size());
+    if ((size_t)in->gcount() != buffer.size()) {
+        // Further download is needed.
+        return +1;
+    }
+    if (strcmp(&buffer.front(), FlightRecorderFileMagic)) {
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "fgtape prefix doesn't match FlightRecorderFileMagic in path: " << path);
+        return -1;
+    }
+    bool ok = false;
+    try {
+        PropertiesRead(*in, properties);
+        ok = true;
+    } catch (std::exception& e) {
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to read Config properties in: " << path << ": " << e.what());
+    }
+    if (!ok) {
+        // Failed to read properties, so indicate that further download is needed.
+        return +1;
+    }
+    SG_LOG(SG_SYSTEMS, SG_BULK, "properties is:\n"
+                                    << writePropertiesInline(properties, true /*write_all*/) << "\n");
+    return 0;
+}
+
+
+ContinuousInflater::ContinuousInflater()
+{
+    zstream.zalloc = nullptr;
+    zstream.zfree = nullptr;
+    zstream.opaque = nullptr;
+    zstream.next_in = nullptr;
+    zstream.avail_in = 0;
+    if (inflateInit2(&zstream, -15 /*windowBits*/) != Z_OK)
+    {
+        throw std::runtime_error("inflateInit2() failed");
+    }
+}
+
+ContinuousInflater::~ContinuousInflater()
+{
+    inflateEnd(&zstream);
+}
+
+bool ContinuousInflater::inflateFrame(const char* in, size_t in_size, std::vector<char>& out)
+{
+    inflateReset(&zstream);
+    zstream.next_in = (unsigned char*) in;
+    zstream.avail_in = in_size;
+    if (out.size() < 4096)  out.resize(4096);
+    size_t n = 0;
+    for(;;)
+    {
+        if (n == out.size())    out.resize(2 * out.size());
+        zstream.next_out = (unsigned char*) &out[n];
+        zstream.avail_out = out.size() - n;
+        int e = inflate(&zstream, Z_NO_FLUSH);
+        n = out.size() - zstream.avail_out;
+        if (e == Z_STREAM_END)  break;
+        if (e != Z_OK && e != Z_BUF_ERROR)
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "inflate() failed: " << e);
+            return false;
+        }
+        if (zstream.avail_out)
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Compressed fgtape frame is truncated");
+            return false;
+        }
+    }
+    out.resize(n);
+    return true;
+}
+
+
+bool ContinuousTapeSignals::init(const SGPropertyNode* signals)
+{
+    // Signals are stored in this order, see FGFlightRecorder::capture().
+    static const struct
+    {
+        const char* name;
+        Type        type;
+        size_t      size;
+    } types[] = {
+        {"double",  Type_DOUBLE,    sizeof(double)},
+        {"float",   Type_FLOAT,     sizeof(float)},
+        {"int",     Type_INT,       sizeof(int)},
+        {"int16",   Type_INT16,     sizeof(short int)},
+        {"int8",    Type_INT8,      sizeof(signed char)},
+        {"bool",    Type_BOOL,      0},
+    };
+
+    m_signals.clear();
+    m_size = 0;
+    simgear::PropertyList list;
+    if (const SGPropertyNode* node = signals->getChild("signals"))
+    {
+        list = node->getChildren("signal");
+    }
+    size_t num_bools = 0;
+    for (auto& t: types)
+    {
+        for (auto signal: list)
+        {
+            if (signal->getStringValue("type") != t.name) continue;
+            Signal s;
+            s.property = signal->getStringValue("property");
+            s.interpolation = signal->getStringValue("interpolation");
+            s.type = t.type;
+            if (t.type == Type_BOOL)
+            {
+                s.offset = m_size + num_bools / 8;
+                s.bit = num_bools % 8;
+                num_bools += 1;
+            }
+            else
+            {
+                s.offset = m_size;
+                s.bit = 0;
+                m_size += t.size;
+            }
+            m_signals.push_back(s);
+        }
+    }
+    m_size += (num_bools + 7) / 8;
+
+    for (auto signal: list)
+    {
+        bool known = false;
+        for (auto& t: types)
+        {
+            if (signal->getStringValue("type") == t.name)  known = true;
+        }
+        if (!known)
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Unknown signal type '" << signal->getStringValue("type")
+                    << "' for " << signal->getStringValue("property"));
+            return false;
+        }
+    }
+
+    // The record size includes the frame time.
+    int record_size = signals->getIntValue("recorder/record-size", -1);
+    if (record_size != -1 && (size_t) record_size != sizeof(double) + m_size)
+    {
+        SG_LOG(SG_SYSTEMS, SG_ALERT, "Signals have size " << m_size
+                << " but recorder/record-size is " << record_size);
+        return false;
+    }
+    return true;
+}
+
+double ContinuousTapeSignals::value(const char* data, size_t i) const
+{
+    const Signal& s = m_signals[i];
+    const char* p = data + s.offset;
+    switch (s.type)
+    {
+        case Type_DOUBLE:
+        {
+            double v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case Type_FLOAT:
+        {
+            float v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case Type_INT:
+        {
+            int v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case Type_INT16:
+        {
+            short int v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case Type_INT8:
+            return (signed char) *p;
+        case Type_BOOL:
+            return (*p >> s.bit) & 1;
+    }
+    return 0;
+}
+
+
+ContinuousTapeReader::ContinuousTapeReader()
+{
+}
+
+ContinuousTapeReader::~ContinuousTapeReader()
+{
+}
+
+int ContinuousTapeReader::open(const SGPath& path)
+{
+    m_mapped.reset(new SGMMapFile(path));
+    m_config = new SGPropertyNode;
+    m_data.clear();
+    m_pos = 0;
+    if (!m_mapped->open(SG_IO_IN) || !m_mapped->get())
+    {
+        SG_LOG(SG_SYSTEMS, SG_ALERT, "Failed to memory map " << path);
+        m_mapped.reset();
+        return +1;
+    }
+
+    const char* begin = m_mapped->get();
+    memory_streambuf    buffer(begin, begin + m_mapped->get_size());
+    std::istream        in(&buffer);
+    int e = loadContinuousHeader(path.str(), &in, m_config);
+    if (e)
+    {
+        m_mapped.reset();
+        return e;
+    }
+    m_pos = in.tellg();
+
+    for (auto data: m_config->getChildren("data"))
+    {
+        m_data.push_back(data->getStringValue());
+    }
+    m_compression = m_config->getIntValue("meta/continuous-compression");
+    return 0;
+}
+
+int ContinuousTapeReader::dataIndex(const std::string& data_type) const
+{
+    for (size_t i = 0; i != m_data.size(); ++i)
+    {
+        if (m_data[i] == data_type) return i;
+    }
+    return -1;
+}
+
+bool ContinuousTapeReader::next(ContinuousTapeFrame& frame)
+{
+    if (!m_mapped)  return false;
+    const char* begin = m_mapped->get();
+    const char* end = begin + m_mapped->get_size();
+    while (begin + m_pos != end)
+    {
+        size_t next = continuousParseFrame(begin, end, m_pos, m_data.size(), m_compression,
+                m_inflater, m_inflated, frame);
+        if (!next)
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Continuous recording is truncated or corrupt at offset " << m_pos);
+            m_pos = end - begin;
+            return false;
+        }
+        m_pos = next;
+        if (!std::isnan(frame.time))    return true;
+    }
+    return false;
+}
+
+
+size_t continuousParseFrame(
+        const char* begin,
+        const char* end,
+        size_t pos,
+        size_t num_items,
+        bool compression,
+        std::unique_ptr<ContinuousInflater>& inflater,
+        std::vector<char>& inflated,
+        ContinuousTapeFrame& frame
+        )
+{
+    const char* p = begin + pos;
+    double time;
+    uint32_t length;
+    if (pos >= (size_t) (end - begin) || end - p < (ptrdiff_t) (sizeof(time) + sizeof(length)))
+    {
+        return 0;
+    }
+    memcpy(&time, p, sizeof(time));
+    p += sizeof(time);
+
+    frame.time = time;
+    frame.offset = pos;
+    frame.items.clear();
+
+    if (std::isnan(time))
+    {
+        // Index chunk.
+        memcpy(&length, p, sizeof(length));
+        p += sizeof(length);
+        if (end - p < (ptrdiff_t) length)    return 0;
+        return p + length - begin;
+    }
+
+    const char* data = p;
+    const char* data_end = end;
+    size_t next = 0;
+    if (compression)
+    {
+        uint32_t    compressed_size;
+        if (end - p < (ptrdiff_t) (sizeof(uint8_t) + sizeof(compressed_size)))   return 0;
+        memcpy(&compressed_size, p + sizeof(uint8_t), sizeof(compressed_size));
+        p += sizeof(uint8_t) + sizeof(compressed_size);
+        if (end - p < (ptrdiff_t) compressed_size) return 0;
+        if (!inflater)  inflater.reset(new ContinuousInflater);
+        if (!inflater->inflateFrame(p, compressed_size, inflated))  return 0;
+        next = p + compressed_size - begin;
+        data = inflated.data();
+        data_end = data + inflated.size();
+    }
+
+    for (size_t i = 0; i != num_items; ++i)
+    {
+        if (data_end - data < (ptrdiff_t) sizeof(length))   return 0;
+        memcpy(&length, data, sizeof(length));
+        data += sizeof(length);
+        if (data_end - data < (ptrdiff_t) length)   return 0;
+        frame.items.emplace_back(data, length);
+        data += length;
+    }
+    if (!compression)   next = data - begin;
+    return next;
+}
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileName: continuous-reader.hxx
+ * SPDX-FileComment: reading Continuous recordings, without depending on the rest of Flightgear
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include <simgear/misc/sg_path.hxx>
+#include <simgear/props/props.hxx>
+
+class SGMMapFile;
+
+/** Magic string to verify valid FG flight recorder tapes. */
+extern const char* const FlightRecorderFileMagic;
+
+/* Attempts to load Continuous recording header properties into
+<properties>. If in is null we use internal std::fstream, otherwise we use *in.
+
+Returns 0 on success, +1 if we may succeed after further download, or -1 if
+recording is not a Continuous recording. */
+int loadContinuousHeader(const std::string& path, std::istream* in, SGPropertyNode* properties);
+
+
+// Read-only streambuf for a block of memory, used to read frames from a
+// memory-mapped recording.
+struct memory_streambuf : std::streambuf
+{
+    memory_streambuf(const char* begin, const char* end)
+    {
+        setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        off_type base = gptr() - eback();
+        if (dir == std::ios_base::beg)      base = 0;
+        else if (dir == std::ios_base::end) base = egptr() - eback();
+        if (off < -base || off > (egptr() - eback()) - base)
+        {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + base + off, egptr());
+        return pos_type(base + off);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+
+// Inflates compressed frames of a memory-mapped recording, reusing zlib's
+// state from one frame to the next.
+struct ContinuousInflater
+{
+    ContinuousInflater();
+    ~ContinuousInflater();
+
+    // Inflates <in_size> bytes at <in> into <out>, which is grown as
+    // required and then resized to the inflated size.
+    bool inflateFrame(const char* in, size_t in_size, std::vector<char>& out);
+
+    z_stream    zstream;
+};
+
+
+/* Layout of the signals data of each frame, as described by the signals node
+of a recording's header, which is written by FGFlightRecorder::getConfig(). */
+class ContinuousTapeSignals
+{
+public:
+    enum Type
+    {
+        Type_DOUBLE,
+        Type_FLOAT,
+        Type_INT,
+        Type_INT16,
+        Type_INT8,
+        Type_BOOL
+    };
+
+    struct Signal
+    {
+        std::string property;
+        std::string interpolation;
+        Type        type;
+        size_t      offset; // Byte offset in signals data.
+        uint8_t     bit;    // Bit within byte at <offset>, for Type_BOOL.
+    };
+
+    /* Reads layout from <signals>. Returns false if it has unknown signal
+    types or its recorder/record-size doesn't match the signals. */
+    bool init(const SGPropertyNode* signals);
+
+    const std::vector<Signal>& signals() const { return m_signals; }
+
+    /* Size of the signals of each frame. Frames written by
+    FGFlightRecorder::capture() have sizeof(double) more bytes of signals
+    data, which are unused. */
+    size_t size() const { return m_size; }
+
+    /* Returns value of signal <i> in signals data <data>, which must be
+    at least size() bytes. */
+    double value(const char* data, size_t i) const;
+
+private:
+    std::vector<Signal> m_signals;
+    size_t m_size = 0;
+};
+
+
+/* One frame of a Continuous recording read by ContinuousTapeReader. */
+struct ContinuousTapeFrame
+{
+    double  time = 0;
+    size_t  offset = 0;
+
+    // Data items of the frame, in the order of the header's data[] nodes. The
+    // pointers are valid until the next call of ContinuousTapeReader::next().
+    std::vector<std::pair<const char*, size_t>> items;
+};
+
+/* Parses the frame at offset <pos> of a memory-mapped recording [begin, end),
+which has <num_items> data items per frame, into <frame>. Compressed frames
+are inflated into <inflated>, creating <inflater> on first use; the item
+pointers then point into <inflated>.
+
+Index chunks give a frame with a NaN time and no items. Returns the offset of
+the next frame, or 0 if the frame is truncated or corrupt. This is the one
+parser of the frame layout, used both for replay and by fgtape-export. */
+size_t continuousParseFrame(
+        const char* begin,
+        const char* end,
+        size_t pos,
+        size_t num_items,
+        bool compression,
+        std::unique_ptr<ContinuousInflater>& inflater,
+        std::vector<char>& inflated,
+        ContinuousTapeFrame& frame
+        );
+
+/* Reads the frames of a local Continuous recording in order, from a memory
+map of the file. Compressed frames are inflated into a reused buffer, and
+index chunks are skipped. */
+class ContinuousTapeReader
+{
+public:
+    ContinuousTapeReader();
+    ~ContinuousTapeReader();
+
+    /* Maps <path> and reads its header. Returns as loadContinuousHeader(),
+    except that a recording that can't be mapped gives +1. */
+    int open(const SGPath& path);
+
+    /* The header properties. */
+    SGPropertyNode* config() const { return m_config; }
+
+    /* Index of <data_type> in each frame's items, or -1 if the recording
+    doesn't contain it. */
+    int dataIndex(const std::string& data_type) const;
+
+    /* Reads the next frame into <frame>. Returns false at the end of the
+    recording, or if the rest of it is truncated or corrupt, e.g. because
+    Flightgear exited while recording. */
+    bool next(ContinuousTapeFrame& frame);
+
+private:
+    std::unique_ptr<SGMMapFile> m_mapped;
+    SGPropertyNode_ptr m_config;
+    std::vector<std::string> m_data;
+    int m_compression = 0;
+    size_t m_pos = 0;
+    std::unique_ptr<ContinuousInflater> m_inflater;
+    std::vector<char> m_inflated;
+};
@@ -8,11 +8,16 @@
 #include <Viewer/viewmgr.hxx>
 
 #include <simgear/io/iostreams/zlibstream.hxx>
+#include <simgear/io/sg_mmap.hxx>
 #include <simgear/props/props_io.hxx>
 #include <simgear/structure/commands.hxx>
 
 #include <osgViewer/ViewerBase>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <assert.h>
 #include <string.h>
 
@@ -41,27 +46,6 @@ static void writeRaw(std::ostream& out, const T& data)
     out.write(reinterpret_cast<const char*>(&data), sizeof(data));
 }
 
-// Reads uncompressed vector<char> from file. Throws if length field is longer
-// than <max_length>.
-template<typename SizeType>
-static SizeType VectorRead(std::istream& in, std::vector<char>& out, uint32_t max_length=(1u << 31))
-{
-    SizeType    length;
-    readRaw(in, length);
-    if (sizeof(length) + length > max_length)
-    {
-        SG_LOG(SG_SYSTEMS, SG_ALERT, "recording data vector too long."
-                << " max_length=" << max_length
-                << " sizeof(length)=" << sizeof(length)
-                << " length=" << length
-                );
-        throw std::runtime_error("Failed to read vector in recording");
-    }
-    out.resize(length);
-    in.read(&out.front(), length);
-    return sizeof(length) + length;
-}
-
 static int16_t read_int16(std::istream& in, size_t& pos)
 {
     int16_t a;
@@ -125,9 +109,74 @@ static void ReadFGReplayDataExtraProperties(std::istream& in, FGReplayData* repl
     }
 }
 
+// Loads one data item of a frame, <length> bytes at <data>, into <ret> if it
+// is wanted. Returns false if the item is malformed.
+static bool ReadFGReplayDataItem(
+        const std::string& data_type,
+        const char* data,
+        size_t length,
+        bool load_signals,
+        bool load_multiplayer,
+        bool load_extra_properties,
+        FGReplayData* ret
+        )
+{
+    if (load_signals && data_type == "signals")
+    {
+        ret->raw_data.assign(data, data + length);
+    }
+    else if (load_multiplayer && data_type == "multiplayer")
+    {
+        /* Multiplayer information is a vector of vectors. */
+        ret->multiplayer_messages.clear();
+        const char* end = data + length;
+        while (data != end)
+        {
+            uint16_t    message_length;
+            if (end - data < (ptrdiff_t) sizeof(message_length))
+            {
+                SG_LOG(SG_SYSTEMS, SG_ALERT, "recording multiplayer data is truncated");
+                return false;
+            }
+            memcpy(&message_length, data, sizeof(message_length));
+            data += sizeof(message_length);
+            if (end - data < (ptrdiff_t) message_length)
+            {
+                SG_LOG(SG_SYSTEMS, SG_ALERT, "recording data vector too long."
+                        << " length=" << message_length
+                        << " remaining=" << (end - data)
+                        );
+                return false;
+            }
+            auto v = std::make_shared<std::vector<char>>(data, data + message_length);
+            ret->multiplayer_messages.push_back(v);
+            data += message_length;
+            SG_LOG(SG_SYSTEMS, SG_BULK, "replaying multiplayer data"
+                    << " ret->sim_time=" << ret->sim_time
+                    << " length=" << length
+                    << " callsign=" << ((T_MsgHdr*) &v->front())->Callsign
+                    );
+        }
+    }
+    else if (load_extra_properties && data_type == "extra-properties")
+    {
+        memory_streambuf    buffer(data, data + length);
+        std::istream        in(&buffer);
+        ReadFGReplayDataExtraProperties(in, ret, length);
+        if (!in) return false;
+    }
+    else
+    {
+        SG_LOG(SG_GENERAL, SG_BULK, "Skipping unrecognised/unwanted data: " << data_type);
+    }
+    return true;
+}
+
+// Reads the data items of a frame from a stream, for recordings that are not
+// memory-mapped.
 static bool ReadFGReplayData2(
         std::istream& in,
-        SGPropertyNode* config,
+        const std::vector<std::string>& data_types,
         bool load_signals,
         bool load_multiplayer,
         bool load_extra_properties,
@@ -135,49 +184,33 @@ static bool ReadFGReplayData2(
         )
 {
     ret->raw_data.resize(0);
-    for (auto data: config->getChildren("data"))
+    std::vector<char>   item;
+    for (const std::string& data_type: data_types)
     {
-        std::string data_type = data->getStringValue();
         SG_LOG(SG_SYSTEMS, SG_BULK, "in.tellg()=" << in.tellg() << " data_type=" << data_type);
         uint32_t    length;
         readRaw(in, length);
         SG_LOG(SG_SYSTEMS, SG_DEBUG, "length=" << length);
         if (!in) break;
-        if (load_signals && data_type == "signals")
-        {
-            ret->raw_data.resize(length);
-            in.read(&ret->raw_data.front(), ret->raw_data.size());
-        }
-        else if (load_multiplayer && data_type == "multiplayer")
-        {
-            /* Multiplayer information is a vector of vectors. */
-            ret->multiplayer_messages.clear();
-            uint32_t pos = 0;
-            for(;;)
-            {
-                assert(pos <= length);
-                if (pos == length)  break;
-                std::shared_ptr<std::vector<char>>  v(new std::vector<char>);
-                ret->multiplayer_messages.push_back(v);
-                pos += VectorRead<uint16_t>(in, *ret->multiplayer_messages.back(), length - pos);
-                SG_LOG(SG_SYSTEMS, SG_BULK, "replaying multiplayer data"
-                        << " ret->sim_time=" << ret->sim_time
-                        << " length=" << length
-                        << " pos=" << pos
-                        << " callsign=" << ((T_MsgHdr*) &v->front())->Callsign
-                        );
-            }
-        }
-        else if (load_extra_properties && data_type == "extra-properties")
-        {
-            ReadFGReplayDataExtraProperties(in, ret, length);
-        }
-        else
+        const bool wanted = (load_signals && data_type == "signals")
+                || (load_multiplayer && data_type == "multiplayer")
+                || (load_extra_properties && data_type == "extra-properties");
+        if (!wanted)
         {
             SG_LOG(SG_GENERAL, SG_BULK, "Skipping unrecognised/unwanted data: " << data_type);
             in.seekg(length, std::ios_base::cur);
+            if (!in) break;
+            continue;
         }
+        item.resize(length);
+        in.read(item.data(), length);
         if (!in) break;
+        if (!ReadFGReplayDataItem(data_type, item.data(), length,
+                load_signals, load_multiplayer, load_extra_properties, ret))
+        {
+            in.setstate(std::ios_base::failbit);
+            break;
+        }
     }
     if (!in)
     {
@@ -187,125 +220,194 @@ static bool ReadFGReplayData2(
     return true;
 }
 
-/* Removes items more than <n> away from <it>. <n> can be -ve. */
-template<typename Container, typename Iterator>
-static void remove_far_away(Container& container, Iterator it, int n)
+Continuous::~Continuous()
+{
+}
+
+void continuousReadStart(Continuous& continuous, const SGPath& path, bool map)
 {
-    SG_LOG(SG_GENERAL, SG_DEBUG, "container.size()=" << container.size());
-    if (n > 0)
+    continuousReadEnd(continuous);
+    
+    for (auto data: continuous.m_in_config->getChildren("data"))
+    {
+        continuous.m_in_data.push_back(data->getStringValue());
+    }
+    
+    if (map)
     {
-        for (int i=0; i<n; ++i)
+        std::unique_ptr<SGMMapFile> mapped(new SGMMapFile(path));
+        if (mapped->open(SG_IO_IN) && mapped->get())
         {
-            if (it == container.end())  return;
-            ++it;
+            SG_LOG(SG_SYSTEMS, SG_DEBUG, "Replaying from memory map of " << path);
+            continuous.m_in_mapped = std::move(mapped);
+        }
+        else
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Failed to memory map " << path << ", replaying with std::ifstream");
         }
-        container.erase(it, container.end());
     }
-    else
+}
+
+void continuousReadEnd(Continuous& continuous)
+{
+    continuous.m_in_mapped.reset();
+    continuous.m_in_data.clear();
+    for (auto& slot: continuous.m_in_frames)
     {
-        for (int i=0; i<-n-1; ++i)
+        slot = Continuous::FrameSlot();
+    }
+}
+
+// Reads frame at offset <pos> from continuous.m_in_mapped into <ret>.
+static bool ReadFGReplayDataMapped(
+        Continuous& continuous,
+        size_t pos,
+        bool load_signals,
+        bool load_multiplayer,
+        bool load_extra_properties,
+        FGReplayData* ret
+        )
+{
+    const char* begin = continuous.m_in_mapped->get();
+    const char* end = begin + continuous.m_in_mapped->get_size();
+    ContinuousTapeFrame& frame = continuous.m_in_frame;
+    if (!continuousParseFrame(begin, end, pos, continuous.m_in_data.size(), continuous.m_in_compression,
+            continuous.m_in_inflater, continuous.m_in_inflated, frame)
+            || std::isnan(frame.time))
+    {
+        return false;
+    }
+    ret->sim_time = frame.time;
+    for (size_t i = 0; i != frame.items.size(); ++i)
+    {
+        if (!ReadFGReplayDataItem(continuous.m_in_data[i], frame.items[i].first, frame.items[i].second,
+                load_signals, load_multiplayer, load_extra_properties, ret))
         {
-            if (it == container.begin())    return;
-            --it;
+            return false;
         }
-        container.erase(container.begin(), it);
     }
-    SG_LOG(SG_GENERAL, SG_DEBUG, "container.size()=" << container.size());
+    return true;
 }
 
-/* Returns FGReplayData for frame at specified position in file. Uses
-continuous.m_in_pos_to_frame as a cache, and trims this cache using
-remove_far_away(). */
-static std::shared_ptr<FGReplayData> ReadFGReplayData(
+// Reads frame at offset <pos> from continuous.m_in into <ret>.
+static bool ReadFGReplayDataStream(
         Continuous& continuous,
-        std::ifstream& in,
         size_t pos,
-        SGPropertyNode* config,
         bool load_signals,
         bool load_multiplayer,
         bool load_extra_properties,
-        int in_compression
+        FGReplayData* ret
         )
 {
-    std::shared_ptr<FGReplayData>   ret;
-    auto it = continuous.m_in_pos_to_frame.find(pos);
+    /* We need to clear any eof bit, otherwise seekg() will not work (which is
+    pretty unhelpful). E.g. see:
+        https://stackoverflow.com/questions/16364301/whats-wrong-with-the-ifstream-seekg
+    */
+    std::ifstream& in = continuous.m_in;
+    in.clear();
+    in.seekg(pos);
     
-    if (it != continuous.m_in_pos_to_frame.end())
+    readRaw(in, ret->sim_time);
+    if (!in)
     {
-        if (0
-            || (load_signals && !it->second->load_signals)
-            || (load_multiplayer && !it->second->load_multiplayer)
-            || (load_extra_properties && !it->second->load_extra_properties)
-            )
-        {
-            /* This frame is in the continuous.m_in_pos_to_frame cache, but
-            doesn't contain all of the required items, so we need to reload. */
-            continuous.m_in_pos_to_frame.erase(it);
-            it = continuous.m_in_pos_to_frame.end();
-        }
+        return false;
     }
-    if (it == continuous.m_in_pos_to_frame.end())
+    if (continuous.m_in_compression)
     {
-        /* Load FGReplayData at offset <pos>.
-
-        We need to clear any eof bit, otherwise seekg() will not work (which is
-        pretty unhelpful). E.g. see:
-            https://stackoverflow.com/questions/16364301/whats-wrong-with-the-ifstream-seekg
-        */
-        SG_LOG(SG_SYSTEMS, SG_BULK, "reading frame. pos=" << pos);
-        in.clear();
-        in.seekg(pos);
-
-        ret.reset(new FGReplayData);
+        uint8_t     flags;
+        uint32_t    compressed_size;
+        in.read((char*) &flags, sizeof(flags));
+        in.read((char*) &compressed_size, sizeof(compressed_size));
+        simgear::ZlibDecompressorIStream    in_decompress(in, SGPath(), simgear::ZLibCompressionFormat::ZLIB_RAW);
+        return ReadFGReplayData2(in_decompress, continuous.m_in_data, load_signals, load_multiplayer, load_extra_properties, ret);
+    }
+    return ReadFGReplayData2(in, continuous.m_in_data, load_signals, load_multiplayer, load_extra_properties, ret);
+}
 
-        readRaw(in, ret->sim_time);
-        if (!in)
-        {
-            SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to read fgtape frame at offset " << pos);
-            return nullptr;
-        }
-        bool ok;
-        if (in_compression)
+/* Returns FGReplayData for frame at specified position in file, or null if
+we fail to read it. Uses continuous.m_in_frames as a cache. */
+static std::shared_ptr<FGReplayData> ReadFGReplayData(
+        Continuous& continuous,
+        size_t pos,
+        bool load_signals,
+        bool load_multiplayer,
+        bool load_extra_properties
+        )
+{
+    Continuous::FrameSlot* slot = nullptr;
+    for (auto& s: continuous.m_in_frames)
+    {
+        if (s.frame && s.offset == pos)
         {
-            uint8_t     flags;
-            uint32_t    compressed_size;
-            in.read((char*) &flags, sizeof(flags));
-            in.read((char*) &compressed_size, sizeof(compressed_size));
-            simgear::ZlibDecompressorIStream    in_decompress(in, SGPath(), simgear::ZLibCompressionFormat::ZLIB_RAW);
-            ok = ReadFGReplayData2(in_decompress, config, load_signals, load_multiplayer, load_extra_properties, ret.get());
+            slot = &s;
+            break;
         }
-        else
+    }
+    if (slot)
+    {
+        slot->last_used = ++continuous.m_in_frames_clock;
+        const FGReplayData& frame = *slot->frame;
+        if (1
+            && (!load_signals || frame.load_signals)
+            && (!load_multiplayer || frame.load_multiplayer)
+            && (!load_extra_properties || frame.load_extra_properties)
+            )
         {
-            ok = ReadFGReplayData2(in, config, load_signals, load_multiplayer, load_extra_properties, ret.get());
+            return slot->frame;
         }
-        if (!ok)
+        /* This frame is in the cache, but doesn't contain all of the required
+        items, so we need to reload. We load the items it already has as
+        well, in case they are needed again. */
+        load_signals |= frame.load_signals;
+        load_multiplayer |= frame.load_multiplayer;
+        load_extra_properties |= frame.load_extra_properties;
+    }
+    else
+    {
+        slot = &continuous.m_in_frames[0];
+        for (auto& s: continuous.m_in_frames)
         {
-            SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to read fgtape frame at offset " << pos);
-            return nullptr;
+            if (s.last_used < slot->last_used)  slot = &s;
         }
-        it = continuous.m_in_pos_to_frame.lower_bound(pos);
-        it = continuous.m_in_pos_to_frame.insert(it, std::make_pair(pos, ret));
-        
-        /* Delete faraway items. */
-        size_t size_old = continuous.m_in_pos_to_frame.size();
-        int n = 2;
-        size_t size_max = 2*n - 1;
-        remove_far_away(continuous.m_in_pos_to_frame, it, n);
-        remove_far_away(continuous.m_in_pos_to_frame, it, -n);
-        size_t size_new = continuous.m_in_pos_to_frame.size();
-        SG_LOG(SG_GENERAL, SG_DEBUG, ""
-                << " n=" << size_old
-                << " size_max=" << size_max
-                << " size_old=" << size_old
-                << " size_new=" << size_new
-                );
-        assert(size_new <= size_max);
+        slot->last_used = ++continuous.m_in_frames_clock;
+    }
+    
+    // Reuse the slot's FGReplayData unless our caller still has it.
+    if (!slot->frame || slot->frame.use_count() > 1)
+    {
+        slot->frame = std::make_shared<FGReplayData>();
+    }
+    FGReplayData* ret = slot->frame.get();
+    ret->raw_data.clear();
+    ret->multiplayer_messages.clear();
+    ret->replay_extra_property_changes.clear();
+    ret->replay_extra_property_removals.clear();
+    ret->load_signals = false;
+    ret->load_multiplayer = false;
+    ret->load_extra_properties = false;
+    slot->offset = pos;
+    
+    SG_LOG(SG_SYSTEMS, SG_BULK, "reading frame. pos=" << pos);
+    bool ok;
+    if (continuous.m_in_mapped)
+    {
+        ok = ReadFGReplayDataMapped(continuous, pos, load_signals, load_multiplayer, load_extra_properties, ret);
     }
     else
     {
-        ret = it->second;
+        ok = ReadFGReplayDataStream(continuous, pos, load_signals, load_multiplayer, load_extra_properties, ret);
     }
-    return ret;
+    if (!ok)
+    {
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to read fgtape frame at offset " << pos);
+        // Offset zero is the header, so won't match any frame.
+        slot->offset = 0;
+        return nullptr;
+    }
+    ret->load_signals = load_signals;
+    ret->load_multiplayer = load_multiplayer;
+    ret->load_extra_properties = load_extra_properties;
+    return slot->frame;
 }
 
 
@@ -481,11 +583,11 @@ static void writeFrame2(FGReplayData* r, std::ostream& out, SGPropertyNode_ptr c
 }
 
 bool continuousWriteFrame(
-        Continuous& continuous,
         FGReplayData* r,
         std::ostream& out,
         SGPropertyNode_ptr config,
-        FGTapeType tape_type
+        FGTapeType tape_type,
+        FGFrameInfo* frame_info
         )
 {
     SG_LOG(SG_SYSTEMS, SG_BULK, "writing frame."
@@ -530,9 +632,17 @@ bool continuousWriteFrame(
         return true;
     }
     
+    if (frame_info)
+    {
+        frame_info->offset = out.tellp();
+        frame_info->has_signals = has_signals;
+        frame_info->has_multiplayer = has_multiplayer;
+        frame_info->has_extra_properties = has_extra_properties;
+    }
+    
     writeRaw(out, r->sim_time);
     
-    if (tape_type == FGTapeType_CONTINUOUS && continuous.m_out_compression)
+    if (tape_type == FGTapeType_CONTINUOUS && config->getIntValue("meta/continuous-compression"))
     {
         uint8_t flags = 0;
         if (has_signals)            flags |= 1;
@@ -560,6 +670,250 @@ bool continuousWriteFrame(
     return ok;
 }
 
+/* Index chunks are written between frames, starting with a NaN where a frame
+would have its time:
+
+    <NaN:double><length:32><previous:64><count:32>
+    <count * <time:double><offset:64><flags:8>>
+    <offset:64>"FGTAPEIX"
+
+<length> counts the bytes after itself. <previous> is the offset of the
+previous chunk or zero, <flags> are as for compressed frames, and the final
+<offset> is the chunk's own offset, so a recording that was stopped cleanly
+ends with the offset of its last chunk. */
+static const char s_index_magic[8] = {'F', 'G', 'T', 'A', 'P', 'E', 'I', 'X'};
+static const size_t s_index_entry_size = sizeof(double) + sizeof(uint64_t) + sizeof(uint8_t);
+static const size_t s_index_trailer_size = sizeof(uint64_t) + sizeof(s_index_magic);
+
+ContinuousWriter::~ContinuousWriter()
+{
+    stop();
+    for (auto r: m_spare)
+    {
+        delete r;
+    }
+}
+
+void ContinuousWriter::start(std::ostream& out, SGPropertyNode_ptr config)
+{
+    assert(!running());
+    m_out = &out;
+    m_config = config;
+    m_index = config->getBoolValue("meta/continuous-index");
+    m_queue_max = std::max(1, fgGetInt("/sim/replay/record-continuous-queue-frames", 256));
+    m_index_interval = std::max(1, fgGetInt("/sim/replay/record-continuous-index-frames", 1024));
+    m_index_entries.clear();
+    m_index_prev = 0;
+    m_ok = true;
+    m_stop = false;
+    m_thread = std::thread(&ContinuousWriter::run, this);
+}
+
+void ContinuousWriter::push(const FGReplayData* r)
+{
+    FGReplayData* copy = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (m_queue.size() >= m_queue_max)
+        {
+            SG_LOG(SG_SYSTEMS, SG_DEBUG, "Continuous recording writer is "
+                    << m_queue.size() << " frames behind, waiting");
+            m_cond.wait(lock, [this] { return m_queue.size() < m_queue_max; });
+        }
+        if (!m_spare.empty())
+        {
+            copy = m_spare.back();
+            m_spare.pop_back();
+        }
+    }
+    
+    // FGReplayData updates global statistics when constructed, so we only
+    // create them on the main thread.
+    if (!copy)  copy = new FGReplayData;
+    copy->sim_time = r->sim_time;
+    copy->raw_data = r->raw_data;
+    copy->multiplayer_messages = r->multiplayer_messages;
+    copy->extra_properties = r->extra_properties;
+    
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_queue.push_back(copy);
+    }
+    m_cond.notify_all();
+}
+
+bool ContinuousWriter::stop()
+{
+    if (!running())   return true;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    m_thread.join();
+    return m_ok;
+}
+
+void ContinuousWriter::run()
+{
+    for(;;)
+    {
+        FGReplayData* r;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_cond.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())    break;
+            r = m_queue.front();
+            m_queue.pop_front();
+        }
+        m_cond.notify_all();
+        
+        FGFrameInfo frame_info;
+        frame_info.offset = 0;
+        if (m_ok)
+        {
+            m_ok = continuousWriteFrame(r, *m_out, m_config, FGTapeType_CONTINUOUS, &frame_info);
+            if (!m_ok)
+            {
+                SG_LOG(SG_SYSTEMS, SG_ALERT, "Failed to write frame of continuous recording");
+            }
+        }
+        if (m_ok && m_index && frame_info.offset)
+        {
+            m_index_entries.emplace_back(r->sim_time, frame_info);
+            if (m_index_entries.size() >= m_index_interval)
+            {
+                writeIndexChunk();
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_spare.push_back(r);
+        }
+    }
+    
+    if (m_ok && m_index && !m_index_entries.empty())
+    {
+        writeIndexChunk();
+    }
+    m_out->flush();
+}
+
+void ContinuousWriter::writeIndexChunk()
+{
+    const uint64_t offset = m_out->tellp();
+    const uint32_t count = m_index_entries.size();
+    const uint32_t length = sizeof(uint64_t) + sizeof(count)
+            + count * s_index_entry_size + s_index_trailer_size;
+    
+    writeRaw(*m_out, std::numeric_limits<double>::quiet_NaN());
+    writeRaw(*m_out, length);
+    writeRaw(*m_out, m_index_prev);
+    writeRaw(*m_out, count);
+    for (auto& entry: m_index_entries)
+    {
+        uint8_t flags = 0;
+        if (entry.second.has_signals)           flags |= 1;
+        if (entry.second.has_multiplayer)       flags |= 2;
+        if (entry.second.has_extra_properties)  flags |= 4;
+        writeRaw(*m_out, entry.first);
+        writeRaw(*m_out, static_cast<uint64_t>(entry.second.offset));
+        writeRaw(*m_out, flags);
+    }
+    writeRaw(*m_out, offset);
+    m_out->write(s_index_magic, sizeof(s_index_magic));
+    
+    SG_LOG(SG_SYSTEMS, SG_DEBUG, "Wrote continuous recording index chunk."
+            << " offset=" << offset
+            << " count=" << count
+            );
+    m_index_prev = offset;
+    m_index_entries.clear();
+    if (!*m_out)    m_ok = false;
+}
+
+bool continuousReadIndex(std::istream& in, std::map<double, FGFrameInfo>& index)
+{
+    in.clear();
+    in.seekg(0, std::ios_base::end);
+    const uint64_t size = in.tellg();
+    if (!in || size < s_index_trailer_size)   return false;
+    
+    uint64_t last;
+    char magic[sizeof(s_index_magic)];
+    in.seekg(size - s_index_trailer_size);
+    readRaw(in, last);
+    in.read(magic, sizeof(magic));
+    if (!in || memcmp(magic, s_index_magic, sizeof(magic)) || last >= size)
+    {
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Continuous recording has no trailing index");
+        return false;
+    }
+    
+    // Follow the chain of chunks back to the first one.
+    std::vector<uint64_t> chunks;
+    for (uint64_t offset = last; offset; )
+    {
+        double marker;
+        uint32_t length;
+        uint64_t previous;
+        in.seekg(offset);
+        readRaw(in, marker);
+        readRaw(in, length);
+        readRaw(in, previous);
+        if (!in || !std::isnan(marker) || previous >= offset
+                || (offset == last && offset + sizeof(marker) + sizeof(length) + length != size))
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Continuous recording has invalid index chunk at offset " << offset);
+            return false;
+        }
+        chunks.push_back(offset);
+        offset = previous;
+    }
+    
+    std::map<double, FGFrameInfo> ret;
+    std::vector<char> entries;
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it)
+    {
+        uint32_t count;
+        in.seekg(*it + sizeof(double) + sizeof(uint32_t) + sizeof(uint64_t));
+        readRaw(in, count);
+        entries.resize(count * s_index_entry_size);
+        in.read(entries.data(), entries.size());
+        if (!in)
+        {
+            SG_LOG(SG_SYSTEMS, SG_ALERT, "Failed to read index chunk of continuous recording at offset " << *it);
+            return false;
+        }
+        
+        for (const char* p = entries.data(); p != entries.data() + entries.size(); p += s_index_entry_size)
+        {
+            double      time;
+            uint64_t    offset;
+            uint8_t     flags;
+            memcpy(&time, p, sizeof(time));
+            memcpy(&offset, p + sizeof(time), sizeof(offset));
+            memcpy(&flags, p + sizeof(time) + sizeof(offset), sizeof(flags));
+            
+            FGFrameInfo frame_info;
+            frame_info.offset = offset;
+            frame_info.has_signals = flags & 1;
+            frame_info.has_multiplayer = flags & 2;
+            frame_info.has_extra_properties = flags & 4;
+            // Entries are in time order, so this is amortised constant time.
+            ret.emplace_hint(ret.end(), time, frame_info);
+        }
+    }
+    
+    SG_LOG(SG_SYSTEMS, SG_DEBUG, "Read continuous recording index."
+            << " num_chunks=" << chunks.size()
+            << " num_frames=" << ret.size()
+            );
+    index.swap(ret);
+    return true;
+}
+
 SGPropertyNode_ptr continuousWriteHeader(
         Continuous&         continuous,
         FGFlightRecorder*   flight_recorder,
@@ -620,13 +974,10 @@ static bool replayContinuousInternal(
 {
     std::shared_ptr<FGReplayData> replay_data = ReadFGReplayData(
             continuous,
-            continuous.m_in,
             offset,
-            continuous.m_in_config,
             replay_signals,
             replay_multiplayer,
-            replay_extra_properties,
-            continuous.m_in_compression
+            replay_extra_properties
             );
     if (!replay_data)
     {
@@ -639,13 +990,10 @@ static bool replayContinuousInternal(
     {
         replay_data_old = ReadFGReplayData(
                 continuous,
-                continuous.m_in,
                 offset_old,
-                continuous.m_in_config,
                 replay_signals,
                 replay_multiplayer,
-                replay_extra_properties,
-                continuous.m_in_compression
+                replay_extra_properties
                 );
     }
     if (replay_extra_properties) SG_LOG(SG_SYSTEMS, SG_DEBUG,
@@ -938,6 +1286,7 @@ void Continuous::valueChanged(SGPropertyNode * node)
     {
         // Stop existing continuous recording.
         SG_LOG(SG_SYSTEMS, SG_ALERT, "Stopping continuous recording");
+        m_writer.stop();
         m_out.close();
         popupTip("Continuous record to file stopped", 5 /*delay*/);
     }
@@ -962,6 +1311,7 @@ void Continuous::valueChanged(SGPropertyNode * node)
         }
         
         SG_LOG(SG_SYSTEMS, SG_ALERT, "Starting continuous recording");
+        m_writer.start(m_out, m_out_config);
         
         /* Make a convenience link to the recording. E.g.
         harrier-gr3-continuous.fgtape -> harrier-gr3-20201224-005034-continuous.fgtape.
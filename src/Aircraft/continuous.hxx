@@ -1,16 +1,71 @@
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <mutex>
 #include <thread>
 
 #include <simgear/props/props.hxx>
 
+#include "continuous-reader.hxx"
 #include "replay-internal.hxx"
 
+/* Compresses and writes the frames of a Continuous recording on a background
+thread, so that the main loop only has to copy each frame into a queue.
+
+If the recording's header has meta/continuous-index set, an index chunk
+listing the time, offset and contents of each frame written since the
+previous chunk is appended every /sim/replay/record-continuous-index-frames
+frames, and when the writer is stopped. See continuousReadIndex(). */
+class ContinuousWriter
+{
+public:
+    ~ContinuousWriter();
+
+    /* Starts writing frames to <out>, which must already contain the header
+    written by continuousWriteHeader() with <config>. */
+    void start(std::ostream& out, SGPropertyNode_ptr config);
+
+    /* Queues a copy of <r> for writing. If the writer has fallen behind by
+    /sim/replay/record-continuous-queue-frames frames, waits rather than
+    losing frames. */
+    void push(const FGReplayData* r);
+
+    /* Writes all queued frames and the final index chunk, and stops the
+    thread. Returns false if writing any frame failed. */
+    bool stop();
+
+    bool running() const { return m_thread.joinable(); }
+
+private:
+    void run();
+    void writeIndexChunk();
+
+    std::ostream* m_out = nullptr;
+    SGPropertyNode_ptr m_config;
+    bool m_index = false;
+    size_t m_queue_max = 0;
+    size_t m_index_interval = 0;
+
+    std::thread m_thread;
+    std::mutex m_lock;
+    std::condition_variable m_cond; // m_queue has changed or m_stop is set
+    std::deque<FGReplayData*> m_queue;
+    std::vector<FGReplayData*> m_spare;
+    bool m_stop = false;
+
+    // Only used by the writer thread.
+    std::vector<std::pair<double, FGFrameInfo>> m_index_entries;
+    uint64_t m_index_prev = 0;
+    bool m_ok = true;
+};
+
 
 struct Continuous : SGPropertyChangeListener {
     explicit Continuous(std::shared_ptr<FGFlightRecorder> flight_recorder);
+    ~Continuous();
 
     /* Callback for SGPropertyChangeListener. */
     void valueChanged(SGPropertyNode* node) override;
@@ -25,8 +80,30 @@ struct Continuous : SGPropertyChangeListener {
     SGPropertyNode_ptr m_in_config;
     double m_in_time_last = 0;
     double m_in_frame_time_last = 0;
-    std::map<size_t, std::shared_ptr<FGReplayData>>
-        m_in_pos_to_frame;
+
+    // Memory map of the recording being replayed. If set, frames are read
+    // from here instead of m_in.
+    std::unique_ptr<SGMMapFile> m_in_mapped;
+
+    // Values of m_in_config's data[] nodes.
+    std::vector<std::string> m_in_data;
+
+    // The most recently read frames. Their FGReplayData are reused once no
+    // longer referenced elsewhere, so scrubbing through a recording doesn't
+    // allocate except for multiplayer messages and extra properties.
+    struct FrameSlot {
+        size_t offset = 0;
+        uint64_t last_used = 0;
+        std::shared_ptr<FGReplayData> frame;
+    };
+    std::array<FrameSlot, 4> m_in_frames;
+    uint64_t m_in_frames_clock = 0;
+
+    // For decompressing frames read from m_in_mapped, and the data items of
+    // the last frame read from it.
+    std::unique_ptr<ContinuousInflater> m_in_inflater;
+    std::vector<char> m_in_inflated;
+    ContinuousTapeFrame m_in_frame;
 
     std::ifstream m_indexing_in;
     std::streampos m_indexing_pos;
@@ -46,23 +123,33 @@ struct Continuous : SGPropertyChangeListener {
     std::ofstream m_out;
     int m_out_compression = 0;
     int m_in_compression = 0;
-};
-
-/* Attempts to load Continuous recording header properties into
-<properties>. If in is null we use internal std::fstream, otherwise we use *in.
+    bool m_in_index = false;
 
-Returns 0 on success, +1 if we may succeed after further download, or -1 if
-recording is not a Continuous recording. */
-int loadContinuousHeader(const std::string& path, std::istream* in, SGPropertyNode* properties);
+    // Declared after m_out so that it is destroyed first.
+    ContinuousWriter m_writer;
+};
 
+/* Writes one frame of continuous record information. The frame is compressed
+if <tape_type> is FGTapeType_CONTINUOUS and <config> has
+meta/continuous-compression set.
 
-/* Writes one frame of continuous record information. */
+If frame_info is not null and the frame had any data to write, sets
+frame_info->offset to the frame's offset in <out> and the has_* flags to
+describe its contents. Frames without data aren't written, in which case
+frame_info is left unchanged. */
 bool continuousWriteFrame(
-    Continuous& continuous,
     FGReplayData* r,
     std::ostream& out,
     SGPropertyNode_ptr config,
-    FGTapeType tape_type);
+    FGTapeType tape_type,
+    FGFrameInfo* frame_info = nullptr);
+
+/* Reads the index chunks written by ContinuousWriter into <index>.
+
+Returns false, leaving <index> unchanged, if <in> doesn't end with a complete
+index chunk, e.g. because Flightgear exited without stopping the recording.
+The caller should then index the recording by reading through its frames. */
+bool continuousReadIndex(std::istream& in, std::map<double, FGFrameInfo>& index);
 
 /* Opens continuous recording file and writes header.
 
@@ -82,6 +169,16 @@ SGPropertyNode_ptr continuousWriteHeader(
     const SGPath& path,
     FGTapeType tape_type);
 
+/* Prepares to read frames of the Continuous recording at <path>, which has
+been opened in continuous.m_in and whose header is in continuous.m_in_config.
+If <map> is true we memory map the file, which must then not grow while it is
+replayed. */
+void continuousReadStart(Continuous& continuous, const SGPath& path, bool map);
+
+/* Releases the memory map and cached frames of the recording being
+replayed. */
+void continuousReadEnd(Continuous& continuous);
+
 /* Replays one frame from Continuous recording.
 
 Returns true on success, otherwise we failed to read from Continuous recording.
@@ -8,6 +8,7 @@
 #include "config.h"
 #endif
 
+#include <algorithm>
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
@@ -204,6 +205,7 @@ FGFlightRecorder::FGFlightRecorder(const char* pConfigName) : m_RecorderNode(fgG
                                                               m_RecordContinuous(fgGetNode("/sim/replay/record-continuous", true)),
                                                               m_RecordExtraProperties(fgGetNode("/sim/replay/record-extra-properties", true)),
                                                               m_LogRawSpeed(fgGetNode("/sim/replay/log-raw-speed", true)),
+                                                              m_ReplayState(fgGetNode("/sim/replay/replay-state", true)),
                                                               m_TotalRecordSize(0),
                                                               m_ConfigName(pConfigName),
                                                               m_usingDefaultConfig(false),
@@ -265,6 +267,14 @@ void FGFlightRecorder::reinit(SGPropertyNode_ptr ConfigNode)
         initSignalList("bool", m_CaptureBool, m_ConfigNode);
     }
 
+    initSignalTable(m_CaptureDouble, m_TableDouble);
+    initSignalTable(m_CaptureFloat, m_TableFloat);
+    initSignalTable(m_CaptureInteger, m_TableInteger);
+    initSignalTable(m_CaptureInt16, m_TableInt16);
+    initSignalTable(m_CaptureInt8, m_TableInt8);
+    initSignalTable(m_CaptureBool, m_TableBool);
+    m_ReplayValues.resize(std::max(m_CaptureDouble.size(), m_CaptureFloat.size()));
+
     // calculate size of a single record
     m_TotalRecordSize = sizeof(double) * 1 /* sim time */ +
                         sizeof(double) * m_CaptureDouble.size() +
@@ -281,6 +291,18 @@ void FGFlightRecorder::reinit(SGPropertyNode_ptr ConfigNode)
     s_record_extra_properties.reset(new RecordExtraProperties);
 }
 
+/** Build the flat table used by capture() and replay() for given signal list. */
+void FGFlightRecorder::initSignalTable(const TSignalList& SignalList, TSignalTable& Table)
+{
+    Table.Nodes.clear();
+    Table.NonLinear.clear();
+    for (unsigned int i = 0; i < SignalList.size(); i++) {
+        Table.Nodes.push_back(SignalList[i].Signal.get());
+        if (SignalList[i].Interpolation != linear)
+            Table.NonLinear.push_back(i);
+    }
+}
+
 /** Check if SignalList already contains the given property */
 bool FGFlightRecorder::haveProperty(FlightRecorder::TSignalList& SignalList, const SGPropertyNode* pProperty)
 {
@@ -460,7 +482,7 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
     //
     static std::vector<char> s_recent_raw_data;
 
-    int in_replay = fgGetInt("/sim/replay/replay-state");
+    int in_replay = m_ReplayState->getIntValue();
 
     ReplayData->sim_time = SimTime;
 
@@ -480,9 +502,10 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture doubles
             double* pDoubles = (double*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureDouble.size();
+            SGPropertyNode* const* pNodes = m_TableDouble.Nodes.data();
+            unsigned int SignalCount = m_TableDouble.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                pDoubles[i] = m_CaptureDouble[i].Signal->getDoubleValue();
+                pDoubles[i] = pNodes[i]->getDoubleValue();
             }
             Offset += SignalCount * sizeof(double);
         }
@@ -491,9 +514,10 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture floats
             float* pFloats = (float*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureFloat.size();
+            SGPropertyNode* const* pNodes = m_TableFloat.Nodes.data();
+            unsigned int SignalCount = m_TableFloat.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                pFloats[i] = m_CaptureFloat[i].Signal->getFloatValue();
+                pFloats[i] = pNodes[i]->getFloatValue();
             }
             Offset += SignalCount * sizeof(float);
         }
@@ -501,9 +525,10 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture integers (32bit aligned)
             int* pInt = (int*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInteger.size();
+            SGPropertyNode* const* pNodes = m_TableInteger.Nodes.data();
+            unsigned int SignalCount = m_TableInteger.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                pInt[i] = m_CaptureInteger[i].Signal->getIntValue();
+                pInt[i] = pNodes[i]->getIntValue();
             }
             Offset += SignalCount * sizeof(int);
         }
@@ -512,9 +537,10 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture 16bit short integers
             short int* pShortInt = (short int*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInt16.size();
+            SGPropertyNode* const* pNodes = m_TableInt16.Nodes.data();
+            unsigned int SignalCount = m_TableInt16.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                pShortInt[i] = (short int)m_CaptureInt16[i].Signal->getIntValue();
+                pShortInt[i] = (short int)pNodes[i]->getIntValue();
             }
             Offset += SignalCount * sizeof(short int);
         }
@@ -523,9 +549,10 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture 8bit chars
             signed char* pChar = (signed char*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInt8.size();
+            SGPropertyNode* const* pNodes = m_TableInt8.Nodes.data();
+            unsigned int SignalCount = m_TableInt8.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                pChar[i] = (signed char)m_CaptureInt8[i].Signal->getIntValue();
+                pChar[i] = (signed char)pNodes[i]->getIntValue();
             }
             Offset += SignalCount * sizeof(signed char);
         }
@@ -533,12 +560,13 @@ FGFlightRecorder::capture(double SimTime, FGReplayData* ReplayData)
         {
             // capture 1bit booleans (8bit aligned)
             unsigned char* pFlags = (unsigned char*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureBool.size();
+            SGPropertyNode* const* pNodes = m_TableBool.Nodes.data();
+            unsigned int SignalCount = m_TableBool.Nodes.size();
             int Size = (SignalCount + 7) / 8;
             Offset += Size;
             memset(pFlags, 0, Size);
             for (unsigned int i = 0; i < SignalCount; i++) {
-                if (m_CaptureBool[i].Signal->getBoolValue())
+                if (pNodes[i]->getBoolValue())
                     pFlags[i >> 3] |= 1 << (i & 7);
             }
         }
@@ -638,6 +666,28 @@ weighting(TInterpolation interpolation, double ratio, double v1, double v2)
     }
 }
 
+/** Interpolate all signals of one type into <pValues>.
+ * Linear interpolation of all signals is done first as a plain loop over
+ * contiguous arrays, which the compiler can vectorise. The few signals with
+ * other interpolation types are then fixed up with weighting(). Results are
+ * rounded to T, matching what replay() did when interpolating each signal
+ * separately. */
+template <typename T>
+static void
+interpolate(const TSignalTable& Table, const TSignalList& SignalList, double ratio,
+            const T* pLast, const T* pNext, double* pValues)
+{
+    unsigned int SignalCount = Table.Nodes.size();
+    for (unsigned int i = 0; i < SignalCount; i++) {
+        double v1 = pLast[i];
+        double v2 = pNext[i];
+        pValues[i] = static_cast<T>(v1 + ratio * (v2 - v1));
+    }
+    for (unsigned int i : Table.NonLinear) {
+        pValues[i] = static_cast<T>(weighting(SignalList[i].Interpolation, ratio, pLast[i], pNext[i]));
+    }
+}
+
 void FGFlightRecorder::resetExtraProperties()
 {
     SG_LOG(SG_SYSTEMS, SG_DEBUG, "Clearing m_RecordExtraPropertiesReference");
@@ -753,16 +803,20 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore doubles
             const double* pDoubles = (const double*)&pBuffer[Offset];
-            const double* pLastDoubles = (const double*)&pLastBuffer[Offset];
-            unsigned int SignalCount = m_CaptureDouble.size();
-
-            for (unsigned int i = 0; i < SignalCount; i++) {
-                double v = pDoubles[i];
-                if (pLastBuffer) {
-                    v = weighting(m_CaptureDouble[i].Interpolation, ratio,
-                                  pLastDoubles[i], v);
+            SGPropertyNode* const* pNodes = m_TableDouble.Nodes.data();
+            unsigned int SignalCount = m_TableDouble.Nodes.size();
+
+            if (pLastBuffer) {
+                const double* pLastDoubles = (const double*)&pLastBuffer[Offset];
+                double* pValues = m_ReplayValues.data();
+                interpolate(m_TableDouble, m_CaptureDouble, ratio, pLastDoubles, pDoubles, pValues);
+                for (unsigned int i = 0; i < SignalCount; i++) {
+                    pNodes[i]->setDoubleValue(pValues[i]);
+                }
+            } else {
+                for (unsigned int i = 0; i < SignalCount; i++) {
+                    pNodes[i]->setDoubleValue(pDoubles[i]);
                 }
-                m_CaptureDouble[i].Signal->setDoubleValue(v);
             }
 
             if (m_LogRawSpeed->getBoolValue() && _pNextBuffer && pLastBuffer) {
@@ -799,15 +853,19 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore floats
             const float* pFloats = (const float*)&pBuffer[Offset];
-            const float* pLastFloats = (const float*)&pLastBuffer[Offset];
-            unsigned int SignalCount = m_CaptureFloat.size();
-            for (unsigned int i = 0; i < SignalCount; i++) {
-                float v = pFloats[i];
-                if (pLastBuffer) {
-                    v = weighting(m_CaptureFloat[i].Interpolation, ratio,
-                                  pLastFloats[i], v);
+            SGPropertyNode* const* pNodes = m_TableFloat.Nodes.data();
+            unsigned int SignalCount = m_TableFloat.Nodes.size();
+            if (pLastBuffer) {
+                const float* pLastFloats = (const float*)&pLastBuffer[Offset];
+                double* pValues = m_ReplayValues.data();
+                interpolate(m_TableFloat, m_CaptureFloat, ratio, pLastFloats, pFloats, pValues);
+                for (unsigned int i = 0; i < SignalCount; i++) {
+                    pNodes[i]->setDoubleValue(pValues[i]); //setFloatValue
+                }
+            } else {
+                for (unsigned int i = 0; i < SignalCount; i++) {
+                    pNodes[i]->setDoubleValue(pFloats[i]); //setFloatValue
                 }
-                m_CaptureFloat[i].Signal->setDoubleValue(v); //setFloatValue
             }
             Offset += SignalCount * sizeof(float);
         }
@@ -815,9 +873,10 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore integers (32bit aligned)
             const int* pInt = (const int*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInteger.size();
+            SGPropertyNode* const* pNodes = m_TableInteger.Nodes.data();
+            unsigned int SignalCount = m_TableInteger.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                m_CaptureInteger[i].Signal->setIntValue(pInt[i]);
+                pNodes[i]->setIntValue(pInt[i]);
             }
             Offset += SignalCount * sizeof(int);
         }
@@ -826,9 +885,10 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore 16bit short integers
             const short int* pShortInt = (const short int*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInt16.size();
+            SGPropertyNode* const* pNodes = m_TableInt16.Nodes.data();
+            unsigned int SignalCount = m_TableInt16.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                m_CaptureInt16[i].Signal->setIntValue(pShortInt[i]);
+                pNodes[i]->setIntValue(pShortInt[i]);
             }
             Offset += SignalCount * sizeof(short int);
         }
@@ -837,9 +897,10 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore 8bit chars
             const signed char* pChar = (const signed char*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureInt8.size();
+            SGPropertyNode* const* pNodes = m_TableInt8.Nodes.data();
+            unsigned int SignalCount = m_TableInt8.Nodes.size();
             for (unsigned int i = 0; i < SignalCount; i++) {
-                m_CaptureInt8[i].Signal->setIntValue(pChar[i]);
+                pNodes[i]->setIntValue(pChar[i]);
             }
             Offset += SignalCount * sizeof(signed char);
         }
@@ -847,11 +908,12 @@ void FGFlightRecorder::replay(double SimTime, const FGReplayData* _pNextBuffer,
         {
             // restore 1bit booleans (8bit aligned)
             const unsigned char* pFlags = (const unsigned char*)&pBuffer[Offset];
-            unsigned int SignalCount = m_CaptureBool.size();
+            SGPropertyNode* const* pNodes = m_TableBool.Nodes.data();
+            unsigned int SignalCount = m_TableBool.Nodes.size();
             int Size = (SignalCount + 7) / 8;
             Offset += Size;
             for (unsigned int i = 0; i < SignalCount; i++) {
-                m_CaptureBool[i].Signal->setBoolValue(0 != (pFlags[i >> 3] & (1 << (i & 7))));
+                pNodes[i]->setBoolValue(0 != (pFlags[i >> 3] & (1 << (i & 7))));
             }
         }
     }
@@ -28,6 +28,14 @@ typedef struct
 
 typedef std::vector<TCapture> TSignalList;
 
+/* Flat copy of a TSignalList for the per-frame loops of capture() and
+ * replay(), so that they walk contiguous arrays of nodes. */
+typedef struct
+{
+    std::vector<SGPropertyNode*> Nodes; // kept alive by the TSignalList
+    std::vector<unsigned int> NonLinear; // indices of signals not interpolated linearly
+} TSignalTable;
+
 } // namespace FlightRecorder
 
 class FGFlightRecorder
@@ -63,6 +71,7 @@ private:
     bool haveProperty(const SGPropertyNode* pProperty);
 
     int getConfig(SGPropertyNode* root, const char* typeStr, const FlightRecorder::TSignalList& SignalList);
+    static void initSignalTable(const FlightRecorder::TSignalList& SignalList, FlightRecorder::TSignalTable& Table);
 
     SGPropertyNode_ptr m_RecorderNode;
     SGPropertyNode_ptr m_ConfigNode;
@@ -77,6 +86,7 @@ private:
     SGPropertyNode_ptr m_RecordExtraProperties;
 
     SGPropertyNode_ptr m_LogRawSpeed;
+    SGPropertyNode_ptr m_ReplayState;
 
     // This contains copy of all properties that we are recording, so that we
     // can send only differences.
@@ -90,6 +100,17 @@ private:
     FlightRecorder::TSignalList m_CaptureInt8;
     FlightRecorder::TSignalList m_CaptureBool;
 
+    FlightRecorder::TSignalTable m_TableDouble;
+    FlightRecorder::TSignalTable m_TableFloat;
+    FlightRecorder::TSignalTable m_TableInteger;
+    FlightRecorder::TSignalTable m_TableInt16;
+    FlightRecorder::TSignalTable m_TableInt8;
+    FlightRecorder::TSignalTable m_TableBool;
+
+    // Interpolated doubles or floats of the frame being replayed, sized by
+    // reinit() so that replay() doesn't allocate.
+    std::vector<double> m_ReplayValues;
+
     unsigned m_TotalRecordSize;
     std::string m_ConfigName;
     bool m_usingDefaultConfig;
@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
 
+#include <algorithm>
+#include <cmath>
 #include <float.h>
 #include <locale>
 #include <string.h>
@@ -26,8 +28,6 @@
 #include "replay.hxx"
 
 
-const char* const FlightRecorderFileMagic = "FlightGear Flight Recorder Tape";
-
 void FGReplayData::UpdateStats()
 {
     size_t bytes_raw_data_old = m_bytes_raw_data;
@@ -152,17 +152,6 @@ static void writeRaw(std::ostream& out, const T& data)
     out.write(reinterpret_cast<const char*>(&data), sizeof(data));
 }
 
-/* Read properties from stream into *node. */
-static int PropertiesRead(std::istream& in, SGPropertyNode* node)
-{
-    uint32_t buffer_len;
-    readRaw(in, buffer_len);
-    std::vector<char> buffer(buffer_len);
-    in.read(&buffer.front(), buffer.size());
-    readProperties(&buffer.front(), buffer.size() - 1, node);
-    return 0;
-}
-
 static void popupTip(const char* message, int delay)
 {
     SGPropertyNode_ptr args(new SGPropertyNode);
@@ -202,18 +191,9 @@ SGPath makeSavePath(FGTapeType type, SGPath* path_timeless)
 /* Clear all internal buffers. */
 static void clear(FGReplayInternal& self)
 {
-    while (!self.m_short_term.empty()) {
-        delete self.m_short_term.front();
-        self.m_short_term.pop_front();
-    }
-    while (!self.m_medium_term.empty()) {
-        delete self.m_medium_term.front();
-        self.m_medium_term.pop_front();
-    }
-    while (!self.m_long_term.empty()) {
-        delete self.m_long_term.front();
-        self.m_long_term.pop_front();
-    }
+    self.m_short_term.clear(self.m_recycler);
+    self.m_medium_term.clear(self.m_recycler);
+    self.m_long_term.clear(self.m_recycler);
     while (!self.m_recycler.empty()) {
         delete self.m_recycler.front();
         self.m_recycler.pop_front();
@@ -227,6 +207,7 @@ static void clear(FGReplayInternal& self)
 FGReplayInternal::~FGReplayInternal()
 {
     if (m_continuous->m_out.is_open()) {
+        m_continuous->m_writer.stop();
         m_continuous->m_out.close();
     }
     clear(*this);
@@ -277,9 +258,9 @@ static void loadMessages(FGReplayInternal& self)
 
 void fillRecycler(FGReplayInternal& self)
 {
-    // Create an estimated nr of required ReplayData objects
-    // 120 is an estimated maximum frame rate.
-    int estNrObjects = (int)(self.m_high_res_time * 120 + self.m_medium_res_time * self.m_medium_sample_rate + self.m_low_res_time * self.m_long_sample_rate);
+    // Only the most recent frames of each buffer are kept as ReplayData
+    // objects, older ones are compressed into blocks by FGReplayStore.
+    int estNrObjects = 3 * (FGReplayStore::s_block_frames + 1);
     for (int i = 0; i < estNrObjects; i++) {
         FGReplayData* r = new FGReplayData;
         if (r)
@@ -388,11 +369,11 @@ double get_start_time(FGReplayInternal& self)
     }
 
     if (!self.m_long_term.empty())
-        ret = self.m_long_term.front()->sim_time;
+        ret = self.m_long_term.sim_time(0);
     else if (!self.m_medium_term.empty())
-        ret = self.m_medium_term.front()->sim_time;
+        ret = self.m_medium_term.sim_time(0);
     else if (!self.m_short_term.empty())
-        ret = self.m_short_term.front()->sim_time;
+        ret = self.m_short_term.sim_time(0);
     else
         ret = 0.0;
     fgSetDouble("/sim/replay/start-time", ret);
@@ -415,7 +396,7 @@ double get_end_time(FGReplayInternal& self)
         // in the background.
         return ret;
     }
-    double ret = self.m_short_term.empty() ? 0 : self.m_short_term.back()->sim_time;
+    double ret = self.m_short_term.empty() ? 0 : self.m_short_term.sim_time(self.m_short_term.size() - 1);
     fgSetDouble("/sim/replay/end-time", ret);
     setTimeStr("/sim/replay/end-time-str", ret);
     return ret;
@@ -439,9 +420,8 @@ bool FGReplayInternal::start(bool new_tape)
     printTimeStr(StrBuffer, 30, EndTime, false);
     fgSetString("/sim/replay/end-time-str", StrBuffer);
 
-    unsigned long buffer_elements = m_short_term.size() + m_medium_term.size() + m_long_term.size();
-    fgSetDouble("/sim/replay/buffer-size-mbyte",
-                buffer_elements * m_flight_recorder->getRecordSize() / (1024 * 1024.0));
+    size_t buffer_bytes = m_short_term.bytes() + m_medium_term.bytes() + m_long_term.bytes();
+    fgSetDouble("/sim/replay/buffer-size-mbyte", buffer_bytes / (1024 * 1024.0));
     if (fgGetBool("/sim/freeze/master") || !m_replay_master->getIntValue()) {
         guiMessage("Replay active. 'Esc' to stop.");
     }
@@ -486,29 +466,30 @@ item's list.
 To be called before first item is discarded, so that we don't end up with large
 gaps in multiplayer information when replaying - this can cause multiplayer
 aircraft to spuriously disappear and reappear. */
-static void MoveFrontMultiplayerPackets(std::deque<FGReplayData*>& list)
+static void MoveFrontMultiplayerPackets(FGReplayStore& list)
 {
-    auto it = list.begin();
-    FGReplayData* a = *it;
-    ++it;
-    if (it == list.end()) {
+    if (list.size() < 2) {
+        return;
+    }
+    const FGReplayStore::MultiplayerMessages& a = list.multiplayer_messages(0);
+    if (a.empty()) {
         return;
     }
-    FGReplayData* b = *it;
+    FGReplayStore::MultiplayerMessages& b = list.multiplayer_messages(1);
 
     // Copy all multiplayer packets in <a> that are for multiplayer aircraft
     // that are not in <b>, into <b>'s multiplayer_messages.
     //
-    for (auto a_message : a->multiplayer_messages) {
+    for (auto a_message : a) {
         bool found = false;
-        for (auto b_message : b->multiplayer_messages) {
+        for (auto b_message : b) {
             if (CallsignsEqual(*a_message, *b_message)) {
                 found = true;
                 break;
             }
         }
         if (!found) {
-            b->multiplayer_messages.push_back(a_message);
+            b.push_back(a_message);
         }
     }
 }
@@ -517,7 +498,7 @@ static void MoveFrontMultiplayerPackets(std::deque<FGReplayData*>& list)
 /** Save raw replay data in a separate container */
 static bool saveRawReplayData(
     simgear::gzContainerWriter& output,
-    const std::deque<FGReplayData*>& replay_data,
+    const FGReplayStore& replay_data,
     size_t record_size,
     SGPropertyNode* meta)
 {
@@ -532,10 +513,9 @@ static bool saveRawReplayData(
     }
 
     // read the raw data (all records in the given list)
-    auto it = replay_data.begin();
     size_t check_count = 0;
-    while (it != replay_data.end() && !output.fail()) {
-        const FGReplayData* frame = *it++;
+    while (check_count < count && !output.fail()) {
+        const FGReplayData* frame = replay_data[check_count];
         assert(record_size == frame->raw_data.size());
         writeRaw(output, frame->sim_time);
         output.write(&frame->raw_data.front(), frame->raw_data.size());
@@ -599,6 +579,11 @@ SGPropertyNode_ptr saveSetup(
     meta->setStringValue("aircraft-version", fgGetString("/sim/aircraft-version", "(undefined)"));
     if (tape_type == FGTapeType_CONTINUOUS) {
         meta->setIntValue("continuous-compression", continuous_compression);
+        // Releases without index support misread index chunks as frames,
+        // so they are only written on request.
+        if (fgGetBool("/sim/replay/record-continuous-index", false)) {
+            meta->setIntValue("continuous-index", 1);
+        }
     }
     // add information on the tape's recording duration
     meta->setDoubleValue("tape-duration", duration);
@@ -680,7 +665,7 @@ static void replayNormal2(
 /** 
  * interpolate a specific time from a specific list
  */
-static void interpolate(FGReplayInternal& self, double time, const std::deque<FGReplayData*>& list)
+static void interpolate(FGReplayInternal& self, double time, const FGReplayStore& list)
 {
     // sanity checking
     if (list.empty()) {
@@ -690,29 +675,12 @@ static void interpolate(FGReplayInternal& self, double time, const std::deque<FG
         return;
     }
 
-    unsigned int last = list.size() - 1;
-    unsigned int first = 0;
-    unsigned int mid = (last + first) / 2;
-
-    bool done = false;
-    while (!done) {
-        // cout << "  " << first << " <=> " << last << endl;
-        if (last == first) {
-            done = true;
-        } else if (list[mid]->sim_time < time && list[mid + 1]->sim_time < time) {
-            // too low
-            first = mid;
-            mid = (last + first) / 2;
-        } else if (list[mid]->sim_time > time && list[mid + 1]->sim_time > time) {
-            // too high
-            last = mid;
-            mid = (last + first) / 2;
-        } else {
-            done = true;
-        }
-    }
+    // the first frame at or after <time>, found from the frame times alone,
+    // so only the two frames we interpolate between get decoded
+    size_t next = list.lower_bound(time);
+    next = std::min(std::max(next, size_t(1)), list.size() - 1);
 
-    replayNormal2(self, time, list[mid + 1], list[mid]);
+    replayNormal2(self, time, list[next], list[next - 1]);
 }
 
 bool replayNormal(FGReplayInternal& self, double time)
@@ -725,7 +693,7 @@ bool replayNormal(FGReplayInternal& self, double time)
         // pointing to the last frame at the time we started replaying.
         //
         double t1 = fgGetDouble("/sim/replay/end-time");
-        double t2 = self.m_short_term.front()->sim_time;
+        double t2 = self.m_short_term.sim_time(0);
         if (time > t1) {
             // replay the most recent frame
             replayNormal2(self, time, self.m_short_term.back());
@@ -734,23 +702,23 @@ bool replayNormal(FGReplayInternal& self, double time)
         } else if (time <= t1 && time >= t2) {
             interpolate(self, time, self.m_short_term);
         } else if (!self.m_medium_term.empty()) {
-            t1 = self.m_short_term.front()->sim_time;
-            t2 = self.m_medium_term.back()->sim_time;
+            t1 = self.m_short_term.sim_time(0);
+            t2 = self.m_medium_term.sim_time(self.m_medium_term.size() - 1);
             if (time <= t1 && time >= t2) {
                 replayNormal2(self, time, self.m_medium_term.back(), self.m_short_term.front());
             } else {
-                t1 = self.m_medium_term.back()->sim_time;
-                t2 = self.m_medium_term.front()->sim_time;
+                t1 = self.m_medium_term.sim_time(self.m_medium_term.size() - 1);
+                t2 = self.m_medium_term.sim_time(0);
                 if (time <= t1 && time >= t2) {
                     interpolate(self, time, self.m_medium_term);
                 } else if (!self.m_long_term.empty()) {
-                    t1 = self.m_medium_term.front()->sim_time;
-                    t2 = self.m_long_term.back()->sim_time;
+                    t1 = self.m_medium_term.sim_time(0);
+                    t2 = self.m_long_term.sim_time(self.m_long_term.size() - 1);
                     if (time <= t1 && time >= t2) {
                         replayNormal2(self, time, self.m_long_term.back(), self.m_medium_term.front());
                     } else {
-                        t1 = self.m_long_term.back()->sim_time;
-                        t2 = self.m_long_term.front()->sim_time;
+                        t1 = self.m_long_term.sim_time(self.m_long_term.size() - 1);
+                        t2 = self.m_long_term.sim_time(0);
                         if (time <= t1 && time >= t2) {
                             interpolate(self, time, self.m_long_term);
                         } else {
@@ -842,6 +810,7 @@ void FGReplayInternal::update(double dt)
             if (m_continuous->m_in.is_open()) {
                 SG_LOG(SG_SYSTEMS, SG_DEBUG, "Unloading continuous recording");
                 m_continuous->m_in.close();
+                continuousReadEnd(*m_continuous);
                 m_continuous->m_in_time_to_frameinfo.clear();
             }
             assert(m_continuous->m_in_time_to_frameinfo.empty());
@@ -979,22 +948,17 @@ void FGReplayInternal::update(double dt)
         return;
     }
 
-    // update the short term list
+    // update the short term list; <r> stays valid until the next frame
     assert(r->raw_data.size() != 0);
-    m_short_term.push_back(r);
-    FGReplayData* st_front = m_short_term.front();
+    m_short_term.push_back(r, m_recycler);
 
     m_record_normal_end->setDoubleValue(r->sim_time);
     if (m_record_normal_begin->getDoubleValue() == 0) {
         m_record_normal_begin->setDoubleValue(r->sim_time);
     }
 
-    if (!st_front) {
-        SG_LOG(SG_SYSTEMS, SG_ALERT, "ReplaySystem: Inconsistent data!");
-    }
-
-    if (m_continuous->m_out.is_open()) {
-        continuousWriteFrame(*m_continuous, r, m_continuous->m_out, m_continuous->m_out_config, FGTapeType_CONTINUOUS);
+    if (m_continuous->m_writer.running()) {
+        m_continuous->m_writer.push(r);
     }
 
     if (replay_state == 0) {
@@ -1037,7 +1001,7 @@ void FGReplayInternal::update(double dt)
                     path_temp,
                     FGTapeType_RECOVERY);
                 if (!config) ok = false;
-                if (ok) ok = continuousWriteFrame(*m_continuous, r, out, config, FGTapeType_RECOVERY);
+                if (ok) ok = continuousWriteFrame(r, out, config, FGTapeType_RECOVERY);
                 out.close();
                 if (ok) {
                     rename(path_temp.c_str(), path.c_str());
@@ -1049,49 +1013,39 @@ void FGReplayInternal::update(double dt)
         }
     }
 
-    if (m_sim_time - st_front->sim_time > m_high_res_time) {
-        while (!m_short_term.empty() && m_sim_time - st_front->sim_time > m_high_res_time) {
-            st_front = m_short_term.front();
+    // Frames leave the front of each list, which FGReplayStore decodes one
+    // block at a time, so thinning the lists out costs one decode per block.
+    if (m_sim_time - m_short_term.sim_time(0) > m_high_res_time) {
+        while (!m_short_term.empty() && m_sim_time - m_short_term.sim_time(0) > m_high_res_time) {
             MoveFrontMultiplayerPackets(m_short_term);
-            m_recycler.push_back(st_front);
-            m_short_term.pop_front();
+            m_recycler.push_back(m_short_term.pop_front(m_recycler));
         }
 
         // update the medium term list
         if (m_sim_time - m_last_mt_time > m_medium_sample_rate) {
             m_last_mt_time = m_sim_time;
             if (!m_short_term.empty()) {
-                st_front = m_short_term.front();
-                m_medium_term.push_back(st_front);
-                m_short_term.pop_front();
+                m_medium_term.push_back(m_short_term.pop_front(m_recycler), m_recycler);
             }
 
             if (!m_medium_term.empty()) {
-                FGReplayData* mt_front = m_medium_term.front();
-                if (m_sim_time - mt_front->sim_time > m_medium_res_time) {
-                    while (!m_medium_term.empty() && m_sim_time - mt_front->sim_time > m_medium_res_time) {
-                        mt_front = m_medium_term.front();
+                if (m_sim_time - m_medium_term.sim_time(0) > m_medium_res_time) {
+                    while (!m_medium_term.empty() && m_sim_time - m_medium_term.sim_time(0) > m_medium_res_time) {
                         MoveFrontMultiplayerPackets(m_medium_term);
-                        m_recycler.push_back(mt_front);
-                        m_medium_term.pop_front();
+                        m_recycler.push_back(m_medium_term.pop_front(m_recycler));
                     }
                     // update the long term list
                     if (m_sim_time - m_last_lt_time > m_long_sample_rate) {
                         m_last_lt_time = m_sim_time;
                         if (!m_medium_term.empty()) {
-                            mt_front = m_medium_term.front();
-                            m_long_term.push_back(mt_front);
-                            m_medium_term.pop_front();
+                            m_long_term.push_back(m_medium_term.pop_front(m_recycler), m_recycler);
                         }
 
                         if (!m_long_term.empty()) {
-                            FGReplayData* lt_front = m_long_term.front();
-                            if (m_sim_time - lt_front->sim_time > m_low_res_time) {
-                                while (!m_long_term.empty() && m_sim_time - lt_front->sim_time > m_low_res_time) {
-                                    lt_front = m_long_term.front();
+                            if (m_sim_time - m_long_term.sim_time(0) > m_low_res_time) {
+                                while (!m_long_term.empty() && m_sim_time - m_long_term.sim_time(0) > m_low_res_time) {
                                     MoveFrontMultiplayerPackets(m_long_term);
-                                    m_recycler.push_back(lt_front);
-                                    m_long_term.pop_front();
+                                    m_recycler.push_back(m_long_term.pop_front(m_recycler));
                                 }
                             }
                         }
@@ -1103,13 +1057,13 @@ void FGReplayInternal::update(double dt)
 
 #if 0
     cout << "short term size = " << m_short_term.size()
-         << "  time = " << m_sim_time - m_short_term.front().sim_time
+         << "  time = " << m_sim_time - m_short_term.sim_time(0)
          << endl;
     cout << "medium term size = " << m_medium_term.size()
-         << "  time = " << m_sim_time - m_medium_term.front().sim_time
+         << "  time = " << m_sim_time - m_medium_term.sim_time(0)
          << endl;
     cout << "long term size = " << m_long_term.size()
-         << "  time = " << m_sim_time - m_long_term.front().sim_time
+         << "  time = " << m_sim_time - m_long_term.sim_time(0)
          << endl;
 #endif
     //stamp("point_finished");
@@ -1120,7 +1074,8 @@ static bool
 loadRawReplayData(
     simgear::gzContainerReader& input,
     //FGFlightRecorder* pRecorder,
-    std::deque<FGReplayData*>& replay_data,
+    FGReplayStore& replay_data,
+    std::deque<FGReplayData*>& recycler,
     size_t record_size,
     bool multiplayer,
     bool multiplayer_legacy)
@@ -1145,11 +1100,18 @@ loadRawReplayData(
 
     size_t check_count = 0;
     for (check_count = 0; (check_count < count) && (!input.eof()); ++check_count) {
-        FGReplayData* buffer = new FGReplayData;
+        FGReplayData* buffer = nullptr;
+        if (recycler.empty()) {
+            buffer = new FGReplayData;
+        } else {
+            buffer = recycler.front();
+            recycler.pop_front();
+            buffer->multiplayer_messages.clear();
+        }
         readRaw(input, buffer->sim_time);
         buffer->raw_data.resize(record_size);
         input.read(&buffer->raw_data.front(), record_size);
-        replay_data.push_back(buffer);
+        replay_data.push_back(buffer, recycler);
 
         if (multiplayer) {
             if (multiplayer_legacy) {
@@ -1283,42 +1245,24 @@ bool FGReplayInternal::saveTape(const SGPropertyNode* extra)
 }
 
 
-int loadContinuousHeader(const std::string& path, std::istream* in, SGPropertyNode* properties)
+// Sets statistics and start/end time properties from the index of a
+// Continuous recording.
+//
+static void setContinuousStats(FGReplayInternal& self)
 {
-    std::ifstream in0;
-    if (!in) {
-        in0.open(path);
-        in = &in0;
-    }
-    if (!*in) {
-        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to open path=" << path);
-        return +1;
-    }
-    std::vector<char> buffer(strlen(FlightRecorderFileMagic) + 1);
-    in->read(&buffer.front(), buffer.size());
-    SG_LOG(SG_SYSTEMS, SG_DEBUG, "in->gcount()=" << in->gcount() << " buffer.size()=" << buffer.size());
-    if ((size_t)in->gcount() != buffer.size()) {
-        // Further download is needed.
-        return +1;
-    }
-    if (strcmp(&buffer.front(), FlightRecorderFileMagic)) {
-        SG_LOG(SG_SYSTEMS, SG_DEBUG, "fgtape prefix doesn't match FlightRecorderFileMagic in path: " << path);
-        return -1;
+    std::lock_guard<std::mutex> lock(self.m_continuous->m_in_time_to_frameinfo_lock);
+    fgSetInt("/sim/replay/continuous-stats-num-frames", self.m_continuous->m_in_time_to_frameinfo.size());
+    fgSetInt("/sim/replay/continuous-stats-num-frames-extra-properties", self.m_continuous->m_num_frames_extra_properties);
+    fgSetInt("/sim/replay/continuous-stats-num-frames-multiplayer", self.m_continuous->m_num_frames_multiplayer);
+    if (!self.m_continuous->m_in_time_to_frameinfo.empty()) {
+        double t_begin = self.m_continuous->m_in_time_to_frameinfo.begin()->first;
+        double t_end = self.m_continuous->m_in_time_to_frameinfo.rbegin()->first;
+        fgSetDouble("/sim/replay/start-time", t_begin);
+        fgSetDouble("/sim/replay/end-time", t_end);
+        setTimeStr("/sim/replay/start-time-str", t_begin);
+        setTimeStr("/sim/replay/end-time-str", t_end);
+        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Have set /sim/replay/end-time to " << fgGetDouble("/sim/replay/end-time"));
     }
-    bool ok = false;
-    try {
-        PropertiesRead(*in, properties);
-        ok = true;
-    } catch (std::exception& e) {
-        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Failed to read Config properties in: " << path << ": " << e.what());
-    }
-    if (!ok) {
-        // Failed to read properties, so indicate that further download is needed.
-        return +1;
-    }
-    SG_LOG(SG_SYSTEMS, SG_BULK, "properties is:\n"
-                                    << writePropertiesInline(properties, true /*write_all*/) << "\n");
-    return 0;
 }
 
 // Build up in-memory cache of simulator time to file offset, so we can handle
@@ -1355,6 +1299,18 @@ static void indexContinuousRecording(FGReplayInternal& self, const void* data, s
         SG_LOG(SG_SYSTEMS, SG_BULK, ""
                                         << " m_indexing_pos=" << self.m_continuous->m_indexing_pos << " m_indexing_in.tellg()=" << self.m_continuous->m_indexing_in.tellg() << " sim_time=" << sim_time);
 
+        if (self.m_continuous->m_in_index && std::isnan(sim_time)) {
+            // Skip index chunk written by ContinuousWriter.
+            uint32_t length;
+            readRaw(self.m_continuous->m_indexing_in, length);
+            self.m_continuous->m_indexing_in.seekg(length, std::ios_base::cur);
+            if (!self.m_continuous->m_indexing_in) {
+                break;
+            }
+            self.m_continuous->m_indexing_pos = self.m_continuous->m_indexing_in.tellg();
+            continue;
+        }
+
         FGFrameInfo frameinfo;
         frameinfo.offset = self.m_continuous->m_indexing_pos;
         if (self.m_continuous->m_in_compression) {
@@ -1455,19 +1411,7 @@ static void indexContinuousRecording(FGReplayInternal& self, const void* data, s
                                                   << " num_frames=" << stat.second.num_frames << " bytes=" << stat.second.bytes);
     }
 
-    std::lock_guard<std::mutex> lock(self.m_continuous->m_in_time_to_frameinfo_lock);
-    fgSetInt("/sim/replay/continuous-stats-num-frames", self.m_continuous->m_in_time_to_frameinfo.size());
-    fgSetInt("/sim/replay/continuous-stats-num-frames-extra-properties", self.m_continuous->m_num_frames_extra_properties);
-    fgSetInt("/sim/replay/continuous-stats-num-frames-multiplayer", self.m_continuous->m_num_frames_multiplayer);
-    if (!self.m_continuous->m_in_time_to_frameinfo.empty()) {
-        double t_begin = self.m_continuous->m_in_time_to_frameinfo.begin()->first;
-        double t_end = self.m_continuous->m_in_time_to_frameinfo.rbegin()->first;
-        fgSetDouble("/sim/replay/start-time", t_begin);
-        fgSetDouble("/sim/replay/end-time", t_end);
-        setTimeStr("/sim/replay/start-time-str", t_begin);
-        setTimeStr("/sim/replay/end-time-str", t_end);
-        SG_LOG(SG_SYSTEMS, SG_DEBUG, "Have set /sim/replay/end-time to " << fgGetDouble("/sim/replay/end-time"));
-    }
+    setContinuousStats(self);
     if (!numbytes) {
         SG_LOG(SG_SYSTEMS, SG_ALERT, "Continuous recording: indexing finished"
                                          << " m_in_time_to_frameinfo.size()=" << self.m_continuous->m_in_time_to_frameinfo.size());
@@ -1475,6 +1419,38 @@ static void indexContinuousRecording(FGReplayInternal& self, const void* data, s
     }
 }
 
+// Uses the index chunks at the end of a recording made with
+// meta/continuous-index instead of reading through all of its frames.
+//
+// Returns false if the recording has no usable index.
+//
+static bool loadContinuousIndex(FGReplayInternal& self)
+{
+    time_t t0 = time(NULL);
+    {
+        std::lock_guard<std::mutex> lock(self.m_continuous->m_in_time_to_frameinfo_lock);
+        if (!continuousReadIndex(self.m_continuous->m_indexing_in, self.m_continuous->m_in_time_to_frameinfo)) {
+            return false;
+        }
+        for (auto& it : self.m_continuous->m_in_time_to_frameinfo) {
+            if (it.second.has_multiplayer) {
+                ++self.m_continuous->m_num_frames_multiplayer;
+                self.m_continuous->m_in_multiplayer = true;
+            }
+            if (it.second.has_extra_properties) {
+                ++self.m_continuous->m_num_frames_extra_properties;
+                self.m_continuous->m_in_extra_properties = true;
+            }
+        }
+    }
+    SG_LOG(SG_SYSTEMS, SG_ALERT, "Continuous recording: loaded index"
+                                     << " time taken=" << (time(NULL) - t0) << "s."
+                                     << " m_in_time_to_frameinfo.size()=" << self.m_continuous->m_in_time_to_frameinfo.size());
+    setContinuousStats(self);
+    self.m_continuous->m_indexing_in.close();
+    return true;
+}
+
 
 bool loadTapeContinuous(
     FGReplayInternal& replay_internal,
@@ -1509,17 +1485,22 @@ bool loadTapeContinuous(
                                        ->getIntValue();
     continuous->m_replay_create_video = create_video;
     continuous->m_replay_fixed_dt = fixed_dt;
-    SG_LOG(SG_SYSTEMS, SG_DEBUG, "m_in_compression=" << continuous->m_in_compression);
+    continuous->m_in_index = continuous->m_in_config->getBoolValue("meta/continuous-index");
+    // A download is still growing, so can't be memory mapped.
+    continuousReadStart(*continuous, filename, !file_request);
+    SG_LOG(SG_SYSTEMS, SG_DEBUG, "m_in_compression=" << continuous->m_in_compression
+                                                     << " m_in_index=" << continuous->m_in_index);
     SG_LOG(SG_SYSTEMS, SG_DEBUG, "filerequest=" << file_request.get());
 
-    // Make an in-memory index of the recording.
+    // Make an in-memory index of the recording. A download isn't complete
+    // yet so can't use the index at the end of the file.
     if (file_request) {
         auto p_replay_internal = &replay_internal;
         file_request->setCallback(
             [p_replay_internal](const void* data, size_t numbytes) {
                 ::indexContinuousRecording(*p_replay_internal, data, numbytes);
             });
-    } else {
+    } else if (!continuous->m_in_index || !loadContinuousIndex(replay_internal)) {
         ::indexContinuousRecording(replay_internal, nullptr, 0);
     }
 
@@ -1731,9 +1712,9 @@ bool FGReplayInternal::loadTape(
                 }
             }
             SG_LOG(SG_SYSTEMS, SG_ALERT, "multiplayer=" << multiplayer);
-            if (ok) ok = loadRawReplayData(input, m_short_term, record_size, multiplayer, multiplayer_legacy);
-            if (ok) ok = loadRawReplayData(input, m_medium_term, record_size, multiplayer, multiplayer_legacy);
-            if (ok) ok = loadRawReplayData(input, m_long_term, record_size, multiplayer, multiplayer_legacy);
+            if (ok) ok = loadRawReplayData(input, m_short_term, m_recycler, record_size, multiplayer, multiplayer_legacy);
+            if (ok) ok = loadRawReplayData(input, m_medium_term, m_recycler, record_size, multiplayer, multiplayer_legacy);
+            if (ok) ok = loadRawReplayData(input, m_long_term, m_recycler, record_size, multiplayer, multiplayer_legacy);
 
             // restore replay messages
             if (ok) {
@@ -20,6 +20,8 @@
 
 #include <MultiPlayer/multiplaymgr.hxx>
 
+#include "replay-store.hxx"
+
 
 class FGFlightRecorder;
 
@@ -147,9 +149,9 @@ struct FGReplayInternal {
     int m_last_replay_state;
     bool m_was_finished_already{false};
 
-    std::deque<FGReplayData*> m_short_term;
-    std::deque<FGReplayData*> m_medium_term;
-    std::deque<FGReplayData*> m_long_term;
+    FGReplayStore m_short_term;
+    FGReplayStore m_medium_term;
+    FGReplayStore m_long_term;
     std::deque<FGReplayData*> m_recycler;
 
     std::vector<FGReplayMessages> m_replay_messages;
@@ -0,0 +1,366 @@
+/*
+ * SPDX-FileName: replay-store.cxx
+ * SPDX-FileComment: compressed in-memory storage of replay frames
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "replay-store.hxx"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "replay-internal.hxx"
+
+
+struct FGReplayStore::Block {
+    uint64_t serial = 0;
+    size_t first = 0;       // frames before this one have been popped
+    size_t record_size = 0; // largest raw_data in the block
+    std::vector<double> sim_times;
+    std::vector<uint32_t> sizes; // raw_data size of each frame
+    std::vector<MultiplayerMessages> multiplayer;
+    unsigned multiplayer_changes = 0;
+    std::vector<uint8_t> data; // zero-run encoded columns
+
+    size_t count() const { return sim_times.size(); }
+};
+
+struct FGReplayStore::DecodedBlock {
+    uint64_t serial = 0;
+    unsigned multiplayer_changes = 0;
+    std::vector<std::unique_ptr<FGReplayData>> frames;
+};
+
+
+static void putVarint(std::vector<uint8_t>& out, size_t v)
+{
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+static size_t getVarint(const uint8_t*& p)
+{
+    size_t v = 0;
+    for (int shift = 0;; shift += 7) {
+        const uint8_t b = *p++;
+        v |= static_cast<size_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            return v;
+        }
+    }
+}
+
+/* Appends <in> to <out> as a sequence of (number of zeros, number of
+literals, literals). Single zeros are left in literal runs, where they are
+cheaper than ending the run. */
+static void encodeZeroRuns(const std::vector<uint8_t>& in, std::vector<uint8_t>& out)
+{
+    const size_t n = in.size();
+    size_t i = 0;
+    while (i < n) {
+        size_t zeros = 0;
+        while (i + zeros < n && in[i + zeros] == 0) {
+            ++zeros;
+        }
+        i += zeros;
+
+        size_t literals = 0;
+        while (i + literals < n) {
+            const size_t j = i + literals;
+            if (in[j] == 0 && (j + 1 == n || in[j + 1] == 0)) {
+                break;
+            }
+            ++literals;
+        }
+
+        putVarint(out, zeros);
+        putVarint(out, literals);
+        out.insert(out.end(), in.begin() + i, in.begin() + i + literals);
+        i += literals;
+    }
+}
+
+static void decodeZeroRuns(const std::vector<uint8_t>& in, std::vector<uint8_t>& out)
+{
+    const uint8_t* p = in.data();
+    const uint8_t* end = p + in.size();
+    size_t i = 0;
+    while (p < end) {
+        const size_t zeros = getVarint(p);
+        // out.data() + i, not &out[i]: i reaches out.size() after a
+        // trailing run, where the other count is 0
+        assert(i + zeros <= out.size());
+        memset(out.data() + i, 0, zeros);
+        i += zeros;
+
+        const size_t literals = getVarint(p);
+        assert(i + literals <= out.size());
+        memcpy(out.data() + i, p, literals);
+        p += literals;
+        i += literals;
+    }
+    assert(i == out.size());
+}
+
+
+FGReplayStore::FGReplayStore()
+{
+}
+
+FGReplayStore::~FGReplayStore()
+{
+    for (auto frame : m_open) {
+        delete frame;
+    }
+}
+
+const FGReplayStore::Block& FGReplayStore::locate(size_t i, size_t& index) const
+{
+    assert(i < m_sealed);
+    const Block& front = *m_blocks.front();
+    const size_t front_count = front.count() - front.first;
+    if (i < front_count) {
+        index = front.first + i;
+        return front;
+    }
+
+    // all blocks but the front one are complete
+    i -= front_count;
+    index = i % s_block_frames;
+    return *m_blocks[1 + i / s_block_frames];
+}
+
+double FGReplayStore::sim_time(size_t i) const
+{
+    if (i < m_sealed) {
+        size_t index;
+        const Block& block = locate(i, index);
+        return block.sim_times[index];
+    }
+    return m_open[i - m_sealed]->sim_time;
+}
+
+const FGReplayData* FGReplayStore::operator[](size_t i) const
+{
+    if (i < m_sealed) {
+        size_t index;
+        const Block& block = locate(i, index);
+        return decode(block).frames[index].get();
+    }
+    return m_open[i - m_sealed];
+}
+
+size_t FGReplayStore::lower_bound(double time) const
+{
+    size_t first = 0;
+    size_t last = m_size;
+    while (first < last) {
+        const size_t mid = (first + last) / 2;
+        if (sim_time(mid) < time) {
+            first = mid + 1;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+FGReplayStore::MultiplayerMessages& FGReplayStore::multiplayer_messages(size_t i)
+{
+    if (i < m_sealed) {
+        size_t index;
+        Block& block = const_cast<Block&>(locate(i, index));
+        // decoded copies of the messages are refreshed on the next access
+        ++block.multiplayer_changes;
+        return block.multiplayer[index];
+    }
+    return m_open[i - m_sealed]->multiplayer_messages;
+}
+
+void FGReplayStore::push_back(FGReplayData* frame, std::deque<FGReplayData*>& recycler)
+{
+    m_open.push_back(frame);
+    ++m_size;
+    if (m_open.size() > s_block_frames) {
+        seal(recycler);
+    }
+}
+
+void FGReplayStore::seal(std::deque<FGReplayData*>& recycler)
+{
+    const size_t n = s_block_frames;
+    std::unique_ptr<Block> block(new Block);
+    block->serial = m_next_serial++;
+    block->sim_times.reserve(n);
+    block->sizes.reserve(n);
+    block->multiplayer.reserve(n);
+
+    size_t record_size = 0;
+    for (size_t k = 0; k < n; ++k) {
+        record_size = std::max(record_size, m_open[k]->raw_data.size());
+    }
+    block->record_size = record_size;
+
+    // byte j of frame k goes to m_columns[j * n + k], XOR-ed with byte j
+    // of frame k - 1
+    m_columns.assign(n * record_size, 0);
+    const uint8_t* prev = nullptr;
+    size_t prev_size = 0;
+    for (size_t k = 0; k < n; ++k) {
+        FGReplayData* frame = m_open[k];
+        const uint8_t* cur = reinterpret_cast<const uint8_t*>(frame->raw_data.data());
+        const size_t cur_size = frame->raw_data.size();
+        for (size_t j = 0; j < cur_size; ++j) {
+            m_columns[j * n + k] = cur[j] ^ (j < prev_size ? prev[j] : 0);
+        }
+        for (size_t j = cur_size; j < prev_size; ++j) {
+            m_columns[j * n + k] = prev[j];
+        }
+        prev = cur;
+        prev_size = cur_size;
+
+        block->sim_times.push_back(frame->sim_time);
+        block->sizes.push_back(static_cast<uint32_t>(cur_size));
+        block->multiplayer.push_back(std::move(frame->multiplayer_messages));
+    }
+
+    encodeZeroRuns(m_columns, block->data);
+    block->data.shrink_to_fit();
+
+    for (size_t k = 0; k < n; ++k) {
+        FGReplayData* frame = m_open.front();
+        m_open.pop_front();
+        frame->multiplayer_messages.clear();
+        frame->extra_properties.clear();
+        recycler.push_back(frame);
+    }
+
+    m_blocks.push_back(std::move(block));
+    m_sealed += n;
+}
+
+const FGReplayStore::DecodedBlock& FGReplayStore::decode(const Block& block) const
+{
+    for (size_t slot = 0; slot < 2; ++slot) {
+        if (m_decoded[slot] && m_decoded[slot]->serial == block.serial) {
+            DecodedBlock& decoded = *m_decoded[slot];
+            if (decoded.multiplayer_changes != block.multiplayer_changes) {
+                for (size_t k = 0; k < block.count(); ++k) {
+                    decoded.frames[k]->multiplayer_messages = block.multiplayer[k];
+                }
+                decoded.multiplayer_changes = block.multiplayer_changes;
+            }
+            m_decoded_recent = slot;
+            return decoded;
+        }
+    }
+
+    // replace the least recently used block
+    const size_t slot = 1 - m_decoded_recent;
+    if (!m_decoded[slot]) {
+        m_decoded[slot].reset(new DecodedBlock);
+    }
+    DecodedBlock& decoded = *m_decoded[slot];
+
+    const size_t n = block.count();
+    const size_t record_size = block.record_size;
+    m_columns.resize(n * record_size);
+    decodeZeroRuns(block.data, m_columns);
+
+    decoded.frames.resize(n);
+    char* rows[s_block_frames];
+    for (size_t k = 0; k < n; ++k) {
+        if (!decoded.frames[k]) {
+            decoded.frames[k].reset(new FGReplayData);
+        }
+        FGReplayData& frame = *decoded.frames[k];
+        frame.sim_time = block.sim_times[k];
+        frame.raw_data.resize(block.sizes[k]);
+        frame.multiplayer_messages = block.multiplayer[k];
+        rows[k] = frame.raw_data.data();
+    }
+
+    for (size_t j = 0; j < record_size; ++j) {
+        const uint8_t* column = &m_columns[j * n];
+        uint8_t value = 0;
+        for (size_t k = 0; k < n; ++k) {
+            value ^= column[k];
+            if (j < block.sizes[k]) {
+                rows[k][j] = static_cast<char>(value);
+            }
+        }
+    }
+
+    decoded.serial = block.serial;
+    decoded.multiplayer_changes = block.multiplayer_changes;
+    m_decoded_recent = slot;
+    return decoded;
+}
+
+FGReplayData* FGReplayStore::pop_front(std::deque<FGReplayData*>& recycler)
+{
+    assert(m_size > 0);
+    FGReplayData* ret;
+    if (m_sealed) {
+        Block& block = *m_blocks.front();
+        const FGReplayData* frame = decode(block).frames[block.first].get();
+
+        if (recycler.empty()) {
+            ret = new FGReplayData;
+        } else {
+            ret = recycler.front();
+            recycler.pop_front();
+        }
+        ret->sim_time = frame->sim_time;
+        ret->raw_data = frame->raw_data;
+        ret->multiplayer_messages = std::move(block.multiplayer[block.first]);
+        ret->extra_properties.clear();
+        ret->UpdateStats();
+
+        --m_sealed;
+        if (++block.first == block.count()) {
+            for (auto& decoded : m_decoded) {
+                if (decoded && decoded->serial == block.serial) {
+                    decoded->serial = 0;
+                }
+            }
+            m_blocks.pop_front();
+        }
+    } else {
+        ret = m_open.front();
+        m_open.pop_front();
+    }
+
+    --m_size;
+    return ret;
+}
+
+void FGReplayStore::clear(std::deque<FGReplayData*>& recycler)
+{
+    for (auto frame : m_open) {
+        recycler.push_back(frame);
+    }
+    m_open.clear();
+    m_blocks.clear();
+    for (auto& decoded : m_decoded) {
+        decoded.reset();
+    }
+    m_size = 0;
+    m_sealed = 0;
+}
+
+size_t FGReplayStore::bytes() const
+{
+    size_t ret = 0;
+    for (const auto& block : m_blocks) {
+        ret += block->data.size() + block->count() * sizeof(double);
+    }
+    for (auto frame : m_open) {
+        ret += frame->raw_data.size() + sizeof(double);
+    }
+    return ret;
+}
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileName: replay-store.hxx
+ * SPDX-FileComment: compressed in-memory storage of replay frames
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+
+struct FGReplayData;
+
+/* Stores one tier (short, medium or long term) of in-memory replay frames.
+
+Recent frames are kept as FGReplayData. Once there are more than
+s_block_frames of them, the oldest s_block_frames are sealed into a block,
+where raw_data is stored column by column - byte 0 of every frame, then
+byte 1 and so on - with each byte XOR-ed with the same byte of the previous
+frame. Signals that don't change, and the high bytes of slowly changing
+ones, become runs of zeros which are run-length encoded. Frame times and
+multiplayer messages are kept as they are.
+
+Sealed frames are decoded a block at a time when accessed, and the two most
+recently used blocks stay decoded, so stepping through frames in order or
+interpolating between neighbours decodes each block once. */
+class FGReplayStore
+{
+public:
+    typedef std::vector<std::shared_ptr<std::vector<char>>> MultiplayerMessages;
+
+    static const size_t s_block_frames = 64;
+
+    FGReplayStore();
+    ~FGReplayStore();
+
+    FGReplayStore(const FGReplayStore&) = delete;
+    FGReplayStore& operator=(const FGReplayStore&) = delete;
+
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    /* Time of frame <i>, without decoding it. */
+    double sim_time(size_t i) const;
+
+    /* Frame <i>. Pointers into sealed blocks stay valid until frames of two
+    other blocks have been accessed, or the store is modified. */
+    const FGReplayData* operator[](size_t i) const;
+    const FGReplayData* front() const { return (*this)[0]; }
+    const FGReplayData* back() const { return (*this)[m_size - 1]; }
+
+    /* Index of the first frame at or after <time>, or size() if there is
+    none. */
+    size_t lower_bound(double time) const;
+
+    /* Multiplayer messages of frame <i>, which may be modified. */
+    MultiplayerMessages& multiplayer_messages(size_t i);
+
+    /* Appends <frame>, taking ownership. The most recent frame is never
+    sealed, so <frame> remains valid until the next push_back(). Objects no
+    longer needed are moved to <recycler>. */
+    void push_back(FGReplayData* frame, std::deque<FGReplayData*>& recycler);
+
+    /* Removes the oldest frame and returns it, to be pushed into another
+    store or recycled by the caller. Frames of sealed blocks are decoded into
+    an object from <recycler> if there is one. */
+    FGReplayData* pop_front(std::deque<FGReplayData*>& recycler);
+
+    void clear(std::deque<FGReplayData*>& recycler);
+
+    /* Memory used by the frames' signals and times. */
+    size_t bytes() const;
+
+private:
+    struct Block;
+    struct DecodedBlock;
+
+    void seal(std::deque<FGReplayData*>& recycler);
+    const Block& locate(size_t i, size_t& index) const;
+    const DecodedBlock& decode(const Block& block) const;
+
+    std::deque<std::unique_ptr<Block>> m_blocks;
+    std::deque<FGReplayData*> m_open;
+    size_t m_size = 0;
+    size_t m_sealed = 0; // frames in m_blocks
+    uint64_t m_next_serial = 1;
+
+    mutable std::unique_ptr<DecodedBlock> m_decoded[2];
+    mutable size_t m_decoded_recent = 0;
+
+    // kept to avoid an allocation per block
+    mutable std::vector<uint8_t> m_columns;
+};
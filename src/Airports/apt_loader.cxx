@@ -10,7 +10,9 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <cstddef>  // std::size_t
 #include <ctype.h>  // isspace()
 #include <iostream>
@@ -18,6 +20,7 @@
 #include <stdlib.h> // atof(), atoi()
 #include <string.h> // memchr()
 #include <string>
+#include <thread>
 #include <utility>  // std::pair, std::move()
 #include <vector>
 
@@ -71,6 +74,101 @@ APTLoader::~APTLoader() {}
 void APTLoader::readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocation,
                                std::size_t bytesReadSoFar,
                                std::size_t totalSizeOfAllAptDatFiles)
+{
+    auto preloaded = preloadedFiles.find(sceneryLocation.datPath.utf8Str());
+    if (preloaded != preloadedFiles.end()) {
+        PreloadedAptDat fileData = std::move(preloaded->second);
+        preloadedFiles.erase(preloaded);
+
+        if (fileData.error) {
+            std::rethrow_exception(fileData.error);
+        }
+
+        mergeAirports(sceneryLocation.datPath, fileData.airports);
+        return;
+    }
+
+    AirportInfoMapType fileAirports;
+    scanAptDatFile(sceneryLocation, fileAirports, [&](std::size_t offset) {
+        unsigned int percent = ((bytesReadSoFar + offset) * 100) / totalSizeOfAllAptDatFiles;
+        cache->setRebuildPhaseProgress(
+            NavDataCache::REBUILD_READING_APT_DAT_FILES, percent);
+    });
+    mergeAirports(sceneryLocation.datPath, fileAirports);
+}
+
+void APTLoader::preloadAptDatFiles(const NavDataCache::SceneryLocationList& sceneryLocations,
+                                   std::size_t totalSizeOfAllAptDatFiles)
+{
+    const std::size_t numFiles = sceneryLocations.size();
+    std::vector<PreloadedAptDat> results(numFiles);
+
+    // Files are handed out in priority order: with a single large apt.dat
+    // and many small custom ones, the large one starts first.
+    std::atomic<std::size_t> nextFile{0};
+    std::atomic<std::size_t> filesDone{0};
+    std::atomic<std::size_t> bytesRead{0};
+
+    auto worker = [&]() {
+        for (std::size_t i = nextFile++; i < numFiles; i = nextFile++) {
+            std::size_t lastOffset = 0;
+            try {
+                scanAptDatFile(sceneryLocations[i], results[i].airports,
+                               [&](std::size_t offset) {
+                                   bytesRead += offset - lastOffset;
+                                   lastOffset = offset;
+                               });
+            } catch (...) {
+                results[i].error = std::current_exception();
+            }
+            ++filesDone;
+        }
+    };
+
+    const std::size_t numThreads = std::min<std::size_t>(
+        numFiles, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back(worker);
+    }
+
+    // progress is reported from this thread only
+    while (filesDone < numFiles) {
+        if (totalSizeOfAllAptDatFiles > 0) {
+            unsigned int percent = std::min<std::size_t>(
+                (bytesRead * 100) / totalSizeOfAllAptDatFiles, 100);
+            cache->setRebuildPhaseProgress(
+                NavDataCache::REBUILD_READING_APT_DAT_FILES, percent);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (std::size_t i = 0; i < numFiles; ++i) {
+        preloadedFiles[sceneryLocations[i].datPath.utf8Str()] = std::move(results[i]);
+    }
+}
+
+void APTLoader::mergeAirports(const SGPath& aptDat, AirportInfoMapType& fileAirports)
+{
+    for (auto& entry : fileAirports) {
+        auto it = airportInfoMap.find(entry.first);
+        if (it != airportInfoMap.end()) {
+            SG_LOG(SG_GENERAL, SG_INFO,
+                   aptDat << ":" << entry.second.firstLineNum << ": skipping airport " << entry.first << " (already defined earlier)");
+            continue;
+        }
+
+        airportInfoMap.emplace(entry.first, std::move(entry.second));
+    }
+}
+
+void APTLoader::scanAptDatFile(const NavDataCache::SceneryLocation& sceneryLocation,
+                               AirportInfoMapType& result,
+                               const std::function<void(std::size_t)>& progress)
 {
     const SGPath aptdb_file = sceneryLocation.datPath;
     string apt_dat = aptdb_file.utf8Str(); // full path to the file being parsed
@@ -88,15 +186,9 @@ void APTLoader::readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocat
 
     unsigned int rowCode = 0; // terminology used in the apt.dat format spec
     unsigned int line_num = 0;
-    // "airport identifier": terminology used in the apt.dat format spec. It is
-    // often an ICAO code, but not always.
-    string currentAirportId;
-    // Boolean used to make sure we don't try to load the same airport several
-    // times. Defaults to true only to ensure we don't add garbage to
-    // 'airportInfoMap' under the key "" (empty airport identifier) in case the
-    // apt.dat file doesn't have a start-of-airport row code (1, 16 or 17) after
-    // its header---which would be invalid, anyway.
-    bool skipAirport = true;
+    // Entry for the airport currently being read, or nullptr if its lines
+    // are to be skipped
+    RawAirportInfo* currentAirport = nullptr;
 
     // Read the apt.dat header (two lines)
     while (line_num < 2 && std::getline(in, line)) {
@@ -141,9 +233,7 @@ void APTLoader::readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocat
 
         if ((line_num % 100) == 0) {
             // every 100 lines
-            unsigned int percent = ((bytesReadSoFar + in.approxOffset()) * 100) / totalSizeOfAllAptDatFiles;
-            cache->setRebuildPhaseProgress(
-                NavDataCache::REBUILD_READING_APT_DAT_FILES, percent);
+            progress(in.approxOffset());
         }
 
         // Extract the first field into 'rowCode'
@@ -157,24 +247,28 @@ void APTLoader::readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocat
                 SG_LOG(SG_GENERAL, SG_WARN,
                        apt_dat << ":" << line_num << ": invalid airport header "
                                                      "(at least 6 fields are required)");
-                skipAirport = true; // discard everything until the next airport header
+                currentAirport = nullptr; // discard everything until the next airport header
                 continue;
             }
 
-            currentAirportId = tokens[4]; // often an ICAO, but not always
-            // Check if the airport is already in 'airportInfoMap'; get the
-            // existing entry, if any, otherwise insert a new one.
+            // "airport identifier": terminology used in the apt.dat format
+            // spec. It is often an ICAO code, but not always.
+            const string airportId = tokens[4];
+            // Check if the airport is already in this file; get the existing
+            // entry, if any, otherwise insert a new one. Airports defined by
+            // earlier files are dropped later, by mergeAirports().
             std::pair<AirportInfoMapType::iterator, bool>
-                insertRetval = airportInfoMap.insert(
-                    AirportInfoMapType::value_type(currentAirportId, RawAirportInfo()));
-            skipAirport = !insertRetval.second;
+                insertRetval = result.insert(
+                    AirportInfoMapType::value_type(airportId, RawAirportInfo()));
 
-            if (skipAirport) {
+            if (!insertRetval.second) {
                 SG_LOG(SG_GENERAL, SG_INFO,
-                       apt_dat << ":" << line_num << ": skipping airport " << currentAirportId << " (already defined earlier)");
+                       apt_dat << ":" << line_num << ": skipping airport " << airportId << " (already defined earlier)");
+                currentAirport = nullptr;
             } else {
-                // We haven't seen this airport yet in any apt.dat file
+                // We haven't seen this airport yet in this apt.dat file
                 RawAirportInfo& airportInfo = insertRetval.first->second;
+                currentAirport = &airportInfo;
                 airportInfo.file = aptdb_file;
                 airportInfo.sceneryPath = sceneryLocation.sceneryPath;
                 airportInfo.rowCode = rowCode;
@@ -185,11 +279,10 @@ void APTLoader::readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocat
             SG_LOG(SG_GENERAL, SG_DEBUG,
                    apt_dat << ":" << line_num << ": code 99 found "
                                                  "(normally at end of file)");
-        } else if (!skipAirport) {
+        } else if (currentAirport) {
             // Line belonging to an already started, and not skipped airport entry;
             // just append it.
-            airportInfoMap[currentAirportId].otherLines.emplace_back(
-                line_num, rowCode, line);
+            currentAirport->otherLines.emplace_back(line_num, rowCode, line);
         }
     } // of file reading loop
 
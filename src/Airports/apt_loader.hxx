@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +42,12 @@ public:
     void readAptDatFile(const NavDataCache::SceneryLocation& sceneryLocation,
                         std::size_t bytesReadSoFar,
                         std::size_t totalSizeOfAllAptDatFiles);
+    // Read the specified apt.dat files in parallel, on worker threads. The
+    // results are kept aside and merged into 'airportInfoMap' by the
+    // readAptDatFile() calls which follow, so the usual priority order of
+    // the scenery paths is preserved.
+    void preloadAptDatFiles(const NavDataCache::SceneryLocationList& sceneryLocations,
+                            std::size_t totalSizeOfAllAptDatFiles);
     // Read all airports gathered in 'airportInfoMap' and load them into the
     // navdata cache (even in case of overlapping apt.dat files,
     // 'airportInfoMap' has only one entry per airport).
@@ -78,6 +86,13 @@ private:
     };
 
     typedef std::unordered_map<std::string, RawAirportInfo> AirportInfoMapType;
+
+    // Airports read from one apt.dat file by preloadAptDatFiles()
+    struct PreloadedAptDat {
+        AirportInfoMapType airports;
+        // set if reading the file failed; rethrown by readAptDatFile()
+        std::exception_ptr error;
+    };
     typedef SGSharedPtr<FGPavement> FGPavementPtr;
     typedef std::vector<FGPavementPtr> NodeList;
 
@@ -86,6 +101,16 @@ private:
 
     const FGAirport* loadAirport(const SGPath& aptDat, const std::string& airportID, RawAirportInfo* airport_info, bool createFGAirport = false);
 
+    // Read one apt.dat file into 'result', without touching any other
+    // state, so this can run on a worker thread. 'progress' is called
+    // regularly with the (compressed) offset reached in the file.
+    void scanAptDatFile(const NavDataCache::SceneryLocation& sceneryLocation,
+                        AirportInfoMapType& result,
+                        const std::function<void(std::size_t)>& progress);
+    // Add the airports read from one apt.dat file to 'airportInfoMap',
+    // unless an earlier file already defined them
+    void mergeAirports(const SGPath& aptDat, AirportInfoMapType& fileAirports);
+
     // Tell whether an apt.dat line is blank or a comment line
     bool isBlankOrCommentLine(const std::string& line);
     // Return a copy of 'line' with trailing '\r' char(s) removed
@@ -118,6 +143,8 @@ private:
 
     std::vector<std::string> token;
     AirportInfoMapType airportInfoMap;
+    // keyed by the apt.dat path
+    std::unordered_map<std::string, PreloadedAptDat> preloadedFiles;
     double rwy_lat_accum{0.0};
     double rwy_lon_accum{0.0};
     double last_rwy_heading{0.0};
@@ -10,8 +10,10 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <map>
+#include <queue>
 
 #include <simgear/scene/util/OsgMath.hxx>
 #include <simgear/debug/logstream.hxx>
@@ -38,7 +40,8 @@ FGTaxiSegment::FGTaxiSegment(FGTaxiNode* aStart, FGTaxiNode* aEnd) : startNode(a
                                                                      endNode(aEnd),
                                                                      isActive(0),
                                                                      index(0),
-                                                                     oppositeDirection(0)
+                                                                     oppositeDirection(0),
+                                                                     network(0)
 {
     if (!aStart || !aEnd) {
         throw sg_exception("Missing node arguments creating FGTaxiSegment");
@@ -84,6 +87,9 @@ void FGTaxiSegment::block(int id, time_t blockTime, time_t now)
     if (i == blockTimes.end()) {
         blockTimes.push_back(Block(id, blockTime, now));
         sort(blockTimes.begin(), blockTimes.end());
+        if (network) {
+            network->segmentBlocksChanged();
+        }
     } else {
         i->updateTimeStamps(blockTime, now);
     }
@@ -107,6 +113,9 @@ void FGTaxiSegment::unblock(time_t now)
 
     if (blockTimes.front().getTimeStamp() < (now - 30)) {
         blockTimes.erase(blockTimes.begin());
+        if (network) {
+            network->segmentBlocksChanged();
+        }
     }
 }
 
@@ -180,6 +189,10 @@ void FGGroundNetwork::init()
     hasNetwork = true;
     int index = 1;
 
+    // lookup tables first: the segment pairing below uses findSegment()
+    buildRoutingGraph();
+    buildNodeGrid();
+
     // establish pairing of segments
     for (auto segment : segments) {
         segment->setIndex(index++);
@@ -202,73 +215,240 @@ void FGGroundNetwork::init()
     networkInitialized = true;
 }
 
-FGTaxiNodeRef FGGroundNetwork::findNearestNode(const SGGeod& aGeod) const
+static int edgePenalty(FGTaxiNode* tn)
 {
-    double d = DBL_MAX;
-    SGVec3d cartPos = SGVec3d::fromGeod(aGeod);
-    FGTaxiNodeRef result;
+    return (tn->type() == FGPositioned::PARKING ? 10000 : 0) +
+           (tn->getIsOnRunway() ? 1000 : 0);
+}
 
-    FGTaxiNodeVector::const_iterator it;
-    for (it = m_nodes.begin(); it != m_nodes.end(); ++it) {
-        double localDistanceSqr = distSqr(cartPos, (*it)->cart());
-        if (localDistanceSqr < d) {
-            d = localDistanceSqr;
-            result = *it;
-        }
+void FGGroundNetwork::buildRoutingGraph()
+{
+    const int numNodes = static_cast<int>(m_nodes.size());
+
+    m_nodeDenseIndex.clear();
+    m_nodeDenseIndex.reserve(numNodes);
+    m_nodeIndexToDense.clear();
+    m_nodeIndexToDense.reserve(numNodes);
+    for (int i = 0; i < numNodes; ++i) {
+        m_nodeDenseIndex[m_nodes[i].ptr()] = i;
+        m_nodeIndexToDense.emplace(m_nodes[i]->getIndex(), i);
     }
 
-    return result;
+    // count outgoing segments per node, then convert to offsets
+    m_adjOffsets.assign(numNodes + 1, 0);
+    for (auto seg : segments) {
+        m_adjOffsets[denseIndexOf(seg->startNode) + 1]++;
+    }
+
+    for (int i = 0; i < numNodes; ++i) {
+        m_adjOffsets[i + 1] += m_adjOffsets[i];
+    }
+
+    const size_t numEdges = segments.size();
+    m_adjTargets.resize(numEdges);
+    m_adjSegments.resize(numEdges);
+    m_adjCosts.resize(numEdges);
+
+    std::vector<int> fill(m_adjOffsets.begin(), m_adjOffsets.end() - 1);
+    for (auto seg : segments) {
+        const int slot = fill[denseIndexOf(seg->startNode)]++;
+        FGTaxiNode* target = const_cast<FGTaxiNode*>(seg->endNode);
+        m_adjTargets[slot] = denseIndexOf(target);
+        m_adjSegments[slot] = seg;
+        m_adjCosts[slot] = dist(seg->startNode->cart(), target->cart()) + edgePenalty(target);
+    }
+
+    m_searchScore.resize(numNodes);
+    m_searchPrevEdge.resize(numNodes);
+    m_searchClosed.resize(numNodes);
+
+    m_routeCache.clear();
+    m_routeCacheIndex.clear();
 }
 
-FGTaxiNodeRef FGGroundNetwork::findNearestNodeOffRunway(const SGGeod& aGeod, FGRunway* rwy, double marginM) const
+int FGGroundNetwork::denseIndexOf(const FGTaxiNode* node) const
 {
-    FGTaxiNodeVector nodes;
-    const SGLineSegmentd runwayLine(rwy->cart(), SGVec3d::fromGeod(rwy->end()));
-    const double marginMSqr = marginM * marginM;
-    const SGVec3d cartPos = SGVec3d::fromGeod(aGeod);
+    auto it = m_nodeDenseIndex.find(node);
+    return (it == m_nodeDenseIndex.end()) ? -1 : it->second;
+}
+
+void FGGroundNetwork::buildNodeGrid()
+{
+    const int numNodes = static_cast<int>(m_nodes.size());
+    m_gridWidth = m_gridHeight = 0;
+    m_gridCellOffsets.clear();
+    m_gridCellNodes.clear();
+    if (numNodes == 0) {
+        return;
+    }
 
-    std::copy_if(m_nodes.begin(), m_nodes.end(), std::back_inserter(nodes),
-                 [runwayLine, cartPos, marginMSqr](const FGTaxiNodeRef& a) {
-                     if (a->getIsOnRunway()) return false;
+    // local frame at the centroid of the network
+    SGVec3d centroid(0.0, 0.0, 0.0);
+    for (const auto& node : m_nodes) {
+        centroid += node->cart();
+    }
+    m_gridOrigin = centroid / static_cast<double>(numNodes);
 
-                     // exclude parking positions from consideration. This helps to
-                     // exclude airports whose ground nets only list parking positions,
-                     // since these typically produce bad results. See discussion in
-                     // https://sourceforge.net/p/flightgear/codetickets/2110/
-                     if (a->type() == FGPositioned::PARKING) return false;
+    const SGQuatd hlOr = SGQuatd::fromLonLat(SGGeod::fromCart(m_gridOrigin));
+    m_gridAxisU = hlOr.backTransform(SGVec3d(1, 0, 0));
+    m_gridAxisV = hlOr.backTransform(SGVec3d(0, 1, 0));
 
-                     return (distSqr(runwayLine, a->cart()) >= marginMSqr);
-                 });
+    std::vector<double> us(numNodes), vs(numNodes);
+    double maxU = -DBL_MAX, maxV = -DBL_MAX;
+    m_gridMinU = m_gridMinV = DBL_MAX;
+    for (int i = 0; i < numNodes; ++i) {
+        const SGVec3d d = m_nodes[i]->cart() - m_gridOrigin;
+        us[i] = dot(d, m_gridAxisU);
+        vs[i] = dot(d, m_gridAxisV);
+        m_gridMinU = std::min(m_gridMinU, us[i]);
+        m_gridMinV = std::min(m_gridMinV, vs[i]);
+        maxU = std::max(maxU, us[i]);
+        maxV = std::max(maxV, vs[i]);
+    }
 
+    // 100m cells, unless a stray node makes the network huge: keep the
+    // grid itself bounded
+    const int maxCellsPerAxis = 512;
+    m_gridCellSizeM = std::max(100.0, std::max(maxU - m_gridMinU, maxV - m_gridMinV) / maxCellsPerAxis);
+    m_gridWidth = static_cast<int>((maxU - m_gridMinU) / m_gridCellSizeM) + 1;
+    m_gridHeight = static_cast<int>((maxV - m_gridMinV) / m_gridCellSizeM) + 1;
 
-    // find closest of matching nodes
-    auto node = std::min_element(nodes.begin(), nodes.end(),
-                                 [cartPos](const FGTaxiNodeRef& a, const FGTaxiNodeRef& b) { return distSqr(cartPos, a->cart()) < distSqr(cartPos, b->cart()); });
+    std::vector<int> cellOf(numNodes);
+    m_gridCellOffsets.assign(m_gridWidth * m_gridHeight + 1, 0);
+    for (int i = 0; i < numNodes; ++i) {
+        const int cx = std::min(m_gridWidth - 1, static_cast<int>((us[i] - m_gridMinU) / m_gridCellSizeM));
+        const int cy = std::min(m_gridHeight - 1, static_cast<int>((vs[i] - m_gridMinV) / m_gridCellSizeM));
+        cellOf[i] = cy * m_gridWidth + cx;
+        m_gridCellOffsets[cellOf[i] + 1]++;
+    }
 
-    if (node == nodes.end()) {
-        return FGTaxiNodeRef();
+    for (size_t c = 1; c < m_gridCellOffsets.size(); ++c) {
+        m_gridCellOffsets[c] += m_gridCellOffsets[c - 1];
     }
 
-    return *node;
+    // filling in dense index order keeps each cell sorted, which the
+    // tie-breaking in findNearestNodeMatching relies on
+    m_gridCellNodes.resize(numNodes);
+    std::vector<int> fill(m_gridCellOffsets.begin(), m_gridCellOffsets.end() - 1);
+    for (int i = 0; i < numNodes; ++i) {
+        m_gridCellNodes[fill[cellOf[i]]++] = i;
+    }
 }
 
-FGTaxiNodeRef FGGroundNetwork::findNearestNodeOnRunwayEntry(const SGGeod& aGeod) const
+FGTaxiNodeRef FGGroundNetwork::findNearestNodeMatching(const SGGeod& aGeod, const NodePredicate& pred) const
 {
-    double d = DBL_MAX;
-    SGVec3d cartPos = SGVec3d::fromGeod(aGeod);
-    FGTaxiNodeRef result;
-    for (auto it = m_nodes.begin(); it != m_nodes.end(); ++it) {
-        if (!(*it)->getIsOnRunway())
-            continue;
-        double localDistanceSqr = distSqr(cartPos, (*it)->cart());
-        if (localDistanceSqr < d) {
-            SG_LOG(SG_AI, SG_BULK, "findNearestNodeOnRunway from Threshold " << localDistanceSqr);
-            d = localDistanceSqr;
-            result = *it;
+    if (m_gridCellOffsets.empty()) {
+        return FGTaxiNodeRef();
+    }
+
+    const SGVec3d cartPos = SGVec3d::fromGeod(aGeod);
+    const SGVec3d d = cartPos - m_gridOrigin;
+    const int qx = static_cast<int>(std::floor((dot(d, m_gridAxisU) - m_gridMinU) / m_gridCellSizeM));
+    const int qy = static_cast<int>(std::floor((dot(d, m_gridAxisV) - m_gridMinV) / m_gridCellSizeM));
+
+    // rings (in Chebyshev distance) closer than this contain no grid cells,
+    // and rings beyond the furthest corner cannot contain any either
+    const int firstRing = std::max({0, -qx, qx - (m_gridWidth - 1), -qy, qy - (m_gridHeight - 1)});
+    const int lastRing = std::max({std::abs(qx), std::abs(qx - (m_gridWidth - 1)),
+                                   std::abs(qy), std::abs(qy - (m_gridHeight - 1))});
+
+    double bestDistSqr = DBL_MAX;
+    int best = -1;
+
+    auto visitCell = [&](int cx, int cy) {
+        const int cell = cy * m_gridWidth + cx;
+        for (int k = m_gridCellOffsets[cell]; k < m_gridCellOffsets[cell + 1]; ++k) {
+            const int n = m_gridCellNodes[k];
+            const FGTaxiNode* node = m_nodes[n].ptr();
+            if (pred && !pred(node)) {
+                continue;
+            }
+
+            const double localDistanceSqr = distSqr(cartPos, node->cart());
+            if ((localDistanceSqr < bestDistSqr) ||
+                ((localDistanceSqr == bestDistSqr) && (n < best))) {
+                bestDistSqr = localDistanceSqr;
+                best = n;
+            }
+        }
+    };
+
+    for (int r = firstRing; r <= lastRing; ++r) {
+        // every point in ring r is at least (r - 1) cells away in the
+        // tangent plane, and the planar distance never exceeds the 3D one
+        if (best >= 0) {
+            const double ringDist = (r - 1) * m_gridCellSizeM;
+            if ((ringDist > 0.0) && (ringDist * ringDist > bestDistSqr)) {
+                break;
+            }
+        }
+
+        const int x0 = std::max(qx - r, 0);
+        const int x1 = std::min(qx + r, m_gridWidth - 1);
+        const int y0 = std::max(qy - r + 1, 0);
+        const int y1 = std::min(qy + r - 1, m_gridHeight - 1);
+
+        // top and bottom rows of the ring
+        for (int cy : {qy - r, qy + r}) {
+            if ((cy < 0) || (cy >= m_gridHeight)) {
+                continue;
+            }
+            for (int cx = x0; cx <= x1; ++cx) {
+                visitCell(cx, cy);
+            }
+            if (r == 0) {
+                break; // both rows are the same cell
+            }
+        }
+
+        // left and right columns, excluding the corners visited above
+        for (int cx : {qx - r, qx + r}) {
+            if ((r == 0) || (cx < 0) || (cx >= m_gridWidth)) {
+                continue;
+            }
+            for (int cy = y0; cy <= y1; ++cy) {
+                visitCell(cx, cy);
+            }
         }
     }
 
-    return result;
+    return (best >= 0) ? m_nodes[best] : FGTaxiNodeRef();
+}
+
+void FGGroundNetwork::segmentBlocksChanged()
+{
+    m_routeCache.clear();
+    m_routeCacheIndex.clear();
+}
+
+FGTaxiNodeRef FGGroundNetwork::findNearestNode(const SGGeod& aGeod) const
+{
+    return findNearestNodeMatching(aGeod, NodePredicate());
+}
+
+FGTaxiNodeRef FGGroundNetwork::findNearestNodeOffRunway(const SGGeod& aGeod, FGRunway* rwy, double marginM) const
+{
+    const SGLineSegmentd runwayLine(rwy->cart(), SGVec3d::fromGeod(rwy->end()));
+    const double marginMSqr = marginM * marginM;
+
+    return findNearestNodeMatching(aGeod, [runwayLine, marginMSqr](const FGTaxiNode* a) {
+        if (a->getIsOnRunway()) return false;
+
+        // exclude parking positions from consideration. This helps to
+        // exclude airports whose ground nets only list parking positions,
+        // since these typically produce bad results. See discussion in
+        // https://sourceforge.net/p/flightgear/codetickets/2110/
+        if (a->type() == FGPositioned::PARKING) return false;
+
+        return (distSqr(runwayLine, a->cart()) >= marginMSqr);
+    });
+}
+
+FGTaxiNodeRef FGGroundNetwork::findNearestNodeOnRunwayEntry(const SGGeod& aGeod) const
+{
+    return findNearestNodeMatching(aGeod, [](const FGTaxiNode* a) {
+        return a->getIsOnRunway();
+    });
 }
 
 FGTaxiNodeRef FGGroundNetwork::findNearestNodeOnRunwayExit(const SGGeod& aGeod, FGRunway* aRunway) const
@@ -394,13 +574,13 @@ FGTaxiSegment* FGGroundNetwork::findSegment(const FGTaxiNode* from, const FGTaxi
         return NULL;
     }
 
-    // completely boring linear search of segments. Can be improved if/when
-    // this ever becomes a hot-spot
-    for (auto seg : segments) {
-        if (seg->startNode != from) {
-            continue;
-        }
+    const int fromIdx = denseIndexOf(from);
+    if (fromIdx < 0) {
+        return NULL;
+    }
 
+    for (int e = m_adjOffsets[fromIdx]; e < m_adjOffsets[fromIdx + 1]; ++e) {
+        FGTaxiSegment* seg = m_adjSegments[e];
         if ((to == 0) || (seg->endNode == to)) {
             return seg;
         }
@@ -409,90 +589,117 @@ FGTaxiSegment* FGGroundNetwork::findSegment(const FGTaxiNode* from, const FGTaxi
     return NULL; // not found
 }
 
-static int edgePenalty(FGTaxiNode* tn)
+FGTaxiRoute FGGroundNetwork::findShortestRoute(FGTaxiNode* start, FGTaxiNode* end, bool fullSearch)
 {
-    return (tn->type() == FGPositioned::PARKING ? 10000 : 0) +
-           (tn->getIsOnRunway() ? 1000 : 0);
-}
+    if (!start || !end) {
+        throw sg_exception("Bad arguments to findShortestRoute");
+    }
 
-class ShortestPathData
-{
-public:
-    ShortestPathData() : score(HUGE_VAL)
-    {
+    const int startIdx = denseIndexOf(start);
+    const int endIdx = denseIndexOf(end);
+    if ((startIdx < 0) || (endIdx < 0)) {
+        if (fullSearch) {
+            SG_LOG(SG_GENERAL, SG_ALERT,
+                   "Failed to find route from waypoint " << start->getIndex() << " to "
+                                                         << end->getIndex() << " at " << parent->getId()
+                                                         << ": node not part of the ground network");
+        }
+        return FGTaxiRoute();
     }
 
-    double score;
-    FGTaxiNodeRef previousNode;
-};
+    const RouteCacheKey key{startIdx, endIdx};
+    auto cached = m_routeCacheIndex.find(key);
+    if (cached != m_routeCacheIndex.end()) {
+        // move to the front of the LRU list
+        m_routeCache.splice(m_routeCache.begin(), m_routeCache, cached->second);
+        return cached->second->second;
+    }
 
-FGTaxiRoute FGGroundNetwork::findShortestRoute(FGTaxiNode* start, FGTaxiNode* end, bool fullSearch)
-{
-    if (!start || !end) {
-        throw sg_exception("Bad arguments to findShortestRoute");
+    FGTaxiRoute route = computeShortestRoute(startIdx, endIdx);
+    if (route.empty() && fullSearch) {
+        SG_LOG(SG_GENERAL, SG_ALERT,
+               "Failed to find route from waypoint " << start->getIndex() << " to "
+                                                     << end->getIndex() << " at " << parent->getId());
     }
-    //implements Dijkstra's algorithm to find shortest distance route from start to end
-    //taken from http://en.wikipedia.org/wiki/Dijkstra's_algorithm
-    FGTaxiNodeVector unvisited(m_nodes);
-    std::map<FGTaxiNode*, ShortestPathData> searchData;
 
-    searchData[start].score = 0.0;
+    const size_t maxCachedRoutes = 128;
+    if (m_routeCache.size() >= maxCachedRoutes) {
+        m_routeCacheIndex.erase(m_routeCache.back().first);
+        m_routeCache.pop_back();
+    }
 
-    while (!unvisited.empty()) {
-        // find lowest scored unvisited
-        FGTaxiNodeRef best = unvisited.front();
-        for (auto i : unvisited) {
-            if (searchData[i].score < searchData[best].score) {
-                best = i;
-            }
-        }
+    m_routeCache.emplace_front(key, route);
+    m_routeCacheIndex[key] = m_routeCache.begin();
+    return route;
+}
+
+FGTaxiRoute FGGroundNetwork::computeShortestRoute(int startIdx, int endIdx)
+{
+    // A* search. Edge costs are straight (cartesian) segment lengths plus a
+    // non-negative penalty, so the straight-line distance to the goal never
+    // over-estimates and the first time the goal is closed its score is optimal.
+    const SGVec3d goal = m_nodes[endIdx]->cart();
+
+    std::fill(m_searchScore.begin(), m_searchScore.end(), HUGE_VAL);
+    std::fill(m_searchPrevEdge.begin(), m_searchPrevEdge.end(), -1);
+    std::fill(m_searchClosed.begin(), m_searchClosed.end(), false);
 
-        // remove 'best' from the unvisited set
-        FGTaxiNodeVectorIterator newend =
-            remove(unvisited.begin(), unvisited.end(), best);
-        unvisited.erase(newend, unvisited.end());
+    // open set: (score + heuristic, node), lowest estimate on top. Stale
+    // entries are skipped when popped instead of being updated in place.
+    using OpenEntry = std::pair<double, int>;
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> open;
 
-        if (best == end) { // found route or best not connected
+    m_searchScore[startIdx] = 0.0;
+    open.push(OpenEntry(dist(m_nodes[startIdx]->cart(), goal), startIdx));
+
+    while (!open.empty()) {
+        const int best = open.top().second;
+        open.pop();
+
+        if (m_searchClosed[best]) {
+            continue;
+        }
+        m_searchClosed[best] = true;
+
+        if (best == endIdx) {
             break;
         }
 
-        for (auto target : findSegmentsFrom(best)) {
-            double edgeLength = dist(best->cart(), target->cart());
-            double alt = searchData[best].score + edgeLength + edgePenalty(target);
-            if (alt < searchData[target].score) { // Relax (u,v)
-                searchData[target].score = alt;
-                searchData[target].previousNode = best;
+        for (int e = m_adjOffsets[best]; e < m_adjOffsets[best + 1]; ++e) {
+            const int target = m_adjTargets[e];
+            if (m_searchClosed[target]) {
+                continue;
+            }
+
+            const double alt = m_searchScore[best] + m_adjCosts[e];
+            if (alt < m_searchScore[target]) { // Relax (u,v)
+                m_searchScore[target] = alt;
+                m_searchPrevEdge[target] = e;
+                open.push(OpenEntry(alt + dist(m_nodes[target]->cart(), goal), target));
             }
         } // of outgoing arcs/segments from current best node iteration
-    }     // of unvisited nodes remaining
+    }
 
-    if (searchData[end].score == HUGE_VAL) {
+    if (m_searchScore[endIdx] == HUGE_VAL) {
         // no valid route found
-        if (fullSearch && start && end) {
-            SG_LOG(SG_GENERAL, SG_ALERT,
-                   "Failed to find route from waypoint " << start->getIndex() << " to "
-                                                         << end->getIndex() << " at " << parent->getId());
-        }
-
         return FGTaxiRoute();
     }
 
     // assemble route from backtrace information
     FGTaxiNodeVector nodes;
     intVec routes;
-    FGTaxiNode* bt = end;
+    int bt = endIdx;
 
-    while (searchData[bt].previousNode != 0) {
-        nodes.push_back(bt);
-        FGTaxiSegment* segment = findSegment(searchData[bt].previousNode, bt);
-        int idx = segment->getIndex();
-        routes.push_back(idx);
-        bt = searchData[bt].previousNode;
+    while (m_searchPrevEdge[bt] >= 0) {
+        const int edge = m_searchPrevEdge[bt];
+        nodes.push_back(m_nodes[bt]);
+        routes.push_back(m_adjSegments[edge]->getIndex());
+        bt = denseIndexOf(m_adjSegments[edge]->startNode);
     }
-    nodes.push_back(start);
+    nodes.push_back(m_nodes[startIdx]);
     reverse(nodes.begin(), nodes.end());
     reverse(routes.begin(), routes.end());
-    return FGTaxiRoute(nodes, routes, searchData[end].score, 0);
+    return FGTaxiRoute(nodes, routes, m_searchScore[endIdx], 0);
 }
 
 void FGGroundNetwork::unblockAllSegments(time_t now)
@@ -519,14 +726,12 @@ void FGGroundNetwork::blockSegmentsEndingAt(const FGTaxiSegment* seg, int blockI
 
 FGTaxiNodeRef FGGroundNetwork::findNodeByIndex(int index) const
 {
-    FGTaxiNodeVector::const_iterator it;
-    for (it = m_nodes.begin(); it != m_nodes.end(); ++it) {
-        if ((*it)->getIndex() == index) {
-            return *it;
-        }
+    auto it = m_nodeIndexToDense.find(index);
+    if (it == m_nodeIndexToDense.end()) {
+        return FGTaxiNodeRef();
     }
 
-    return FGTaxiNodeRef();
+    return m_nodes[it->second];
 }
 
 FGParkingRef FGGroundNetwork::getParkingByIndex(unsigned int index) const
@@ -554,6 +759,7 @@ FGParkingRef FGGroundNetwork::findParkingByName(const string& name) const
 void FGGroundNetwork::addSegment(const FGTaxiNodeRef& from, const FGTaxiNodeRef& to)
 {
     FGTaxiSegment* seg = new FGTaxiSegment(from, to);
+    seg->network = this;
     segments.push_back(seg);
 
     FGTaxiNodeVector::iterator it = std::find(m_nodes.begin(), m_nodes.end(), from);
@@ -581,11 +787,14 @@ void FGGroundNetwork::addParking(const FGParkingRef& park)
 FGTaxiNodeVector FGGroundNetwork::findSegmentsFrom(const FGTaxiNodeRef& from) const
 {
     FGTaxiNodeVector result;
-    FGTaxiSegmentVector::const_iterator it;
-    for (it = segments.begin(); it != segments.end(); ++it) {
-        if ((*it)->getStart() == from) {
-            result.push_back((*it)->getEnd());
-        }
+    const int fromIdx = denseIndexOf(from);
+    if (fromIdx < 0) {
+        return result;
+    }
+
+    result.reserve(m_adjOffsets[fromIdx + 1] - m_adjOffsets[fromIdx]);
+    for (int e = m_adjOffsets[fromIdx]; e < m_adjOffsets[fromIdx + 1]; ++e) {
+        result.push_back(m_nodes[m_adjTargets[e]]);
     }
 
     return result;
@@ -597,15 +806,14 @@ FGTaxiSegment* FGGroundNetwork::findSegmentByHeading(const FGTaxiNode* from, con
         return NULL;
     }
 
-    FGTaxiSegment* best = nullptr;
-
-    // completely boring linear search of segments. Can be improved if/when
-    // this ever becomes a hot-spot
-    for (auto seg : segments) {
-        if (seg->startNode != from) {
-            continue;
-        }
+    const int fromIdx = denseIndexOf(from);
+    if (fromIdx < 0) {
+        return NULL;
+    }
 
+    FGTaxiSegment* best = nullptr;
+    for (int e = m_adjOffsets[fromIdx]; e < m_adjOffsets[fromIdx + 1]; ++e) {
+        FGTaxiSegment* seg = m_adjSegments[e];
         if (!best || fabs(best->getHeading() - heading) > fabs(seg->getHeading() - heading)) {
             best = seg;
         }
@@ -7,8 +7,13 @@
 
 #pragma once
 
+#include <functional>
+#include <list>
+#include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <simgear/compiler.h>
 
@@ -65,6 +70,7 @@ private:
 
     int index;
     FGTaxiSegment* oppositeDirection; // also deliberately weak
+    FGGroundNetwork* network;         // weak, set by the owning network
 
     friend class FGGroundNetwork;
 
@@ -180,6 +186,7 @@ class FGGroundNetwork
 {
 private:
     friend class FGGroundNetXMLLoader;
+    friend class FGTaxiSegment;
 
     bool hasNetwork;
     bool networkInitialized;
@@ -243,6 +250,70 @@ private:
     /// this map exists specifically to make blockSegmentsEndingAt not be a bottleneck
     NodeFromSegmentMap m_segmentsEndingAtNodeMap;
 
+    /**
+     * Routing graph, built once by init(). Every node in m_nodes gets a
+     * dense index (its position in m_nodes) and the outgoing segments of
+     * node i are stored in the range [m_adjOffsets[i], m_adjOffsets[i+1])
+     * of the m_adj* arrays (compressed sparse row layout), in the same
+     * order as they appear in 'segments'.
+     */
+    std::unordered_map<const FGTaxiNode*, int> m_nodeDenseIndex;
+    std::vector<int> m_adjOffsets;
+    std::vector<int> m_adjTargets;
+    std::vector<FGTaxiSegment*> m_adjSegments;
+    std::vector<double> m_adjCosts; ///< segment length plus target penalty
+
+    void buildRoutingGraph();
+    int denseIndexOf(const FGTaxiNode* node) const;
+
+    /// groundnet node index (as in the XML) -> dense index
+    std::unordered_map<int, int> m_nodeIndexToDense;
+
+    /**
+     * Uniform grid over the nodes, laid out in the plane tangent to the
+     * network at its centroid. Cell contents are dense node indices, again
+     * stored CSR style: cell c holds [m_gridCellOffsets[c], m_gridCellOffsets[c+1]).
+     */
+    SGVec3d m_gridOrigin;
+    SGVec3d m_gridAxisU;
+    SGVec3d m_gridAxisV;
+    double m_gridMinU = 0.0;
+    double m_gridMinV = 0.0;
+    double m_gridCellSizeM = 100.0;
+    int m_gridWidth = 0;
+    int m_gridHeight = 0;
+    std::vector<int> m_gridCellOffsets;
+    std::vector<int> m_gridCellNodes;
+
+    void buildNodeGrid();
+
+    using NodePredicate = std::function<bool(const FGTaxiNode*)>;
+    /**
+     * Nearest node (by cartesian distance) satisfying the predicate, or
+     * any node if no predicate is given. Ties go to the node added first,
+     * exactly as a linear scan over m_nodes would.
+     */
+    FGTaxiNodeRef findNearestNodeMatching(const SGGeod& aGeod, const NodePredicate& pred) const;
+
+    /// per-search scratch space, kept to avoid re-allocating for each route
+    std::vector<double> m_searchScore;
+    std::vector<int> m_searchPrevEdge;
+    std::vector<bool> m_searchClosed;
+
+    /**
+     * Small LRU cache of computed routes, keyed by the dense indices of
+     * the start and end nodes. The most recently used entry is at the
+     * front of the list. Cleared whenever the set of segment blocks
+     * changes.
+     */
+    using RouteCacheKey = std::pair<int, int>;
+    using RouteCacheList = std::list<std::pair<RouteCacheKey, FGTaxiRoute>>;
+    RouteCacheList m_routeCache;
+    std::map<RouteCacheKey, RouteCacheList::iterator> m_routeCacheIndex;
+
+    FGTaxiRoute computeShortestRoute(int startIdx, int endIdx);
+    void segmentBlocksChanged();
+
 public:
     explicit FGGroundNetwork(FGAirport* pr);
     virtual ~FGGroundNetwork();
@@ -292,6 +363,11 @@ public:
     FGTaxiNodeVector findSegmentsFrom(const FGTaxiNodeRef& from) const;
 
 
+    /**
+     * A* search over the taxiway graph, using the straight-line distance
+     * to the end node as heuristic. Results are cached per network until
+     * the segment blocks change.
+     */
     FGTaxiRoute findShortestRoute(FGTaxiNode* start, FGTaxiNode* end, bool fullSearch = true);
 
 
@@ -15,7 +15,6 @@
 // forward decls
 class SGPath;
 class PropertyWatcher;
-class RoutePath;
 
 /**
  * Top level route manager class
@@ -165,8 +164,6 @@ private:
     InputListener *listener;
     SGPropertyNode_ptr mirror;
 
-    std::unique_ptr<RoutePath> _routePath;
-
     /**
      * Helper to keep various pieces of state in sync when the route is
      * modified (waypoints added, inserted, removed). Notably, this fires the
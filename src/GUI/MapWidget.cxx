@@ -713,21 +713,19 @@ void MapWidget::update()
         af.showAll();
     }
     
-    bool partial = false;
-    FGPositionedList newItemsToDraw =
-        FGPositioned::findWithinRangePartial(_projectionCenter, _drawRangeNm, &af, partial);
-    
+    // airports, navaids and POIs are found in one pass over the spatial index
+    std::vector<FGPositioned::RangeQuery> queries;
+    queries.push_back({_projectionCenter, _drawRangeNm, &af});
+
     bool fixes = _root->getBoolValue("draw-fixes");
     NavaidFilter f(fixes, _root->getBoolValue("draw-navaids"));
     if (f.minType() <= f.maxType()) {
-        FGPositionedList navs = FGPositioned::findWithinRange(_projectionCenter, _drawRangeNm, &f);
-        newItemsToDraw.insert(newItemsToDraw.end(), navs.begin(), navs.end());
+        queries.push_back({_projectionCenter, _drawRangeNm, &f});
     }
 
+    FGPositioned::TypeFilter tf(FGPositioned::COUNTRY);
     const bool drawPOIs = _root->getBoolValue("draw-pois");
     if (drawPOIs) {
-      FGPositioned::TypeFilter tf(FGPositioned::COUNTRY);
-
       if (_cachedZoom <= SHOW_DETAIL_ZOOM) {
           tf.addType(FGPositioned::CITY);
       }
@@ -735,11 +733,17 @@ void MapWidget::update()
       if (_cachedZoom <= SHOW_DETAIL2_ZOOM) {
           tf.addType(FGPositioned::TOWN);
       }
-      
-      FGPositionedList poi = FGPositioned::findWithinRange(_projectionCenter, _drawRangeNm, &tf);
-      newItemsToDraw.insert(newItemsToDraw.end(), poi.begin(), poi.end());
+
+      queries.push_back({_projectionCenter, _drawRangeNm, &tf});
     }
 
+    // no time limit: a partial batch would drop navaids and POIs as well
+    FGPositioned::BatchResults results;
+    FGPositioned::findWithinRangeBatch(queries, results);
+
+    FGPositionedList newItemsToDraw;
+    newItemsToDraw.swap(results.items);
+
     _itemsToDraw.swap(newItemsToDraw);
     
     updateAIObjects();
@@ -882,7 +886,7 @@ void MapWidget::paintRoute()
     return;
   }
 
-  RoutePath path(_route->flightPlan());
+  const RoutePath& path = _route->flightPlan()->routePath();
 
 // first pass, draw the actual lines
   glLineWidth(2.0);
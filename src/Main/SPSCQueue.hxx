@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileName: SPSCQueue.hxx
+ * SPDX-FileComment: bounded lock-free single-producer / single-consumer queue
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace flightgear {
+
+/**
+ * Fixed-capacity ring buffer for handing values from exactly one producer
+ * thread to exactly one consumer thread, without locks.
+ *
+ * push() must only be called from the producer and pop() only from the
+ * consumer. Neither blocks: push() fails when the queue is full, pop()
+ * when it is empty, and the caller decides whether to drop, retry or
+ * sleep. Values are moved in and out, so move-only types such as
+ * std::unique_ptr work.
+ */
+template <typename T>
+class SPSCQueue
+{
+public:
+    /// the capacity is rounded up to a power of two
+    explicit SPSCQueue(size_t capacity)
+    {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _slots.resize(size);
+        _mask = size - 1;
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    size_t capacity() const { return _slots.size(); }
+
+    bool push(T&& value)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) >= _slots.size()) {
+            return false;
+        }
+
+        _slots[tail & _mask] = std::move(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = std::move(_slots[head & _mask]);
+        // leave the slot in a moved-from but destructible state
+        _slots[head & _mask] = T();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// approximate when called from the producer
+    bool empty() const
+    {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T> _slots;
+    size_t _mask = 0;
+
+    // producer and consumer indices on separate cache lines, so the two
+    // threads don't invalidate each other's line on every operation
+    alignas(64) std::atomic<size_t> _head{0};
+    alignas(64) std::atomic<size_t> _tail{0};
+};
+
+} // namespace flightgear
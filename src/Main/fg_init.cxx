@@ -1355,6 +1355,7 @@ void fgStartNewReset()
     flightgear::addons::AddonManager::reset();
 
     globals->resetPropertyRoot();
+    flightgear::NavDataCache::instance()->resetStatisticsProperties();
     // otherwise channels are duplicated
     globals->get_channel_options_list()->clear();
 
@@ -24,6 +24,7 @@
 
 #include <simgear/compiler.h>
 
+#include <cmath>
 #include <cstdlib>             // atoi()
 
 #include <string>
@@ -366,6 +367,7 @@ FGIO::init()
     //         globals->get_channel_options_list()->size() << " requests." );
 
     _realDeltaTime = fgGetNode("/sim/time/delta-realtime-sec");
+    _asyncChannels = fgGetNode("/sim/io/async-channels", true);
 
     // we could almost do this in a single step except pushing a valid
     // port onto the port list copies the structure and destroys the
@@ -373,7 +375,7 @@ FGIO::init()
 
     for (const auto& config : *(globals->get_channel_options_list())) {
         bool ok;
-        FGProtocol* p = add_channel(config, ok);
+        FGProtocol* p = add_channel(config, ok, _asyncChannels->getBoolValue());
         SG_LOG( SG_IO, SG_DEBUG, "add_channel() with config=" << config << " => ok=" << ok << " p=" << p);
         if (ok) {
             if (p) {
@@ -391,7 +393,7 @@ FGIO::init()
 }
 
 // add another I/O channel
-FGProtocol* FGIO::add_channel(const string& config, bool& o_ok)
+FGProtocol* FGIO::add_channel(const string& config, bool& o_ok, bool async)
 {
     // parse the configuration string and store the results in the
     // appropriate FGIOChannel structure
@@ -413,20 +415,101 @@ FGProtocol* FGIO::add_channel(const string& config, bool& o_ok)
     }
 
     io_channels.push_back( p );
+    startChannel( p, async );
     return p;
 }
 
+void FGIO::startChannel(FGProtocol* p, bool async)
+{
+    ChannelState& state = _channelState[p];
+    if (!async) {
+        return;
+    }
+
+    if (!p->supports_async()) {
+        SG_LOG(SG_IO, SG_INFO, "Channel \"" << p->get_name()
+               << "\" doesn't support asynchronous I/O, processing it on the main loop");
+        return;
+    }
+
+    state.worker.reset(new FGIOWorker(p));
+    state.worker->start();
+}
+
+// Stops the worker of a channel, waking it up if it is blocked reading a
+// quiet serial port or socket. The channel is never closed under the worker:
+// its descriptor could be reused while the thread still reads it. A worker
+// that doesn't exit in time is parked with its protocol until it does, and
+// false is returned: the caller must forget the protocol, but not delete it.
+bool FGIO::stopChannel(FGProtocol* p)
+{
+    auto it = _channelState.find(p);
+    if (it == _channelState.end()) {
+        return true;
+    }
+
+    std::unique_ptr<FGIOWorker> worker = std::move(it->second.worker);
+    _channelState.erase(it);
+    if (!worker) {
+        return true;
+    }
+
+    worker->stop();
+    for (int i = 0; i < 10; ++i) {
+        worker->interrupt();
+        if (worker->waitForExit(std::chrono::milliseconds(100))) {
+            worker->join();
+            return true;
+        }
+    }
+
+    SG_LOG(SG_IO, SG_ALERT, "I/O thread of channel \"" << p->get_name()
+           << "\" is blocked, parking it until it exits");
+    _parkedChannels.push_back({std::move(worker), p});
+    return false;
+}
+
+// Deletes the parked channels whose worker has exited meanwhile.
+void FGIO::drainParkedChannels(std::chrono::milliseconds timeout)
+{
+    auto it = _parkedChannels.begin();
+    while (it != _parkedChannels.end()) {
+        it->worker->interrupt();
+        if (!it->worker->waitForExit(timeout)) {
+            ++it;
+            continue;
+        }
+
+        it->worker->join();
+        if (it->protocol->is_enabled()) {
+            it->protocol->close();
+        }
+        delete it->protocol;
+        it = _parkedChannels.erase(it);
+    }
+}
+
 void
 FGIO::reinit()
 {
     SG_LOG(SG_IO, SG_INFO, "FGIO::reinit()");
 
-    std::for_each(io_channels.begin(), io_channels.end(), [](FGProtocol* p) {
+    ProtocolVec::iterator it = io_channels.begin();
+    while (it != io_channels.end()) {
+        FGProtocol* p = *it;
         SG_LOG(SG_IO, SG_INFO, "Restarting channel \"" << p->get_name() << "\"");
+        // the protocol configuration is reloaded, so keep the worker out of it
+        const bool async = _channelState[p].worker != nullptr;
+        if (!stopChannel(p)) {
+            // parked, a second worker mustn't share the channel
+            it = io_channels.erase(it);
+            continue;
+        }
         p->reinit();
-    });
+        startChannel(p, async);
+        ++it;
+    }
 }
-
 // process any IO channel work
 void
 FGIO::update( double /* delta_time_sec */ )
@@ -436,6 +519,10 @@ FGIO::update( double /* delta_time_sec */ )
     // see http://code.google.com/p/flightgear-bugs/issues/detail?id=125
     double delta_time_sec = _realDeltaTime->getDoubleValue();
 
+    if (!_parkedChannels.empty()) {
+        drainParkedChannels(std::chrono::milliseconds(0));
+    }
+
     ProtocolVec::iterator i = io_channels.begin();
     ProtocolVec::iterator end = io_channels.end();
     for (; i != end; ++i ) {
@@ -447,8 +534,33 @@ FGIO::update( double /* delta_time_sec */ )
         p->dec_count_down( delta_time_sec );
         double dt = 1 / p->get_hz();
         if ( p->get_count_down() < 0.33 * dt ) {
-            p->process();
+            ChannelState& state = _channelState[p];
+            if (!state.statsNode) {
+                state.statsNode = fgGetNode("/io/channels/" + p->get_name() + "/stats", true);
+            }
+
+            if (state.worker) {
+                // the worker reads and writes the channel; we only exchange
+                // property snapshots with it
+                state.worker->exchange();
+                state.worker->publishStats(state.statsNode);
+            } else {
+                SGTimeStamp start;
+                start.stamp();
+                p->process();
+                state.processTime.add((SGTimeStamp::now() - start).toSecs());
+                if (state.lastProcess.toUSecs() != 0) {
+                    state.jitter.add(std::fabs((start - state.lastProcess).toSecs() - dt));
+                }
+                state.lastProcess = start;
+
+                state.statsNode->setBoolValue("async", false);
+                state.processTime.publish(state.statsNode, "main-loop");
+                state.jitter.publish(state.statsNode, "jitter");
+            }
+
             p->inc_count();
+            state.statsNode->setIntValue("count", static_cast<int>(p->get_count()));
             while ( p->get_count_down() < 0.33 * dt ) {
                 p->inc_count_down( dt );
             }
@@ -464,15 +576,28 @@ FGIO::shutdown()
     for (; i != end; ++i )
     {
         FGProtocol *p = *i;
+        SG_LOG(SG_IO, SG_INFO, "Shutting down channel \"" << p->get_name() << "\"");
+        if ( !stopChannel( p ) ) {
+            continue;
+        }
         if ( p->is_enabled() ) {
             p->close();
         }
-        SG_LOG(SG_IO, SG_INFO, "Shutting down channel \"" << p->get_name() << "\"");
 
         delete p;
     }
 
     io_channels.clear();
+
+    drainParkedChannels(std::chrono::milliseconds(1000));
+    for (auto& parked : _parkedChannels) {
+        // still blocked: let the process exit take the thread down, deleting
+        // the protocol or the worker under it would crash
+        SG_LOG(SG_IO, SG_ALERT, "Leaving blocked I/O thread of channel \""
+               << parked.protocol->get_name() << "\" behind");
+        parked.worker.release();
+    }
+    _parkedChannels.clear();
     
     auto cmdMgr = globals->get_commands();
     cmdMgr->removeCommand("add-io-channel");
@@ -518,7 +643,7 @@ bool FGIO::commandAddChannel(const SGPropertyNode * arg, SGPropertyNode * root)
     string name = arg->getStringValue("name");
     const string config = arg->getStringValue("config");
     bool ok;
-    auto protocol = add_channel(config, ok);
+    auto protocol = add_channel(config, ok, arg->getBoolValue("async", _asyncChannels->getBoolValue()));
     if (!ok) {
         SG_LOG(SG_NETWORK, SG_WARN, "add-io-channel: adding channel failed");
         return false;
@@ -570,11 +695,15 @@ bool FGIO::commandRemoveChannel(const SGPropertyNode * arg, SGPropertyNode * roo
     removeFromPropertyTree(name);
 
     FGProtocol* p = *it;
+    io_channels.erase(it);
+    if (!stopChannel(p)) {
+        // parked until its worker exits
+        return true;
+    }
     if (p->is_enabled()) {
         p->close();
     }
     delete p;
-    io_channels.erase(it);
     return true;
 }
 
@@ -7,12 +7,18 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <simgear/compiler.h>
 #include <simgear/props/props.hxx>
 #include <simgear/structure/subsystem_mgr.hxx>
+#include <simgear/timing/timestamp.hxx>
+
+#include <Network/IOWorker.hxx>
 
 
 class FGProtocol;
@@ -42,11 +48,15 @@ public:
     static bool isMultiplayerRequested();
 
 private:
-    FGProtocol* add_channel(const std::string& config, bool& o_ok);
+    FGProtocol* add_channel(const std::string& config, bool& o_ok, bool async);
 
     FGProtocol* parse_port_config(const std::string& cfgstr, bool& o_ok);
     FGProtocol* parse_port_config(const string_list& tokens, bool& o_ok);
 
+    void startChannel(FGProtocol* p, bool async);
+    bool stopChannel(FGProtocol* p);
+    void drainParkedChannels(std::chrono::milliseconds timeout);
+
     void addToPropertyTree(const std::string name, const std::string config);
     void removeFromPropertyTree(const std::string name);
     std::string generateName(const std::string protocol);
@@ -58,6 +68,27 @@ private:
     typedef std::vector<FGProtocol*> ProtocolVec;
     ProtocolVec io_channels;
 
+    // per channel: the I/O worker, if the channel is asynchronous, and the
+    // statistics under /io/channels/<name>/stats
+    struct ChannelState {
+        std::unique_ptr<FGIOWorker> worker;
+        SGTimeStamp lastProcess;
+        FGIORunningStat processTime;
+        FGIORunningStat jitter;
+        SGPropertyNode_ptr statsNode;
+    };
+    std::map<FGProtocol*, ChannelState> _channelState;
+
+    // channels whose worker was still blocked when they were stopped: out of
+    // io_channels, deleted once the worker exits, at the latest at shutdown
+    struct ParkedChannel {
+        std::unique_ptr<FGIOWorker> worker;
+        FGProtocol* protocol;
+    };
+    std::vector<ParkedChannel> _parkedChannels;
+
+    SGPropertyNode_ptr _asyncChannels;
+
     SGPropertyNode_ptr _realDeltaTime;
 
     bool commandAddChannel(const SGPropertyNode* arg, SGPropertyNode* root);
@@ -0,0 +1,365 @@
+/*
+ * SPDX-FileName: MPLoadGenerator.cxx
+ * SPDX-FileComment: synthetic multiplayer pilots for load testing
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include <simgear/constants.h>
+#include <simgear/math/SGGeodesy.hxx>
+
+#include "MPLoadGenerator.hxx"
+#include "mpmessages.hxx"
+#include "mpproperties.hxx"
+
+namespace {
+
+const char* MODELS[] = {
+    "Aircraft/c172p/Models/c172p.xml",
+    "Aircraft/737-300/Models/737-300.xml",
+    "Aircraft/777/Models/777-200ER.xml",
+    "Aircraft/A320-family/Models/A320neo-CFM.xml",
+    "Aircraft/SenecaII/Models/SenecaII.xml",
+    "Aircraft/ufo/Models/ufo.xml"};
+const int NUM_MODELS = sizeof(MODELS) / sizeof(MODELS[0]);
+
+// share of the generic and Emesary properties each pilot sends
+const unsigned GENERIC_PERCENT = 15;
+
+// the first id of the generic properties; the ones below are the
+// standard aircraft properties every client sends
+const unsigned FIRST_GENERIC_ID = 10000;
+
+unsigned nextRandom(unsigned& state)
+{
+    // xorshift32: deterministic for a given seed on all platforms
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+double randomIn(unsigned& state, double lo, double hi)
+{
+    return lo + (hi - lo) * (nextRandom(state) % 10000) / 10000.0;
+}
+
+short scaledShort(double v, double scale)
+{
+    const float nv = v * scale;
+    if (nv >= 32767) return 32767;
+    if (nv <= -32767) return -32767;
+    return static_cast<short>(nv);
+}
+
+} // of anonymous namespace
+
+struct MPLoadGenerator::Pilot {
+    std::string callsign;
+    std::string model;
+    std::string text; // value of all string properties
+    double radiusM;
+    double bearing0Rad;
+    double omegaRad; // rate of the bearing from the centre
+    double speedMps;
+    double bankRad;
+    double altitudeFt;
+    double phaseSec; // offset of the sends within the transmit interval
+    double nextSendTime = -1.0;
+    int fallbackModelIndex;
+    // sorted by id, as required by the encoding
+    std::vector<const IdPropertyList*> properties;
+};
+
+MPLoadGenerator::MPLoadGenerator(const Options& options) :
+    _options(options)
+{
+    // the protocol versions FGMultiplayMgr can send
+    _options.protocolVersion = std::min(std::max(_options.protocolVersion, 1), 2);
+    if (_options.txRateHz <= 0.0) {
+        _options.txRateHz = 10.0;
+    }
+
+    unsigned rng = _options.seed ? _options.seed : 1;
+    _pilots.resize(std::max(0, _options.numPilots));
+    for (int i = 0; i < numPilots(); ++i) {
+        Pilot& p = _pilots[i];
+
+        char callsign[MAX_CALLSIGN_LEN];
+        snprintf(callsign, sizeof(callsign), "MP%05d", i % 100000);
+        p.callsign = callsign;
+        p.model = MODELS[i % NUM_MODELS];
+        p.text.assign(static_cast<size_t>(randomIn(rng, 4, 48)), 'a' + (i % 26));
+
+        p.radiusM = randomIn(rng, 0.1, 1.0) * _options.radiusNm * SG_NM_TO_METER;
+        p.bearing0Rad = randomIn(rng, 0.0, SGD_2PI);
+        p.speedMps = randomIn(rng, 80.0, 480.0) * SG_KT_TO_MPS;
+        p.omegaRad = p.speedMps / p.radiusM;
+        p.bankRad = atan(p.speedMps * p.omegaRad / 9.81);
+        p.altitudeFt = randomIn(rng, 1000.0, 38000.0);
+        p.phaseSec = randomIn(rng, 0.0, 1.0) / _options.txRateHz;
+        p.fallbackModelIndex = i % 8;
+
+        selectProperties(p, rng);
+    }
+}
+
+MPLoadGenerator::~MPLoadGenerator() = default;
+
+const std::string& MPLoadGenerator::callsign(int pilot) const
+{
+    return _pilots.at(pilot).callsign;
+}
+
+void MPLoadGenerator::selectProperties(Pilot& pilot, unsigned& rng) const
+{
+    for (unsigned i = 0; i < numProperties; ++i) {
+        const IdPropertyList* prop = &sIdPropertyList[i];
+        if (prop->TransmitAs == TT_NOSEND) {
+            continue;
+        }
+        if ((prop->id >= FIRST_GENERIC_ID) && (prop->id != FALLBACK_MODEL_ID) &&
+            (nextRandom(rng) % 100 >= GENERIC_PERCENT)) {
+            continue;
+        }
+        pilot.properties.push_back(prop);
+    }
+}
+
+unsigned MPLoadGenerator::encodePosMsg(int index, double time, char* buf) const
+{
+    const Pilot& pilot = _pilots.at(index);
+    const int protocol = _options.protocolVersion;
+
+    // suitably aligned, like FGMultiplayMgr::MsgBuf
+    union {
+        xdr_data2_t align;
+        char data[MAX_PACKET_SIZE];
+    } msg;
+    memset(msg.data, 0, sizeof(msg.data));
+
+    T_MsgHdr* hdr = reinterpret_cast<T_MsgHdr*>(msg.data);
+    T_PositionMsg* posMsg = reinterpret_cast<T_PositionMsg*>(msg.data + sizeof(T_MsgHdr));
+    xdr_data_t* ptr = reinterpret_cast<xdr_data_t*>(msg.data + sizeof(T_MsgHdr) + sizeof(T_PositionMsg));
+    xdr_data_t* const msgEnd = reinterpret_cast<xdr_data_t*>(msg.data + MAX_PACKET_SIZE);
+
+    //////////////////////////////////////////////////
+    //  motion: a coordinated level turn around the
+    //  centre point
+    //////////////////////////////////////////////////
+    const double bearingRad = pilot.bearing0Rad + pilot.omegaRad * time;
+    SGGeod geod;
+    double course2;
+    SGGeodesy::direct(_options.center, bearingRad * SGD_RADIANS_TO_DEGREES, pilot.radiusM, geod, course2);
+    geod.setElevationFt(pilot.altitudeFt);
+
+    const float headingRad = (course2 + 90.0) * SGD_DEGREES_TO_RADIANS;
+    const SGQuatf qEc2Hl = SGQuatf::fromLonLatRad(geod.getLongitudeRad(), geod.getLatitudeRad());
+    const SGQuatf hlOr = SGQuatf::fromYawPitchRoll(headingRad, 0.0f, pilot.bankRad);
+    SGVec3f angleAxis;
+    (qEc2Hl * hlOr).getAngleAxis(angleAxis);
+    const SGVec3d cart = SGVec3d::fromGeod(geod);
+
+    strncpy(posMsg->Model, pilot.model.c_str(), MAX_MODEL_NAME_LEN - 1);
+    posMsg->time = XDR_encode_double(time);
+    posMsg->lag = XDR_encode_double(1.0 / _options.txRateHz);
+    for (unsigned i = 0; i < 3; ++i) {
+        posMsg->position[i] = XDR_encode_double(cart(i));
+        posMsg->orientation[i] = XDR_encode_float(angleAxis(i));
+        posMsg->linearAccel[i] = XDR_encode_float(0.0);
+        posMsg->angularAccel[i] = XDR_encode_float(0.0);
+    }
+    // body frame, as sent by FGMultiplayMgr::Send()
+    posMsg->linearVel[0] = XDR_encode_float(pilot.speedMps);
+    posMsg->linearVel[1] = XDR_encode_float(0.0);
+    posMsg->linearVel[2] = XDR_encode_float(0.0);
+    posMsg->angularVel[0] = XDR_encode_float(0.0);
+    posMsg->angularVel[1] = XDR_encode_float(pilot.omegaRad * sin(pilot.bankRad));
+    posMsg->angularVel[2] = XDR_encode_float(pilot.omegaRad * cos(pilot.bankRad));
+    posMsg->pad = (protocol > 1) ? XDR_encode_int32(V2_PAD_MAGIC) : 0;
+
+    //////////////////////////////////////////////////
+    //  properties, with the same rules as
+    //  FGMultiplayMgr::SendMyPosition()
+    //////////////////////////////////////////////////
+    auto wave = [&pilot, time](unsigned id) {
+        return sin(time * 0.5 + id * 0.37 + pilot.bearing0Rad);
+    };
+    auto intValue = [&](unsigned id) {
+        if (id == FALLBACK_MODEL_ID) {
+            return pilot.fallbackModelIndex;
+        }
+        if (id == 10) { // sim/multiplay/protocol-version
+            return protocol;
+        }
+        return static_cast<int>(time * 2.0 + id) % 100;
+    };
+
+    int boolBits[MAX_BOOL_BUFFERS] = {0, 0, 0};
+    bool boolPending[MAX_BOOL_BUFFERS] = {false, false, false};
+    for (const IdPropertyList* prop : pilot.properties) {
+        if (prop->TransmitAs == TT_BOOLARRAY) {
+            const int block = (prop->id - BOOLARRAY_BASE_1) / BOOLARRAY_BLOCKSIZE;
+            if (block >= 0 && block < MAX_BOOL_BUFFERS) {
+                boolPending[block] = true;
+                if (wave(prop->id) > 0.0) {
+                    boolBits[block] |= 1 << (prop->id - BOOLARRAY_BASE_1 - block * BOOLARRAY_BLOCKSIZE);
+                }
+            }
+        }
+    }
+
+    for (int partition = 1; partition <= protocol; ++partition) {
+        for (const IdPropertyList* prop : pilot.properties) {
+            if (protocol == 1 && prop->version == V2_PROP_ID_PROTOCOL) {
+                continue;
+            }
+            const int version = prop->version & 0xffff;
+            if ((version != partition) && (version <= protocol)) {
+                continue;
+            }
+            if (ptr + 2 >= msgEnd) {
+                goto done; // the rest doesn't fit, as for a real client
+            }
+
+            int transmitType = prop->type;
+            if (prop->TransmitAs != TT_ASIS && protocol > 1) {
+                transmitType = prop->TransmitAs;
+            } else if (prop->TransmitAs == TT_BOOLARRAY) {
+                transmitType = TT_BOOLARRAY;
+            }
+
+            if (prop->encode_for_transmit && protocol > 1) {
+                FGPropertyData data;
+                data.id = prop->id;
+                data.type = simgear::props::STRING;
+                data.string_value = new char[16];
+                strcpy(data.string_value, "Disengaged");
+                ptr = (*prop->encode_for_transmit)(prop, ptr, &data);
+                continue;
+            }
+
+            const xdr_data_t id = XDR_encode_uint32(prop->id);
+            switch (transmitType) {
+            case TT_SHORTINT:
+                *ptr++ = XDR_encode_shortints32(prop->id, intValue(prop->id));
+                break;
+            case TT_SHORT_FLOAT_1:
+                *ptr++ = XDR_encode_shortints32(prop->id, scaledShort(1000.0 * wave(prop->id), 10.0));
+                break;
+            case TT_SHORT_FLOAT_2:
+                *ptr++ = XDR_encode_shortints32(prop->id, scaledShort(100.0 * wave(prop->id), 100.0));
+                break;
+            case TT_SHORT_FLOAT_3:
+                *ptr++ = XDR_encode_shortints32(prop->id, scaledShort(10.0 * wave(prop->id), 1000.0));
+                break;
+            case TT_SHORT_FLOAT_4:
+                *ptr++ = XDR_encode_shortints32(prop->id, scaledShort(wave(prop->id), 10000.0));
+                break;
+            case TT_SHORT_FLOAT_NORM:
+                *ptr++ = XDR_encode_shortints32(prop->id, scaledShort(wave(prop->id), 32767.0));
+                break;
+            case TT_BOOLARRAY: {
+                const int block = (prop->id - BOOLARRAY_BASE_1) / BOOLARRAY_BLOCKSIZE;
+                if (block >= 0 && block < MAX_BOOL_BUFFERS && boolPending[block]) {
+                    *ptr++ = XDR_encode_int32(BOOLARRAY_START_ID + block * BOOLARRAY_BLOCKSIZE);
+                    *ptr++ = XDR_encode_int32(boolBits[block]);
+                    boolPending[block] = false;
+                }
+                break;
+            }
+            case simgear::props::INT:
+            case simgear::props::LONG:
+                *ptr++ = id;
+                *ptr++ = XDR_encode_uint32(intValue(prop->id));
+                break;
+            case simgear::props::BOOL:
+                *ptr++ = id;
+                *ptr++ = XDR_encode_uint32(wave(prop->id) > 0.0);
+                break;
+            case simgear::props::STRING:
+            case simgear::props::UNSPECIFIED: {
+                const uint32_t len = pilot.text.size();
+                if (protocol > 1) {
+                    // id and length packed into one word, then the raw characters
+                    char* encodeStart = reinterpret_cast<char*>(ptr);
+                    if (encodeStart + 2 + len >= reinterpret_cast<char*>(msgEnd)) {
+                        goto done;
+                    }
+                    *ptr++ = XDR_encode_shortints32(prop->id, len);
+                    encodeStart = reinterpret_cast<char*>(ptr);
+                    memcpy(encodeStart, pilot.text.data(), len);
+                    ptr = reinterpret_cast<xdr_data_t*>(encodeStart + len);
+                } else {
+                    // one word per character, padded to a multiple of four
+                    if (ptr + 2 + ((len + 3) & ~3) >= msgEnd) {
+                        goto done;
+                    }
+                    *ptr++ = id;
+                    *ptr++ = XDR_encode_uint32(len);
+                    for (uint32_t c = 0; c < ((len + 3) & ~3); ++c) {
+                        *ptr++ = XDR_encode_int8((c < len) ? pilot.text[c] : 0);
+                    }
+                }
+                break;
+            }
+            default:
+                *ptr++ = id;
+                *ptr++ = XDR_encode_float(100.0 * wave(prop->id));
+                break;
+            }
+        }
+    }
+
+done:
+    const unsigned msgLen = reinterpret_cast<char*>(ptr) - msg.data;
+    hdr->Magic = XDR_encode_uint32(MSG_MAGIC);
+    hdr->Version = XDR_encode_uint32(PROTO_VER);
+    hdr->MsgId = XDR_encode_uint32(POS_DATA_ID);
+    hdr->MsgLen = XDR_encode_uint32(msgLen);
+    hdr->RequestedRangeNm = XDR_encode_shortints32(0, 100);
+    hdr->ReplyPort = 0;
+    strncpy(hdr->Callsign, pilot.callsign.c_str(), MAX_CALLSIGN_LEN);
+    hdr->Callsign[MAX_CALLSIGN_LEN - 1] = '\0';
+
+    memcpy(buf, msg.data, msgLen);
+    return msgLen;
+}
+
+int MPLoadGenerator::sendDue(double time, simgear::Socket& socket,
+                             const std::vector<simgear::IPAddress>& destinations)
+{
+    const double interval = 1.0 / _options.txRateHz;
+    char buf[MAX_PACKET_SIZE];
+    int count = 0;
+
+    for (int i = 0; i < numPilots(); ++i) {
+        Pilot& p = _pilots[i];
+        if (p.nextSendTime < 0.0) {
+            // first call: start the staggered schedule now
+            p.nextSendTime = time + p.phaseSec;
+        }
+        if (time < p.nextSendTime) {
+            continue;
+        }
+
+        const unsigned len = encodePosMsg(i, time, buf);
+        for (const auto& dest : destinations) {
+            socket.sendto(buf, len, 0, &dest);
+        }
+        ++count;
+
+        p.nextSendTime += interval;
+        if (p.nextSendTime <= time) {
+            // we fell behind; don't send a burst to catch up
+            p.nextSendTime = time + interval;
+        }
+    }
+    return count;
+}
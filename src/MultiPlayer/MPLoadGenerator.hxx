@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileName: MPLoadGenerator.hxx
+ * SPDX-FileComment: synthetic multiplayer pilots for load testing
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <simgear/io/raw_socket.hxx>
+#include <simgear/math/SGMath.hxx>
+
+/**
+ * Synthesises a crowd of multiplayer pilots flying circles around a centre
+ * point, and encodes their position messages the way a real client does:
+ * the same header and motion block, and the V1 or V2 property encoding of
+ * the properties listed in sIdPropertyList.
+ *
+ * Every pilot sends all the standard aircraft properties, plus a stable
+ * random subset of the generic and Emesary properties, so packet sizes
+ * and decode costs are in the range seen on the public servers. As with a
+ * real client, properties that don't fit into MAX_PACKET_SIZE are dropped.
+ *
+ * This depends on SimGear only, so it can be used both by the fgmpload
+ * relay stand-in and by the test suite.
+ */
+class MPLoadGenerator
+{
+public:
+    struct Options {
+        int numPilots = 100;
+        int protocolVersion = 2;
+        double txRateHz = 10.0;
+        SGGeod center = SGGeod::fromDegFt(-122.375, 37.619, 13.0); // KSFO
+        double radiusNm = 30.0;
+        unsigned seed = 1;
+    };
+
+    explicit MPLoadGenerator(const Options& options);
+    ~MPLoadGenerator();
+
+    int numPilots() const { return static_cast<int>(_pilots.size()); }
+    const std::string& callsign(int pilot) const;
+
+    /**
+     * Encode the position message of a pilot at the given MP protocol time
+     * into buf, which must have room for MAX_PACKET_SIZE bytes.
+     * @return the message length
+     */
+    unsigned encodePosMsg(int pilot, double time, char* buf) const;
+
+    /**
+     * Send the position messages which are due at the given time to all
+     * destinations. The pilots are staggered over the transmit interval,
+     * so calling this often gives a smooth packet rate.
+     * @return the number of messages encoded
+     */
+    int sendDue(double time, simgear::Socket& socket,
+                const std::vector<simgear::IPAddress>& destinations);
+
+private:
+    struct Pilot;
+
+    void selectProperties(Pilot& pilot, unsigned& rng) const;
+
+    Options _options;
+    std::vector<Pilot> _pilots;
+};
@@ -64,6 +64,8 @@ const uint32_t PROTO_VER = 0x00010001;  // 1.1
 #define MAX_CHAT_MSG_LEN        256
 #define MAX_MODEL_NAME_LEN      96
 #define MAX_PROPERTY_LEN        52
+#define MAX_PACKET_SIZE         1200
+#define MAX_TEXT_SIZE           768 // Increased for 2017.3 to allow for long Emesary messages.
 
 // Header for use with all messages sent 
 struct T_MsgHdr {
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileName: mpproperties.hxx
+ * SPDX-FileComment: the table of properties carried by multiplayer position messages
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <simgear/props/props.hxx>
+
+#include "mpmessages.hxx"
+
+/*
+ * With the MP2017(V2) protocol it is possible to transmit using a different type/encoding than the property has,
+ * for example a 32 bit int can be transmitted as a 16bit short int or a float transmitted in 16bits with appropriate precision.
+ * The TransmissionType defines how a property should be transmitted.
+ */
+enum TransmissionType {
+    TT_ASIS = 0, // transmit as defined in the property. This is the default
+    TT_BOOL = simgear::props::BOOL,
+    TT_INT = simgear::props::INT,
+    TT_FLOAT = simgear::props::FLOAT,
+    TT_STRING = simgear::props::STRING,
+    TT_SHORTINT = 0x100,
+    TT_SHORT_FLOAT_NORM = 0x101, // -1 .. 1 encoded into a short int (16 bit)
+    TT_SHORT_FLOAT_1 = 0x102, //range -3276.7 .. 3276.7  float encoded into a short int (16 bit)
+    TT_SHORT_FLOAT_2 = 0x103, //range -327.67 .. 327.67  float encoded into a short int (16 bit)
+    TT_SHORT_FLOAT_3 = 0x104, //range -32.767 .. 32.767  float encoded into a short int (16 bit)
+    TT_SHORT_FLOAT_4 = 0x105, //range -3.2767 .. 3.2767  float encoded into a short int (16 bit)
+    TT_BOOLARRAY,
+    TT_CHAR,
+    TT_NOSEND, // Do not send this property - probably the receive element for a custom encoded property
+};
+/*
+ * Definitions for the version of the protocol to use to transmit the items defined in the IdPropertyList
+ *
+ * The MP2017(V2) protocol allows for much better packing of strings, new types that are transmitted in 4bytes by transmitting
+ * with short int (sometimes scaled) for the values (a lot of the properties that are transmitted will pack nicely into 16bits).
+ * The MP2017(V2) protocol also allows for properties to be transmitted automatically as a different type and the encode/decode will
+ * take this into consideration.
+ * The pad magic is used to force older clients to use verifyProperties and as the first property transmitted is short int encoded it
+ * will cause the rest of the packet to be discarded. This is the section of the packet that contains the properties defined in the list
+ * here - the basic motion properties remain compatible, so the older client will see just the model, not chat, not animations etc.
+ * The lower 16 bits of the prop_id (version) are the version and the upper 16bits are for meta data.
+ */
+const int V1_1_PROP_ID = 1;
+const int V1_1_2_PROP_ID = 2;
+const int V2_PROP_ID_PROTOCOL = 0x10001;
+
+const int V2_PAD_MAGIC = 0x1face002;
+
+/*
+ * boolean arrays are transmitted in blocks of 31 mapping to a single int.
+ * These parameters define where these are mapped and how they are sent.
+ * The blocks should be in the same property range (with no other properties inside the range)
+ * The blocksize is set to 40 to allow for ints being 32 bits, so block 0 will be 0..30 (31 bits)
+ */
+const int BOOLARRAY_BLOCKSIZE = 40;
+
+const int BOOLARRAY_BASE_1 = 11000;
+const int BOOLARRAY_BASE_2 = BOOLARRAY_BASE_1 + BOOLARRAY_BLOCKSIZE;
+const int BOOLARRAY_BASE_3 = BOOLARRAY_BASE_2 + BOOLARRAY_BLOCKSIZE;
+// define range of bool values for receive.
+const int BOOLARRAY_START_ID = BOOLARRAY_BASE_1;
+const int BOOLARRAY_END_ID = BOOLARRAY_BASE_3;
+// Transmission uses a buffer to build the value for each array block.
+const int MAX_BOOL_BUFFERS = 3;
+
+// starting with 2018.1 we will now append new properties for each version at the end of the list - as this provides much
+// better backwards compatibility.
+const int V2018_1_BASE = 11990;
+const int EMESARYBRIDGETYPE_BASE = 12200;
+const int EMESARYBRIDGE_BASE = 12000;
+const int V2018_3_BASE = 13000;
+const int FALLBACK_MODEL_ID = 13000;
+const int V2019_3_BASE = 13001;
+const int V2020_4_BASE = 13003;
+
+/*
+ * definition of properties that are to be transmitted.
+ * New for 2017.2:
+ * 1. TransmitAs - this causes the property to be transmitted on the wire using the
+ *    specified format transparently.
+ * 2. version - the minimum version of the protocol that is required to transmit a property.
+ *    Does not apply to incoming properties - as these will be decoded correctly when received
+ * 3. encode_for_transmit  - method that will convert from and to the packet for the value
+ *    Allows specific conversion rules to be applied; such as conversion of a string to an integer for transmission.
+ * 4. decode_received - decodes received data
+ * - when using the encode/decode methods there should be both specified, however if the result of the encode
+ *   is to transmit in a different property index the encode/decode will be on different elements in the property id list.
+ *   This is used to encode/decode the launchbar state - so that with 2017.2 instead of the string being transmitted in property 108
+ *   a short int encoded version is sent in property 120 - which when received will be placed into property 108. This reduces transmission space
+ *   and keeps compatibility.
+ */
+struct IdPropertyList {
+    unsigned id;
+    const char* name;
+    simgear::props::Type type;
+    TransmissionType TransmitAs;
+    int version;
+    xdr_data_t* (*encode_for_transmit)(const IdPropertyList *propDef, const xdr_data_t*, FGPropertyData*);
+    xdr_data_t* (*decode_received)(const IdPropertyList *propDef, const xdr_data_t*, FGPropertyData*);
+};
+
+// A static map of protocol property id values to property paths, sorted by id.
+extern const IdPropertyList sIdPropertyList[];
+extern const unsigned int numProperties;
+
+// Look up a property ID using binary search.
+const IdPropertyList* findProperty(unsigned id);
+
+/*
+ * Check that the property list in [data, end) only contains known property
+ * ids with sane values; used to guess the layout of packets from old clients.
+ */
+bool verifyProperties(const xdr_data_t* data, const xdr_data_t* end);
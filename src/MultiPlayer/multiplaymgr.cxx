@@ -32,6 +32,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cstring>
+#include <atomic>
 #include <errno.h>
 #include <memory>
 
@@ -44,6 +45,7 @@
 #include <simgear/props/props_io.hxx>
 #include <simgear/structure/commands.hxx>
 #include <simgear/structure/event_mgr.hxx>
+#include <simgear/threads/SGThread.hxx>
 #include <simgear/timing/timestamp.hxx>
 
 #include <AIModel/AIManager.hxx>
@@ -51,116 +53,25 @@
 #include <Main/fg_props.hxx>
 #include "multiplaymgr.hxx"
 #include "mpmessages.hxx"
+#include "mpproperties.hxx"
 #include "MPServerResolver.hxx"
 #include <FDM/fdm_shell.hxx>
 #include <FDM/flightProperties.hxx>
 #include <Time/TimeManager.hxx>
 #include <Main/sentryIntegration.hxx>
+#include <Main/SPSCQueue.hxx>
 #include "mpirc.hxx"
 #include "cpdlc.hxx"
 
 #if defined(_MSC_VER) || defined(__MINGW32__)
 #include <WS2tcpip.h>
 #endif
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
 using namespace std;
 
 
-#define MAX_PACKET_SIZE 1200
-#define MAX_TEXT_SIZE 768 // Increased for 2017.3 to allow for long Emesary messages.
-/*
- * With the MP2017(V2) protocol it is possible to transmit using a different type/encoding than the property has,
- * for example a 32 bit int can be transmitted as a 16bit short int or a float transmitted in 16bits with appropriate precision.
- * The TransmissionType defines how a property should be transmitted.
- */
-enum TransmissionType {
-    TT_ASIS = 0, // transmit as defined in the property. This is the default
-    TT_BOOL = simgear::props::BOOL,
-    TT_INT = simgear::props::INT,
-    TT_FLOAT = simgear::props::FLOAT,
-    TT_STRING = simgear::props::STRING,
-    TT_SHORTINT = 0x100,
-    TT_SHORT_FLOAT_NORM = 0x101, // -1 .. 1 encoded into a short int (16 bit)
-    TT_SHORT_FLOAT_1 = 0x102, //range -3276.7 .. 3276.7  float encoded into a short int (16 bit)
-    TT_SHORT_FLOAT_2 = 0x103, //range -327.67 .. 327.67  float encoded into a short int (16 bit)
-    TT_SHORT_FLOAT_3 = 0x104, //range -32.767 .. 32.767  float encoded into a short int (16 bit)
-    TT_SHORT_FLOAT_4 = 0x105, //range -3.2767 .. 3.2767  float encoded into a short int (16 bit)
-    TT_BOOLARRAY,
-    TT_CHAR,
-    TT_NOSEND, // Do not send this property - probably the receive element for a custom encoded property
-};
-/*
- * Definitions for the version of the protocol to use to transmit the items defined in the IdPropertyList
- *
- * The MP2017(V2) protocol allows for much better packing of strings, new types that are transmitted in 4bytes by transmitting
- * with short int (sometimes scaled) for the values (a lot of the properties that are transmitted will pack nicely into 16bits).
- * The MP2017(V2) protocol also allows for properties to be transmitted automatically as a different type and the encode/decode will
- * take this into consideration.
- * The pad magic is used to force older clients to use verifyProperties and as the first property transmitted is short int encoded it
- * will cause the rest of the packet to be discarded. This is the section of the packet that contains the properties defined in the list
- * here - the basic motion properties remain compatible, so the older client will see just the model, not chat, not animations etc.
- * The lower 16 bits of the prop_id (version) are the version and the upper 16bits are for meta data.
- */
-const int V1_1_PROP_ID = 1;
-const int V1_1_2_PROP_ID = 2;
-const int V2_PROP_ID_PROTOCOL = 0x10001;
-
-const int V2_PAD_MAGIC = 0x1face002;
-
-/*
- * boolean arrays are transmitted in blocks of 31 mapping to a single int.
- * These parameters define where these are mapped and how they are sent.
- * The blocks should be in the same property range (with no other properties inside the range)
- * The blocksize is set to 40 to allow for ints being 32 bits, so block 0 will be 0..30 (31 bits)
- */
-const int BOOLARRAY_BLOCKSIZE = 40;
-
-const int BOOLARRAY_BASE_1 = 11000;
-const int BOOLARRAY_BASE_2 = BOOLARRAY_BASE_1 + BOOLARRAY_BLOCKSIZE;
-const int BOOLARRAY_BASE_3 = BOOLARRAY_BASE_2 + BOOLARRAY_BLOCKSIZE;
-// define range of bool values for receive.
-const int BOOLARRAY_START_ID = BOOLARRAY_BASE_1;
-const int BOOLARRAY_END_ID = BOOLARRAY_BASE_3;
-// Transmission uses a buffer to build the value for each array block.
-const int MAX_BOOL_BUFFERS = 3;
-
-// starting with 2018.1 we will now append new properties for each version at the end of the list - as this provides much
-// better backwards compatibility.
-const int V2018_1_BASE = 11990;
-const int EMESARYBRIDGETYPE_BASE = 12200;
-const int EMESARYBRIDGE_BASE = 12000;
-const int V2018_3_BASE = 13000;
-const int FALLBACK_MODEL_ID = 13000;
-const int V2019_3_BASE = 13001;
-const int V2020_4_BASE = 13003;
-
-/*
- * definition of properties that are to be transmitted.
- * New for 2017.2:
- * 1. TransmitAs - this causes the property to be transmitted on the wire using the
- *    specified format transparently.
- * 2. version - the minimum version of the protocol that is required to transmit a property.
- *    Does not apply to incoming properties - as these will be decoded correctly when received
- * 3. encode_for_transmit  - method that will convert from and to the packet for the value
- *    Allows specific conversion rules to be applied; such as conversion of a string to an integer for transmission.
- * 4. decode_received - decodes received data
- * - when using the encode/decode methods there should be both specified, however if the result of the encode
- *   is to transmit in a different property index the encode/decode will be on different elements in the property id list.
- *   This is used to encode/decode the launchbar state - so that with 2017.2 instead of the string being transmitted in property 108
- *   a short int encoded version is sent in property 120 - which when received will be placed into property 108. This reduces transmission space
- *   and keeps compatibility.
- */
-struct IdPropertyList {
-    unsigned id;
-    const char* name;
-    simgear::props::Type type;
-    TransmissionType TransmitAs;
-    int version;
-    xdr_data_t* (*encode_for_transmit)(const IdPropertyList *propDef, const xdr_data_t*, FGPropertyData*);
-    xdr_data_t* (*decode_received)(const IdPropertyList *propDef, const xdr_data_t*, FGPropertyData*);
-};
-
-static const IdPropertyList* findProperty(unsigned id);
-
 /*
  * intermediate buffer used to build the ints that will be transmitted for the boolean arrays
  */
@@ -169,518 +80,6 @@ struct BoolArrayBuffer {
     int boolValue;
 };
 
-static xdr_data_t *encode_launchbar_state_for_transmission(const IdPropertyList *propDef, const xdr_data_t *_xdr, FGPropertyData*p)
-{
-    xdr_data_t *xdr = (xdr_data_t *)_xdr;
-
-    if (propDef->TransmitAs == TT_NOSEND)
-        return xdr;
-
-    int v = -1;
-    if (p && p->string_value)
-    {
-        if (!strcmp("Engaged", p->string_value))
-            v = 0;
-        else if (!strcmp("Launching", p->string_value))
-            v = 1;
-        else if (!strcmp("Completed", p->string_value))
-            v = 2;
-        else if (!strcmp("Disengaged", p->string_value))
-            v = 3;
-        else
-            return (xdr_data_t*)xdr;
-
-        *xdr++ = XDR_encode_shortints32(120, v);
-    }
-    return xdr;
-}
-
-static xdr_data_t *decode_received_launchbar_state(const IdPropertyList *propDef, const xdr_data_t *_xdr, FGPropertyData*p)
-{
-    xdr_data_t *xdr = (xdr_data_t *)_xdr;
-
-    int v1, v2;
-    XDR_decode_shortints32(*xdr, v1, v2);
-    xdr++;
-    const char *stringvalue = "";
-    switch (v2)
-    {
-    case 0: stringvalue = "Engaged"; break;
-    case 1: stringvalue = "Launching"; break;
-    case 2: stringvalue = "Completed"; break;
-    case 3: stringvalue = "Disengaged"; break;
-    }
-
-    p->id = 108; // this is for the string property for gear/launchbar/state
-    if (p->string_value && p->type == simgear::props::STRING)
-        delete[] p->string_value;
-    p->string_value = new char[strlen(stringvalue) + 1];
-    strcpy(p->string_value, stringvalue);
-    p->type = simgear::props::STRING;
-    return xdr;
-}
-
-// A static map of protocol property id values to property paths,
-// This should be extendable dynamically for every specific aircraft ...
-// For now only that static list
-static const IdPropertyList sIdPropertyList[] = {
-    { 10,  "sim/multiplay/protocol-version",          simgear::props::INT,   TT_SHORTINT,  V2_PROP_ID_PROTOCOL, NULL, NULL },
-    { 100, "surface-positions/left-aileron-pos-norm",  simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 101, "surface-positions/right-aileron-pos-norm", simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 102, "surface-positions/elevator-pos-norm",      simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 103, "surface-positions/rudder-pos-norm",        simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 104, "surface-positions/flap-pos-norm",          simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 105, "surface-positions/speedbrake-pos-norm",    simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 106, "gear/tailhook/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 107, "gear/launchbar/position-norm",             simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    //
-    { 108, "gear/launchbar/state",                     simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, encode_launchbar_state_for_transmission, NULL },
-    { 109, "gear/launchbar/holdback-position-norm",    simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 110, "canopy/position-norm",                     simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 111, "surface-positions/wing-pos-norm",          simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 112, "surface-positions/wing-fold-pos-norm",     simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-
-    // to enable decoding this is the transient ID record that is in the packet. This is not sent directly - instead it is the result
-    // of the conversion of property 108.
-    { 120, "gear/launchbar/state-value",               simgear::props::INT, TT_NOSEND,  V1_1_2_PROP_ID, NULL, decode_received_launchbar_state },
-
-    { 200, "gear/gear[0]/compression-norm",           simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 201, "gear/gear[0]/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 210, "gear/gear[1]/compression-norm",           simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 211, "gear/gear[1]/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 220, "gear/gear[2]/compression-norm",           simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 221, "gear/gear[2]/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 230, "gear/gear[3]/compression-norm",           simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 231, "gear/gear[3]/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 240, "gear/gear[4]/compression-norm",           simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-    { 241, "gear/gear[4]/position-norm",              simgear::props::FLOAT, TT_SHORT_FLOAT_NORM,  V1_1_PROP_ID, NULL, NULL },
-
-    { 300, "engines/engine[0]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 301, "engines/engine[0]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 302, "engines/engine[0]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 310, "engines/engine[1]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 311, "engines/engine[1]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 312, "engines/engine[1]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 320, "engines/engine[2]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 321, "engines/engine[2]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 322, "engines/engine[2]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 330, "engines/engine[3]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 331, "engines/engine[3]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 332, "engines/engine[3]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 340, "engines/engine[4]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 341, "engines/engine[4]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 342, "engines/engine[4]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 350, "engines/engine[5]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 351, "engines/engine[5]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 352, "engines/engine[5]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 360, "engines/engine[6]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 361, "engines/engine[6]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 362, "engines/engine[6]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 370, "engines/engine[7]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 371, "engines/engine[7]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 372, "engines/engine[7]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 380, "engines/engine[8]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 381, "engines/engine[8]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 382, "engines/engine[8]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 390, "engines/engine[9]/n1",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 391, "engines/engine[9]/n2",  simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 392, "engines/engine[9]/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-
-    { 800, "rotors/main/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 801, "rotors/tail/rpm", simgear::props::FLOAT, TT_SHORT_FLOAT_1,  V1_1_PROP_ID, NULL, NULL },
-    { 810, "rotors/main/blade[0]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 811, "rotors/main/blade[1]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 812, "rotors/main/blade[2]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 813, "rotors/main/blade[3]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 820, "rotors/main/blade[0]/flap-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 821, "rotors/main/blade[1]/flap-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 822, "rotors/main/blade[2]/flap-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 823, "rotors/main/blade[3]/flap-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 830, "rotors/tail/blade[0]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 831, "rotors/tail/blade[1]/position-deg",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-
-    { 900, "sim/hitches/aerotow/tow/length",                       simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 901, "sim/hitches/aerotow/tow/elastic-constant",             simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 902, "sim/hitches/aerotow/tow/weight-per-m-kg-m",            simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 903, "sim/hitches/aerotow/tow/dist",                         simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 904, "sim/hitches/aerotow/tow/connected-to-property-node",   simgear::props::BOOL, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 905, "sim/hitches/aerotow/tow/connected-to-ai-or-mp-callsign",   simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 906, "sim/hitches/aerotow/tow/break-force",                  simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 907, "sim/hitches/aerotow/tow/end-force-x",                  simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 908, "sim/hitches/aerotow/tow/end-force-y",                  simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 909, "sim/hitches/aerotow/tow/end-force-z",                  simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 930, "sim/hitches/aerotow/is-slave",                         simgear::props::BOOL, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 931, "sim/hitches/aerotow/speed-in-tow-direction",           simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 932, "sim/hitches/aerotow/open",                             simgear::props::BOOL, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 933, "sim/hitches/aerotow/local-pos-x",                      simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 934, "sim/hitches/aerotow/local-pos-y",                      simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 935, "sim/hitches/aerotow/local-pos-z",                      simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-
-    { 1001, "controls/flight/slats",  simgear::props::FLOAT, TT_SHORT_FLOAT_4,  V1_1_PROP_ID, NULL, NULL },
-    { 1002, "controls/flight/speedbrake",  simgear::props::FLOAT, TT_SHORT_FLOAT_4,  V1_1_PROP_ID, NULL, NULL },
-    { 1003, "controls/flight/spoilers",  simgear::props::FLOAT, TT_SHORT_FLOAT_4,  V1_1_PROP_ID, NULL, NULL },
-    { 1004, "controls/gear/gear-down",  simgear::props::FLOAT, TT_SHORT_FLOAT_4,  V1_1_PROP_ID, NULL, NULL },
-    { 1005, "controls/lighting/nav-lights",  simgear::props::FLOAT, TT_SHORT_FLOAT_3,  V1_1_PROP_ID, NULL, NULL },
-    { 1006, "controls/armament/station[0]/jettison-all",  simgear::props::BOOL, TT_SHORTINT,  V1_1_PROP_ID, NULL, NULL },
-
-    { 1100, "sim/model/variant", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 1101, "sim/model/livery/file", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { 1200, "environment/wildfire/data", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 1201, "environment/contrail", simgear::props::INT, TT_SHORTINT,  V1_1_PROP_ID, NULL, NULL },
-
-    { 1300, "tanker", simgear::props::INT, TT_SHORTINT,  V1_1_PROP_ID, NULL, NULL },
-
-    { 1400, "scenery/events", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { 1500, "instrumentation/transponder/transmitted-id", simgear::props::INT, TT_SHORTINT,  V1_1_PROP_ID, NULL, NULL },
-    { 1501, "instrumentation/transponder/altitude", simgear::props::INT, TT_ASIS, V1_1_PROP_ID, NULL, NULL },
-    { 1502, "instrumentation/transponder/ident", simgear::props::BOOL, TT_SHORTINT, V1_1_PROP_ID, NULL, NULL },
-    { 1503, "instrumentation/transponder/inputs/mode", simgear::props::INT, TT_SHORTINT, V1_1_PROP_ID, NULL, NULL },
-    { 1504, "instrumentation/transponder/ground-bit", simgear::props::BOOL, TT_SHORTINT, V1_1_2_PROP_ID, NULL, NULL },
-    { 1505, "instrumentation/transponder/airspeed-kt", simgear::props::INT, TT_SHORTINT, V1_1_2_PROP_ID, NULL, NULL },
-
-    { 10001, "sim/multiplay/transmission-freq-hz",  simgear::props::STRING, TT_NOSEND,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10002, "sim/multiplay/chat",  simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { 10100, "sim/multiplay/generic/string[0]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10101, "sim/multiplay/generic/string[1]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10102, "sim/multiplay/generic/string[2]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10103, "sim/multiplay/generic/string[3]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10104, "sim/multiplay/generic/string[4]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10105, "sim/multiplay/generic/string[5]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10106, "sim/multiplay/generic/string[6]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10107, "sim/multiplay/generic/string[7]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10108, "sim/multiplay/generic/string[8]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10109, "sim/multiplay/generic/string[9]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10110, "sim/multiplay/generic/string[10]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10111, "sim/multiplay/generic/string[11]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10112, "sim/multiplay/generic/string[12]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10113, "sim/multiplay/generic/string[13]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10114, "sim/multiplay/generic/string[14]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10115, "sim/multiplay/generic/string[15]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10116, "sim/multiplay/generic/string[16]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10117, "sim/multiplay/generic/string[17]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10118, "sim/multiplay/generic/string[18]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10119, "sim/multiplay/generic/string[19]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { 10200, "sim/multiplay/generic/float[0]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10201, "sim/multiplay/generic/float[1]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10202, "sim/multiplay/generic/float[2]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10203, "sim/multiplay/generic/float[3]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10204, "sim/multiplay/generic/float[4]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10205, "sim/multiplay/generic/float[5]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10206, "sim/multiplay/generic/float[6]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10207, "sim/multiplay/generic/float[7]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10208, "sim/multiplay/generic/float[8]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10209, "sim/multiplay/generic/float[9]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10210, "sim/multiplay/generic/float[10]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10211, "sim/multiplay/generic/float[11]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10212, "sim/multiplay/generic/float[12]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10213, "sim/multiplay/generic/float[13]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10214, "sim/multiplay/generic/float[14]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10215, "sim/multiplay/generic/float[15]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10216, "sim/multiplay/generic/float[16]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10217, "sim/multiplay/generic/float[17]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10218, "sim/multiplay/generic/float[18]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10219, "sim/multiplay/generic/float[19]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-
-    { 10220, "sim/multiplay/generic/float[20]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10221, "sim/multiplay/generic/float[21]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10222, "sim/multiplay/generic/float[22]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10223, "sim/multiplay/generic/float[23]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10224, "sim/multiplay/generic/float[24]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10225, "sim/multiplay/generic/float[25]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10226, "sim/multiplay/generic/float[26]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10227, "sim/multiplay/generic/float[27]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10228, "sim/multiplay/generic/float[28]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10229, "sim/multiplay/generic/float[29]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10230, "sim/multiplay/generic/float[30]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10231, "sim/multiplay/generic/float[31]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10232, "sim/multiplay/generic/float[32]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10233, "sim/multiplay/generic/float[33]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10234, "sim/multiplay/generic/float[34]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10235, "sim/multiplay/generic/float[35]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10236, "sim/multiplay/generic/float[36]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10237, "sim/multiplay/generic/float[37]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10238, "sim/multiplay/generic/float[38]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10239, "sim/multiplay/generic/float[39]", simgear::props::FLOAT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-
-    { 10300, "sim/multiplay/generic/int[0]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10301, "sim/multiplay/generic/int[1]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10302, "sim/multiplay/generic/int[2]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10303, "sim/multiplay/generic/int[3]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10304, "sim/multiplay/generic/int[4]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10305, "sim/multiplay/generic/int[5]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10306, "sim/multiplay/generic/int[6]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10307, "sim/multiplay/generic/int[7]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10308, "sim/multiplay/generic/int[8]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10309, "sim/multiplay/generic/int[9]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10310, "sim/multiplay/generic/int[10]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10311, "sim/multiplay/generic/int[11]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10312, "sim/multiplay/generic/int[12]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10313, "sim/multiplay/generic/int[13]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10314, "sim/multiplay/generic/int[14]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10315, "sim/multiplay/generic/int[15]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10316, "sim/multiplay/generic/int[16]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10317, "sim/multiplay/generic/int[17]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10318, "sim/multiplay/generic/int[18]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-    { 10319, "sim/multiplay/generic/int[19]", simgear::props::INT, TT_ASIS,  V1_1_PROP_ID, NULL, NULL },
-
-    { 10500, "sim/multiplay/generic/short[0]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10501, "sim/multiplay/generic/short[1]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10502, "sim/multiplay/generic/short[2]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10503, "sim/multiplay/generic/short[3]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10504, "sim/multiplay/generic/short[4]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10505, "sim/multiplay/generic/short[5]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10506, "sim/multiplay/generic/short[6]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10507, "sim/multiplay/generic/short[7]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10508, "sim/multiplay/generic/short[8]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10509, "sim/multiplay/generic/short[9]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10510, "sim/multiplay/generic/short[10]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10511, "sim/multiplay/generic/short[11]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10512, "sim/multiplay/generic/short[12]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10513, "sim/multiplay/generic/short[13]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10514, "sim/multiplay/generic/short[14]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10515, "sim/multiplay/generic/short[15]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10516, "sim/multiplay/generic/short[16]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10517, "sim/multiplay/generic/short[17]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10518, "sim/multiplay/generic/short[18]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10519, "sim/multiplay/generic/short[19]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10520, "sim/multiplay/generic/short[20]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10521, "sim/multiplay/generic/short[21]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10522, "sim/multiplay/generic/short[22]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10523, "sim/multiplay/generic/short[23]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10524, "sim/multiplay/generic/short[24]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10525, "sim/multiplay/generic/short[25]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10526, "sim/multiplay/generic/short[26]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10527, "sim/multiplay/generic/short[27]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10528, "sim/multiplay/generic/short[28]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10529, "sim/multiplay/generic/short[29]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10530, "sim/multiplay/generic/short[30]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10531, "sim/multiplay/generic/short[31]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10532, "sim/multiplay/generic/short[32]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10533, "sim/multiplay/generic/short[33]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10534, "sim/multiplay/generic/short[34]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10535, "sim/multiplay/generic/short[35]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10536, "sim/multiplay/generic/short[36]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10537, "sim/multiplay/generic/short[37]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10538, "sim/multiplay/generic/short[38]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10539, "sim/multiplay/generic/short[39]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10540, "sim/multiplay/generic/short[40]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10541, "sim/multiplay/generic/short[41]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10542, "sim/multiplay/generic/short[42]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10543, "sim/multiplay/generic/short[43]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10544, "sim/multiplay/generic/short[44]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10545, "sim/multiplay/generic/short[45]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10546, "sim/multiplay/generic/short[46]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10547, "sim/multiplay/generic/short[47]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10548, "sim/multiplay/generic/short[48]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10549, "sim/multiplay/generic/short[49]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10550, "sim/multiplay/generic/short[50]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10551, "sim/multiplay/generic/short[51]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10552, "sim/multiplay/generic/short[52]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10553, "sim/multiplay/generic/short[53]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10554, "sim/multiplay/generic/short[54]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10555, "sim/multiplay/generic/short[55]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10556, "sim/multiplay/generic/short[56]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10557, "sim/multiplay/generic/short[57]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10558, "sim/multiplay/generic/short[58]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10559, "sim/multiplay/generic/short[59]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10560, "sim/multiplay/generic/short[60]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10561, "sim/multiplay/generic/short[61]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10562, "sim/multiplay/generic/short[62]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10563, "sim/multiplay/generic/short[63]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10564, "sim/multiplay/generic/short[64]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10565, "sim/multiplay/generic/short[65]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10566, "sim/multiplay/generic/short[66]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10567, "sim/multiplay/generic/short[67]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10568, "sim/multiplay/generic/short[68]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10569, "sim/multiplay/generic/short[69]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10570, "sim/multiplay/generic/short[70]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10571, "sim/multiplay/generic/short[71]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10572, "sim/multiplay/generic/short[72]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10573, "sim/multiplay/generic/short[73]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10574, "sim/multiplay/generic/short[74]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10575, "sim/multiplay/generic/short[75]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10576, "sim/multiplay/generic/short[76]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10577, "sim/multiplay/generic/short[77]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10578, "sim/multiplay/generic/short[78]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { 10579, "sim/multiplay/generic/short[79]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { BOOLARRAY_BASE_1 +  0, "sim/multiplay/generic/bool[0]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  1, "sim/multiplay/generic/bool[1]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  2, "sim/multiplay/generic/bool[2]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  3, "sim/multiplay/generic/bool[3]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  4, "sim/multiplay/generic/bool[4]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  5, "sim/multiplay/generic/bool[5]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  6, "sim/multiplay/generic/bool[6]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  7, "sim/multiplay/generic/bool[7]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  8, "sim/multiplay/generic/bool[8]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 +  9, "sim/multiplay/generic/bool[9]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 10, "sim/multiplay/generic/bool[10]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 11, "sim/multiplay/generic/bool[11]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 12, "sim/multiplay/generic/bool[12]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 13, "sim/multiplay/generic/bool[13]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 14, "sim/multiplay/generic/bool[14]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 15, "sim/multiplay/generic/bool[15]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 16, "sim/multiplay/generic/bool[16]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 17, "sim/multiplay/generic/bool[17]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 18, "sim/multiplay/generic/bool[18]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 19, "sim/multiplay/generic/bool[19]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 20, "sim/multiplay/generic/bool[20]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 21, "sim/multiplay/generic/bool[21]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 22, "sim/multiplay/generic/bool[22]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 23, "sim/multiplay/generic/bool[23]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 24, "sim/multiplay/generic/bool[24]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 25, "sim/multiplay/generic/bool[25]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 26, "sim/multiplay/generic/bool[26]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 27, "sim/multiplay/generic/bool[27]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 28, "sim/multiplay/generic/bool[28]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 29, "sim/multiplay/generic/bool[29]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_1 + 30, "sim/multiplay/generic/bool[30]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { BOOLARRAY_BASE_2 + 0, "sim/multiplay/generic/bool[31]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 1, "sim/multiplay/generic/bool[32]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 2, "sim/multiplay/generic/bool[33]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 3, "sim/multiplay/generic/bool[34]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 4, "sim/multiplay/generic/bool[35]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 5, "sim/multiplay/generic/bool[36]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 6, "sim/multiplay/generic/bool[37]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 7, "sim/multiplay/generic/bool[38]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 8, "sim/multiplay/generic/bool[39]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 9, "sim/multiplay/generic/bool[40]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 10, "sim/multiplay/generic/bool[41]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-        // out of sequence between the block and the buffer becuase of a typo. repurpose the first as that way [72] will work
-        // correctly on older versions.
-    { BOOLARRAY_BASE_2 + 11, "sim/multiplay/generic/bool[91]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 12, "sim/multiplay/generic/bool[42]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 13, "sim/multiplay/generic/bool[43]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 14, "sim/multiplay/generic/bool[44]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 15, "sim/multiplay/generic/bool[45]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 16, "sim/multiplay/generic/bool[46]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 17, "sim/multiplay/generic/bool[47]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 18, "sim/multiplay/generic/bool[48]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 19, "sim/multiplay/generic/bool[49]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 20, "sim/multiplay/generic/bool[50]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 21, "sim/multiplay/generic/bool[51]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 22, "sim/multiplay/generic/bool[52]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 23, "sim/multiplay/generic/bool[53]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 24, "sim/multiplay/generic/bool[54]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 25, "sim/multiplay/generic/bool[55]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 26, "sim/multiplay/generic/bool[56]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 27, "sim/multiplay/generic/bool[57]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 28, "sim/multiplay/generic/bool[58]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 29, "sim/multiplay/generic/bool[59]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_2 + 30, "sim/multiplay/generic/bool[60]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { BOOLARRAY_BASE_3 + 0, "sim/multiplay/generic/bool[61]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 1, "sim/multiplay/generic/bool[62]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 2, "sim/multiplay/generic/bool[63]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 3, "sim/multiplay/generic/bool[64]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 4, "sim/multiplay/generic/bool[65]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 5, "sim/multiplay/generic/bool[66]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 6, "sim/multiplay/generic/bool[67]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 7, "sim/multiplay/generic/bool[68]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 8, "sim/multiplay/generic/bool[69]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 9, "sim/multiplay/generic/bool[70]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 10, "sim/multiplay/generic/bool[71]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-        // out of sequence between the block and the buffer becuase of a typo. repurpose the first as that way [72] will work
-        // correctly on older versions.
-    { BOOLARRAY_BASE_3 + 11, "sim/multiplay/generic/bool[92]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 12, "sim/multiplay/generic/bool[72]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 13, "sim/multiplay/generic/bool[73]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 14, "sim/multiplay/generic/bool[74]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 15, "sim/multiplay/generic/bool[75]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 16, "sim/multiplay/generic/bool[76]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 17, "sim/multiplay/generic/bool[77]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 18, "sim/multiplay/generic/bool[78]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 19, "sim/multiplay/generic/bool[79]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 20, "sim/multiplay/generic/bool[80]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 21, "sim/multiplay/generic/bool[81]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 22, "sim/multiplay/generic/bool[82]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 23, "sim/multiplay/generic/bool[83]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 24, "sim/multiplay/generic/bool[84]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 25, "sim/multiplay/generic/bool[85]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 26, "sim/multiplay/generic/bool[86]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 27, "sim/multiplay/generic/bool[87]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 28, "sim/multiplay/generic/bool[88]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 29, "sim/multiplay/generic/bool[89]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-    { BOOLARRAY_BASE_3 + 30, "sim/multiplay/generic/bool[90]", simgear::props::BOOL, TT_BOOLARRAY,  V1_1_2_PROP_ID, NULL, NULL },
-
-
-    { V2018_1_BASE + 0,  "sim/multiplay/mp-clock-mode", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-        // Direct support for emesary bridge properties. This is mainly to ensure that these properties do not overlap with the string
-        // properties; although the emesary bridge can use any string property.
-    { EMESARYBRIDGE_BASE + 0,  "sim/multiplay/emesary/bridge[0]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 1,  "sim/multiplay/emesary/bridge[1]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 2,  "sim/multiplay/emesary/bridge[2]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 3,  "sim/multiplay/emesary/bridge[3]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 4,  "sim/multiplay/emesary/bridge[4]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 5,  "sim/multiplay/emesary/bridge[5]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 6,  "sim/multiplay/emesary/bridge[6]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 7,  "sim/multiplay/emesary/bridge[7]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 8,  "sim/multiplay/emesary/bridge[8]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 9,  "sim/multiplay/emesary/bridge[9]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 10, "sim/multiplay/emesary/bridge[10]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 11, "sim/multiplay/emesary/bridge[11]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 12, "sim/multiplay/emesary/bridge[12]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 13, "sim/multiplay/emesary/bridge[13]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 14, "sim/multiplay/emesary/bridge[14]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 15, "sim/multiplay/emesary/bridge[15]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 16, "sim/multiplay/emesary/bridge[16]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 17, "sim/multiplay/emesary/bridge[17]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 18, "sim/multiplay/emesary/bridge[18]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 19, "sim/multiplay/emesary/bridge[19]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 20, "sim/multiplay/emesary/bridge[20]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 21, "sim/multiplay/emesary/bridge[21]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 22, "sim/multiplay/emesary/bridge[22]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 23, "sim/multiplay/emesary/bridge[23]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 24, "sim/multiplay/emesary/bridge[24]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 25, "sim/multiplay/emesary/bridge[25]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 26, "sim/multiplay/emesary/bridge[26]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 27, "sim/multiplay/emesary/bridge[27]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 28, "sim/multiplay/emesary/bridge[28]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGE_BASE + 29, "sim/multiplay/emesary/bridge[29]", simgear::props::STRING, TT_ASIS,  V1_1_2_PROP_ID, NULL, NULL },
-
-        // To allow the bridge to identify itself and allow quick filtering based on type/ID.
-    { EMESARYBRIDGETYPE_BASE + 0,  "sim/multiplay/emesary/bridge-type[0]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 1,  "sim/multiplay/emesary/bridge-type[1]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 2,  "sim/multiplay/emesary/bridge-type[2]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 3,  "sim/multiplay/emesary/bridge-type[3]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 4,  "sim/multiplay/emesary/bridge-type[4]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 5,  "sim/multiplay/emesary/bridge-type[5]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 6,  "sim/multiplay/emesary/bridge-type[6]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 7,  "sim/multiplay/emesary/bridge-type[7]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 8,  "sim/multiplay/emesary/bridge-type[8]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 9,  "sim/multiplay/emesary/bridge-type[9]",  simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 10, "sim/multiplay/emesary/bridge-type[10]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 11, "sim/multiplay/emesary/bridge-type[11]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 12, "sim/multiplay/emesary/bridge-type[12]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 13, "sim/multiplay/emesary/bridge-type[13]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 14, "sim/multiplay/emesary/bridge-type[14]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 15, "sim/multiplay/emesary/bridge-type[15]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 16, "sim/multiplay/emesary/bridge-type[16]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 17, "sim/multiplay/emesary/bridge-type[17]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 18, "sim/multiplay/emesary/bridge-type[18]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 19, "sim/multiplay/emesary/bridge-type[19]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 20, "sim/multiplay/emesary/bridge-type[20]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 21, "sim/multiplay/emesary/bridge-type[21]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 22, "sim/multiplay/emesary/bridge-type[22]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 23, "sim/multiplay/emesary/bridge-type[23]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 24, "sim/multiplay/emesary/bridge-type[24]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 25, "sim/multiplay/emesary/bridge-type[25]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 26, "sim/multiplay/emesary/bridge-type[26]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 27, "sim/multiplay/emesary/bridge-type[27]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 28, "sim/multiplay/emesary/bridge-type[28]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { EMESARYBRIDGETYPE_BASE + 29, "sim/multiplay/emesary/bridge-type[29]", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-
-    { FALLBACK_MODEL_ID, "sim/model/fallback-model-index", simgear::props::INT, TT_SHORTINT,  V1_1_2_PROP_ID, NULL, NULL },
-    { V2019_3_BASE,   "sim/multiplay/comm-transmit-frequency-hz", simgear::props::INT, TT_INT,  V1_1_2_PROP_ID, NULL, NULL },
-    { V2019_3_BASE+1, "sim/multiplay/comm-transmit-power-norm", simgear::props::INT, TT_SHORT_FLOAT_NORM ,  V1_1_2_PROP_ID, NULL, NULL },
-    // Add new MP properties here
-    { V2020_4_BASE, "instrumentation/transponder/mach-number", simgear::props::FLOAT, TT_SHORT_FLOAT_4, V1_1_2_PROP_ID, NULL, NULL },
-};
 /*
  * For the 2017.x version 2 protocol the properties are sent in two partitions,
  * the first of these is a V1 protocol packet (which should be fine with all clients), and a V2 partition
@@ -689,110 +88,6 @@ static const IdPropertyList sIdPropertyList[] = {
  * first V2 property based on ID.
  */
 const int MAX_PARTITIONS = 2;
-const unsigned int numProperties = (sizeof(sIdPropertyList) / sizeof(sIdPropertyList[0]));
-
-// Look up a property ID using binary search.
-namespace
-{
-  struct ComparePropertyId
-  {
-    bool operator()(const IdPropertyList& lhs,
-                    const IdPropertyList& rhs)
-    {
-      return lhs.id < rhs.id;
-    }
-    bool operator()(const IdPropertyList& lhs,
-                    unsigned id)
-    {
-      return lhs.id < id;
-    }
-    bool operator()(unsigned id,
-                    const IdPropertyList& rhs)
-    {
-      return id < rhs.id;
-    }
-  };
-}
-
-const IdPropertyList* findProperty(unsigned id)
-{
-  std::pair<const IdPropertyList*, const IdPropertyList*> result
-    = std::equal_range(sIdPropertyList, sIdPropertyList + numProperties, id,
-                       ComparePropertyId());
-  if (result.first == result.second) {
-    return 0;
-  } else {
-    return result.first;
-  }
-}
-
-namespace
-{
-  bool verifyProperties(const xdr_data_t* data, const xdr_data_t* end)
-  {
-    using namespace simgear;
-    const xdr_data_t* xdr = data;
-    while (xdr < end) {
-      unsigned id = XDR_decode_uint32(*xdr);
-      const IdPropertyList* plist = findProperty(id);
-
-      if (plist) {
-        xdr++;
-        // How we decode the remainder of the property depends on the type
-        switch (plist->type) {
-        case props::INT:
-        case props::BOOL:
-        case props::LONG:
-          xdr++;
-          break;
-        case props::FLOAT:
-        case props::DOUBLE:
-          {
-            float val = XDR_decode_float(*xdr);
-            if (SGMisc<float>::isNaN(val))
-              return false;
-            xdr++;
-            break;
-          }
-        case props::STRING:
-        case props::UNSPECIFIED:
-          {
-            // String is complicated. It consists of
-            // The length of the string
-            // The string itself
-            // Padding to the nearest 4-bytes.
-            // XXX Yes, each byte is padded out to a word! Too late
-            // to change...
-            uint32_t length = XDR_decode_uint32(*xdr);
-            xdr++;
-            // Old versions truncated the string but left the length
-            // unadjusted.
-            if (length > MAX_TEXT_SIZE)
-              length = MAX_TEXT_SIZE;
-            xdr += length;
-            // Now handle the padding
-            while ((length % 4) != 0)
-              {
-                xdr++;
-                length++;
-                //cout << "0";
-              }
-          }
-          break;
-        default:
-          // cerr << "Unknown Prop type " << id << " " << type << "\n";
-          xdr++;
-          break;
-        }
-      }
-      else {
-        // give up; this is a malformed property list.
-        return false;
-      }
-    }
-    return true;
-  }
-}
 
 class MPPropertyListener : public SGPropertyChangeListener
 {
@@ -834,6 +129,50 @@ static inline bool IsIncludedInPacket(int filter_base, int property_id)
         || (property_id >= 1500 && property_id < 1600); // include chat and generic properties.
 }
 
+/*
+ * The properties still decoded for peers beyond the full detail range: what is needed to
+ * pick the model and keep the timing right, the transponder for TCAS and ATC, chat, the
+ * generic properties, which models use for their own state, and the Emesary bridges,
+ * which models use for interactions over long distances.
+ */
+static inline bool IsEssentialProperty(unsigned property_id)
+{
+    return property_id == 10 // protocol version
+        || (property_id >= 1500 && property_id < 1600) // transponder
+        || property_id == 10002 // chat
+        || (property_id >= 10100 && property_id < V2018_1_BASE) // generic, bool arrays included
+        || property_id == V2018_1_BASE // MP time sync
+        || (property_id >= EMESARYBRIDGE_BASE && property_id < V2018_3_BASE)
+        || property_id >= FALLBACK_MODEL_ID;
+}
+
+/*
+ * Step over a property without decoding it; this follows the layout used by
+ * FGMultiplayMgr::DecodePosMsg().
+ */
+static const xdr_data_t* SkipProperty(const IdPropertyList* plist, const xdr_data_t* xdr,
+                                      bool short_int_encoded, int int_value)
+{
+    const bool isString = (plist->type == simgear::props::STRING) || (plist->type == simgear::props::UNSPECIFIED);
+    if (short_int_encoded) {
+        // V2 strings: the length is in the id word, followed by the unpadded characters
+        if (isString)
+            return reinterpret_cast<const xdr_data_t*>(reinterpret_cast<const char*>(xdr + 1) + int_value);
+        return xdr + 1;
+    }
+
+    xdr++; // the id
+    if (isString) {
+        uint32_t length = XDR_decode_uint32(*xdr);
+        xdr++;
+        if (length > MAX_TEXT_SIZE)
+            length = MAX_TEXT_SIZE;
+        // one word per character, padded to a multiple of four
+        return xdr + ((length + 3) & ~3u);
+    }
+    return xdr + 1;
+}
+
 //////////////////////////////////////////////////////////////////////
 //
 //  handle command "multiplayer-connect"
@@ -1032,6 +371,298 @@ static bool do_cpdlc_disconnect(const SGPropertyNode* arg, SGPropertyNode* root)
 }
 
 
+/**
+ * The buffer that holds a multi-player message, suitably aligned.
+ */
+union FGMultiplayMgr::MsgBuf
+{
+    MsgBuf()
+    {
+        memset(&Msg, 0, sizeof(Msg));
+    }
+
+    T_MsgHdr* msgHdr()
+    {
+        return &Header;
+    }
+
+    const T_MsgHdr* msgHdr() const
+    {
+        return reinterpret_cast<const T_MsgHdr*>(&Header);
+    }
+
+    T_PositionMsg* posMsg()
+    {
+        return reinterpret_cast<T_PositionMsg*>(Msg + sizeof(T_MsgHdr));
+    }
+
+    const T_PositionMsg* posMsg() const
+    {
+        return reinterpret_cast<const T_PositionMsg*>(Msg + sizeof(T_MsgHdr));
+    }
+
+    xdr_data_t* properties()
+    {
+        return reinterpret_cast<xdr_data_t*>(Msg + sizeof(T_MsgHdr)
+                                             + sizeof(T_PositionMsg));
+    }
+
+    const xdr_data_t* properties() const
+    {
+        return reinterpret_cast<const xdr_data_t*>(Msg + sizeof(T_MsgHdr)
+                                                   + sizeof(T_PositionMsg));
+    }
+    /**
+     * The end of the properties buffer.
+     */
+    xdr_data_t* propsEnd()
+    {
+        return reinterpret_cast<xdr_data_t*>(Msg + MAX_PACKET_SIZE);
+    };
+
+    const xdr_data_t* propsEnd() const
+    {
+        return reinterpret_cast<const xdr_data_t*>(Msg + MAX_PACKET_SIZE);
+    };
+    /**
+     * The end of properties actually in the buffer. This assumes that
+     * the message header is valid.
+     */
+    xdr_data_t* propsRecvdEnd()
+    {
+        return reinterpret_cast<xdr_data_t*>(Msg + Header.MsgLen);
+    }
+
+    const xdr_data_t* propsRecvdEnd() const
+    {
+        return reinterpret_cast<const xdr_data_t*>(Msg + Header.MsgLen);
+    }
+
+    xdr_data2_t double_val;
+    char Msg[MAX_PACKET_SIZE];
+    T_MsgHdr Header;
+};
+
+/**
+ * A message received and decoded by the receive thread, ready to be
+ * applied on the main thread.
+ */
+struct FGMultiplayMgr::ReceivedMsg
+{
+    uint32_t msgId = 0;
+    std::string callsign;
+    // false if the payload could not be decoded; the message is still recorded
+    bool decoded = false;
+
+    // position messages
+    std::string modelName;
+    FGExternalMotionData motionInfo;
+    int fallbackModelIndex = 0;
+
+    // chat messages
+    std::string chatText;
+
+    // the packet, with the header in host byte order, for the recorder
+    std::shared_ptr<std::vector<char>> raw;
+};
+
+/**
+ * Drains the receive socket, validates and decodes the messages and hands
+ * them to the main thread through a lock-free queue, so that a busy server
+ * only costs the main thread the application of the decoded data.
+ *
+ * On Linux the datagrams are received in batches with recvmmsg().
+ */
+class FGMultiplayMgr::ReceiveThread : public SGThread
+{
+public:
+    ReceiveThread(simgear::Socket* socket) :
+        _socket(socket),
+        _queue(QUEUE_CAPACITY),
+        _buffers(BATCH_SIZE)
+    {
+    }
+
+    void run() override;
+
+    /// ask the thread to exit; join() it afterwards
+    void stop() { _stop = true; }
+
+    /// main thread only
+    bool pop(std::unique_ptr<ReceivedMsg>& msg) { return _queue.pop(msg); }
+
+    void setDebugLevel(int level) { _debugLevel = level; }
+
+    /// whether to measure decodeTimeUsec(), which costs two clock reads per message
+    void setDecodeTiming(bool enabled) { _decodeTiming = enabled; }
+
+    /// peers further than rangeM from pos get position-only decoding; 0 disables
+    void setLevelOfDetail(const SGVec3d& pos, double rangeM)
+    {
+        _viewX = pos.x();
+        _viewY = pos.y();
+        _viewZ = pos.z();
+        _fullDetailRangeM = rangeM;
+    }
+
+    /// messages dropped because the main thread fell behind
+    unsigned droppedCount() const { return _dropped; }
+
+    /// valid messages decoded so far, and the time spent decoding them
+    /// while decode timing was enabled
+    unsigned decodedCount() const { return _decoded; }
+    unsigned positionOnlyCount() const { return _positionOnly; }
+    uint64_t decodeTimeUsec() const { return _decodeTimeUsec; }
+
+private:
+    static const int BATCH_SIZE = 32;
+    static const size_t QUEUE_CAPACITY = 4096;
+    // upper bound on the time stop() takes to be noticed
+    static const int POLL_INTERVAL_MSEC = 100;
+
+    int receiveBatch();
+    void handleMsg(MsgBuf& msgBuf, int bytes);
+
+    simgear::Socket* _socket;
+    flightgear::SPSCQueue<std::unique_ptr<ReceivedMsg>> _queue;
+    std::vector<MsgBuf> _buffers;
+
+    std::atomic<bool> _stop{false};
+    std::atomic<int> _debugLevel{0};
+    std::atomic<bool> _decodeTiming{false};
+    std::atomic<unsigned> _dropped{0};
+    std::atomic<unsigned> _decoded{0};
+    std::atomic<unsigned> _positionOnly{0};
+
+    // a torn update of the view position between frames is harmless
+    std::atomic<double> _viewX{0.0}, _viewY{0.0}, _viewZ{0.0};
+    std::atomic<double> _fullDetailRangeM{0.0};
+    std::atomic<uint64_t> _decodeTimeUsec{0};
+};
+
+void FGMultiplayMgr::ReceiveThread::run()
+{
+    while (!_stop) {
+        simgear::Socket* reads[2] = {_socket, nullptr};
+        simgear::Socket* writes[1] = {nullptr};
+        if (simgear::Socket::select(reads, writes, POLL_INTERVAL_MSEC) <= 0) {
+            continue;
+        }
+
+        // read until the socket is empty
+        while (!_stop && (receiveBatch() > 0)) {
+        }
+    }
+}
+
+// Returns the number of datagrams received.
+int FGMultiplayMgr::ReceiveThread::receiveBatch()
+{
+#if defined(__linux__)
+    struct mmsghdr msgs[BATCH_SIZE];
+    struct iovec iovecs[BATCH_SIZE];
+    memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < BATCH_SIZE; ++i) {
+        iovecs[i].iov_base = _buffers[i].Msg;
+        iovecs[i].iov_len = sizeof(_buffers[i].Msg);
+        msgs[i].msg_hdr.msg_iov = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int count = ::recvmmsg(_socket->getHandle(), msgs, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    if (count < 0) {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+            SG_LOG(SG_NETWORK, SG_DEBUG, "FGMultiplayMgr::ReceiveThread - Unable to receive data. "
+                   << strerror(errno) << "(errno " << errno << ")");
+        }
+        return 0;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        handleMsg(_buffers[i], static_cast<int>(msgs[i].msg_len));
+    }
+    return count;
+#else
+    // the socket is non-blocking, so this stops at the first would-block
+    int count = 0;
+    for (; count < BATCH_SIZE; ++count) {
+        MsgBuf& msgBuf = _buffers.front();
+        const int bytes = _socket->recv(msgBuf.Msg, sizeof(msgBuf.Msg), 0);
+        if (bytes <= 0) {
+            break;
+        }
+        handleMsg(msgBuf, bytes);
+    }
+    return count;
+#endif
+}
+
+void FGMultiplayMgr::ReceiveThread::handleMsg(MsgBuf& msgBuf, int bytes)
+{
+    const bool timing = _decodeTiming;
+    SGTimeStamp start;
+    if (timing) {
+        start.stamp();
+    }
+    T_MsgHdr* MsgHdr = msgBuf.msgHdr();
+    MsgHdr->Magic       = XDR_decode_uint32 (MsgHdr->Magic);
+    MsgHdr->Version     = XDR_decode_uint32 (MsgHdr->Version);
+    MsgHdr->MsgId       = XDR_decode_uint32 (MsgHdr->MsgId);
+    MsgHdr->MsgLen      = XDR_decode_uint32 (MsgHdr->MsgLen);
+    MsgHdr->ReplyPort   = XDR_decode_uint32 (MsgHdr->ReplyPort);
+    MsgHdr->Callsign[MAX_CALLSIGN_LEN -1] = '\0';
+
+    if (!ValidateMsg(msgBuf, bytes)) {
+        return;
+    }
+
+    const int debugLevel = _debugLevel;
+    //hexdump the incoming packet
+    if (debugLevel & 16)
+        SG_LOG_HEXDUMP(SG_NETWORK, SG_INFO, msgBuf.Msg, MsgHdr->MsgLen);
+
+    std::unique_ptr<ReceivedMsg> msg(new ReceivedMsg);
+    msg->msgId = MsgHdr->MsgId;
+    msg->callsign = MsgHdr->Callsign;
+    msg->raw = std::make_shared<std::vector<char>>(msgBuf.Msg, msgBuf.Msg + bytes);
+
+    switch (MsgHdr->MsgId) {
+    case CHAT_MSG_ID:
+        msg->decoded = DecodeChatMsg(msgBuf, msg->chatText);
+        break;
+    case POS_DATA_ID: {
+        const SGVec3d viewPos(_viewX, _viewY, _viewZ);
+        const double rangeM = _fullDetailRangeM;
+        msg->decoded = DecodePosMsg(msgBuf, debugLevel, msg->modelName,
+                                    msg->motionInfo, msg->fallbackModelIndex,
+                                    viewPos, rangeM);
+        if (msg->decoded && (rangeM > 0.0) &&
+            (distSqr(msg->motionInfo.position, viewPos) > rangeM * rangeM)) {
+            ++_positionOnly;
+        }
+        break;
+    }
+    case UNUSABLE_POS_DATA_ID:
+    case OLD_OLD_POS_DATA_ID:
+    case OLD_PROP_MSG_ID:
+    case OLD_POS_DATA_ID:
+        break;
+    default:
+        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
+              << "Unknown message Id received: " << MsgHdr->MsgId );
+        break;
+    }
+
+    ++_decoded;
+    if (timing) {
+        _decodeTimeUsec += (SGTimeStamp::now() - start).toUSecs();
+    }
+
+    if (!_queue.push(std::move(msg))) {
+        ++_dropped;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////
 //
 //  MultiplayMgr constructor
@@ -1061,6 +692,23 @@ FGMultiplayMgr::FGMultiplayMgr()
   pMultiPlayRange->setIntValue(100);
   pReplayState = fgGetNode("/sim/replay/replay-state", true);
   pLogRawSpeedMultiplayer = fgGetNode("/sim/replay/log-raw-speed-multiplayer", true);
+  pRxDropped = fgGetNode("/sim/multiplay/rx-dropped-packets", true);
+  pRxDecoded = fgGetNode("/sim/multiplay/rx-decoded-packets", true);
+  pRxDecodeTime = fgGetNode("/sim/multiplay/rx-decode-time-usec", true);
+  pRxDecodeTiming = fgGetNode("/sim/multiplay/rx-decode-timing", true);
+  pRxPositionOnly = fgGetNode("/sim/multiplay/rx-position-only-packets", true);
+
+  pLodFullDetailRange = fgGetNode("/sim/multiplay/lod-full-detail-range-nm", true);
+  if (!pLodFullDetailRange->hasValue())
+      pLodFullDetailRange->setDoubleValue(60.0);
+  pVisibility = fgGetNode("/environment/visibility-m", true);
+
+  pDeltaSend = fgGetNode("/sim/multiplay/delta-send", true);
+  if (!pDeltaSend->hasValue())
+      pDeltaSend->setBoolValue(false);
+  pDeltaKeyframeInterval = fgGetNode("/sim/multiplay/delta-keyframe-interval-sec", true);
+  if (!pDeltaKeyframeInterval->hasValue())
+      pDeltaKeyframeInterval->setDoubleValue(2.0);
 
 
 } // FGMultiplayMgr::FGMultiplayMgr()
@@ -1073,6 +721,11 @@ FGMultiplayMgr::FGMultiplayMgr()
 //////////////////////////////////////////////////////////////////////
 FGMultiplayMgr::~FGMultiplayMgr()
 {
+   if (mReceiveThread) {
+     mReceiveThread->stop();
+     mReceiveThread->join();
+   }
+
    globals->get_commands()->removeCommand("multiplayer-connect");
    globals->get_commands()->removeCommand("multiplayer-disconnect");
    globals->get_commands()->removeCommand("multiplayer-refreshserverlist");
@@ -1107,9 +760,9 @@ FGMultiplayMgr::init (void)
   //////////////////////////////////////////////////
   //  Set members from property values
   //////////////////////////////////////////////////
-  short rxPort = fgGetInt("/sim/multiplay/rxport");
+  int rxPort = fgGetInt("/sim/multiplay/rxport");
   string rxAddress = fgGetString("/sim/multiplay/rxhost");
-  short txPort = fgGetInt("/sim/multiplay/txport", 5000);
+  int txPort = fgGetInt("/sim/multiplay/txport", 5000);
   string txAddress = fgGetString("/sim/multiplay/txhost");
 
   int txRateHz = fgGetInt("/sim/multiplay/tx-rate-hz", 10);
@@ -1177,6 +830,9 @@ FGMultiplayMgr::init (void)
   fgSetBool("/sim/multiplay/online", true);
   mInitialised = true;
 
+  mReceiveThread.reset(new ReceiveThread(mSocket.get()));
+  mReceiveThread->start();
+
   
   SG_LOG(SG_NETWORK, SG_MANDATORY_INFO, "Multiplayer mode active");
   flightgear::addSentryTag("mp", "active");
@@ -1210,6 +866,13 @@ FGMultiplayMgr::shutdown (void)
 {
   fgSetBool("/sim/multiplay/online", false);
 
+  // the thread reads from mSocket, so stop it first
+  if (mReceiveThread) {
+    mReceiveThread->stop();
+    mReceiveThread->join();
+    mReceiveThread.reset();
+  }
+
   if (mSocket.get()) {
     mSocket->close();
     mSocket.reset();
@@ -1251,78 +914,6 @@ FGMultiplayMgr::reinit()
 //
 //////////////////////////////////////////////////////////////////////
 
-/**
- * The buffer that holds a multi-player message, suitably aligned.
- */
-union FGMultiplayMgr::MsgBuf
-{
-    MsgBuf()
-    {
-        memset(&Msg, 0, sizeof(Msg));
-    }
-
-    T_MsgHdr* msgHdr()
-    {
-        return &Header;
-    }
-
-    const T_MsgHdr* msgHdr() const
-    {
-        return reinterpret_cast<const T_MsgHdr*>(&Header);
-    }
-
-    T_PositionMsg* posMsg()
-    {
-        return reinterpret_cast<T_PositionMsg*>(Msg + sizeof(T_MsgHdr));
-    }
-
-    const T_PositionMsg* posMsg() const
-    {
-        return reinterpret_cast<const T_PositionMsg*>(Msg + sizeof(T_MsgHdr));
-    }
-
-    xdr_data_t* properties()
-    {
-        return reinterpret_cast<xdr_data_t*>(Msg + sizeof(T_MsgHdr)
-                                             + sizeof(T_PositionMsg));
-    }
-
-    const xdr_data_t* properties() const
-    {
-        return reinterpret_cast<const xdr_data_t*>(Msg + sizeof(T_MsgHdr)
-                                                   + sizeof(T_PositionMsg));
-    }
-    /**
-     * The end of the properties buffer.
-     */
-    xdr_data_t* propsEnd()
-    {
-        return reinterpret_cast<xdr_data_t*>(Msg + MAX_PACKET_SIZE);
-    };
-
-    const xdr_data_t* propsEnd() const
-    {
-        return reinterpret_cast<const xdr_data_t*>(Msg + MAX_PACKET_SIZE);
-    };
-    /**
-     * The end of properties actually in the buffer. This assumes that
-     * the message header is valid.
-     */
-    xdr_data_t* propsRecvdEnd()
-    {
-        return reinterpret_cast<xdr_data_t*>(Msg + Header.MsgLen);
-    }
-
-    const xdr_data_t* propsRecvdEnd() const
-    {
-        return reinterpret_cast<const xdr_data_t*>(Msg + Header.MsgLen);
-    }
-
-    xdr_data2_t double_val;
-    char Msg[MAX_PACKET_SIZE];
-    T_MsgHdr Header;
-};
-
 bool
 FGMultiplayMgr::isSane(const FGExternalMotionData& motionInfo)
 {
@@ -1348,6 +939,8 @@ FGMultiplayMgr::SendMyPosition(const FGExternalMotionData& motionInfo)
 {
   int protocolToUse = getProtocolToUse();
   int transmitFilterPropertyBase = pMultiPlayTransmitPropertyBase->getIntValue();
+  // delta mode compares with the values which were actually sent
+  const bool recordSent = pDeltaSend->getBoolValue();
   if ((! mInitialised) || (! mHaveServer))
         return;
 
@@ -1753,6 +1346,10 @@ FGMultiplayMgr::SendMyPosition(const FGExternalMotionData& motionInfo)
                           break;
                       }
                   }
+
+                  // only what made it into the packet counts as sent
+                  if (recordSent)
+                      RecordSentValue(*it);
               }
               ++it;
           }
@@ -1789,7 +1386,14 @@ FGMultiplayMgr::SendMyPosition(const FGExternalMotionData& motionInfo)
       if (pMultiPlayDebugLevel->getIntValue() & 1)
       {
           long stamp = SGTimeStamp::now().getSeconds();
-          ProcessPosMsg(msgBuf, mServer, stamp);
+          std::string modelName;
+          FGExternalMotionData loopbackInfo;
+          int fallbackModelIndex = 0;
+          if (DecodePosMsg(msgBuf, pMultiPlayDebugLevel->getIntValue(), modelName,
+                           loopbackInfo, fallbackModelIndex)) {
+              ApplyPosMsg(msgBuf.Header.Callsign, modelName, loopbackInfo,
+                          fallbackModelIndex, stamp);
+          }
       }
   }
   if (msgLen > 0)
@@ -1848,131 +1452,112 @@ FGMultiplayMgr::SendTextMessage(const string &MsgText)
 //////////////////////////////////////////////////////////////////////
 
 
-// If a message is available from mSocket, copies into <msgBuf>, converts
-// endiness of the T_MsgHdr, and returns length.
+// Checks the header of a message, which must already be in host byte order.
 //
-// Otherwise returns 0.
+bool FGMultiplayMgr::ValidateMsg(const MsgBuf& Msg, int bytes)
+{
+    if (bytes <= static_cast<int>(sizeof(T_MsgHdr))) {
+      SG_LOG( SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
+              << "received message with insufficient data" );
+      return false;
+    }
+
+    const T_MsgHdr* MsgHdr = Msg.msgHdr();
+    if (MsgHdr->Magic != MSG_MAGIC) {
+        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
+              << "message has invalid magic number!" );
+      return false;
+    }
+    if (MsgHdr->Version != PROTO_VER) {
+        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
+              << "message has invalid protocol number!" );
+      return false;
+    }
+    if (static_cast<int>(MsgHdr->MsgLen) != bytes) {
+        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
+             << "message from " << MsgHdr->Callsign << " has invalid length!");
+      return false;
+    }
+    return true;
+}
+
+// Applies the messages decoded by the receive thread. All of them are
+// recorded; while replaying, live chat is still shown but live positions
+// are ignored.
 //
-int FGMultiplayMgr::GetMsgNetwork(MsgBuf& msgBuf, simgear::IPAddress& SenderAddress)
+void FGMultiplayMgr::ProcessReceivedMsgs(long stamp)
 {
-        //////////////////////////////////////////////////
-        //  Although the recv call asks for
-        //  MAX_PACKET_SIZE of data, the number of bytes
-        //  returned will only be that of the next
-        //  packet waiting to be processed.
-        //////////////////////////////////////////////////
-        if (!mSocket) {
-            return 0;
-        }
-        int RecvStatus = mSocket->recvfrom(msgBuf.Msg, sizeof(msgBuf.Msg), 0,
-                                  &SenderAddress);
-        //////////////////////////////////////////////////
-        //  no Data received
-        //////////////////////////////////////////////////
-        if (RecvStatus == 0)
-            return 0;
-
-        // socket error reported?
-        // errno isn't thread-safe - so only check its value when
-        // socket return status < 0 really indicates a failure.
-        if ((RecvStatus < 0)&&
-            ((errno == EAGAIN) || (errno == 0))) // MSVC output "NoError" otherwise
-        {
-            // ignore "normal" errors
-            return 0;
+    if (!mReceiveThread) {
+        return;
+    }
+
+    mReceiveThread->setDebugLevel(pMultiPlayDebugLevel->getIntValue());
+    mReceiveThread->setDecodeTiming(pRxDecodeTiming->getBoolValue());
+
+    // Beyond the visibility there's nothing to animate, but keep a floor
+    // so haze doesn't strip the properties of the aircraft around us.
+    double lodRangeM = pLodFullDetailRange->getDoubleValue() * SG_NM_TO_METER;
+    if (lodRangeM > 0.0) {
+        const double visibilityM = std::max(pVisibility->getDoubleValue(), 10.0 * SG_NM_TO_METER);
+        lodRangeM = std::min(lodRangeM, visibilityM);
+    }
+    mReceiveThread->setLevelOfDetail(globals->get_view_position_cart(), lodRangeM);
+
+    const bool replaying = pReplayState->getIntValue() != 0;
+
+    std::unique_ptr<ReceivedMsg> msg;
+    while (mReceiveThread->pop(msg)) {
+        // Make raw incoming packet available to recording code.
+        mRecordMessageQueue.push_back(msg->raw);
+
+        if (!msg->decoded) {
+            continue;
         }
 
-        if (RecvStatus<0)
-        {
-    #ifdef _WIN32
-            if (::WSAGetLastError() != WSAEWOULDBLOCK) // this is normal on a receive when there is no data
-            {
-                // with Winsock the error will not be the actual problem.
-                SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - Unable to receive data. WSAGetLastError=" << ::WSAGetLastError());
-            }
-    #else
-            SG_LOG(SG_NETWORK, SG_DEBUG, "FGMultiplayMgr::MP_ProcessData - Unable to receive data. "
-                << strerror(errno) << "(errno " << errno << ")");
-    #endif
-            return 0;
+        if (msg->msgId == CHAT_MSG_ID) {
+            SG_LOG (SG_NETWORK, SG_WARN, "Chat [" << msg->callsign << "]"
+                     << " " << msg->chatText);
+        } else if ((msg->msgId == POS_DATA_ID) && !replaying) {
+            ApplyPosMsg(msg->callsign, msg->modelName, msg->motionInfo,
+                        msg->fallbackModelIndex, stamp);
         }
-        
-        T_MsgHdr* MsgHdr = msgBuf.msgHdr();
-        MsgHdr->Magic       = XDR_decode_uint32 (MsgHdr->Magic);
-        MsgHdr->Version     = XDR_decode_uint32 (MsgHdr->Version);
-        MsgHdr->MsgId       = XDR_decode_uint32 (MsgHdr->MsgId);
-        MsgHdr->MsgLen      = XDR_decode_uint32 (MsgHdr->MsgLen);
-        MsgHdr->ReplyPort   = XDR_decode_uint32 (MsgHdr->ReplyPort);
-        MsgHdr->Callsign[MAX_CALLSIGN_LEN -1] = '\0';
-        
-        return RecvStatus;
+    }
+
+    pRxDropped->setIntValue(mReceiveThread->droppedCount());
+    pRxDecoded->setIntValue(mReceiveThread->decodedCount());
+    pRxDecodeTime->setDoubleValue(mReceiveThread->decodeTimeUsec());
+    pRxPositionOnly->setIntValue(mReceiveThread->positionOnlyCount());
 }
 
-// Returns message in msgBuf out-param.
+// Applies recorded position messages while replaying. Recorded chat
+// messages are not replayed.
 //
-// If we are in replay mode, we return recorded messages (omitting recorded
-// chat messages), and live chat messages from mSocket.
-//
-int FGMultiplayMgr::GetMsg(MsgBuf& msgBuf, simgear::IPAddress& SenderAddress)
+void FGMultiplayMgr::ProcessReplayMsgs(long stamp)
 {
-    if (pReplayState->getIntValue()) {
-        // We are replaying, so return non-chat multiplayer messages from
-        // mReplayMessageQueue and live chat messages from mSocket.
-        //
-        for(;;) {
-        
-            if (mReplayMessageQueue.empty()) {
-                // No recorded messages available, so look for live messages
-                // from <mSocket>.
-                //
-                int RecvStatus = GetMsgNetwork(msgBuf, SenderAddress);
-                if (RecvStatus == 0) {
-                    // No recorded messages, and no live messages, so return 0.
-                    return 0;
-                }
-                
-                // Always record all messages.
-                //
-                std::shared_ptr<std::vector<char>> data( new std::vector<char>(RecvStatus));
-                memcpy( &data->front(), msgBuf.Msg, RecvStatus);
-                mRecordMessageQueue.push_back(data);
-                
-                if (msgBuf.Header.MsgId == CHAT_MSG_ID) {
-                    return RecvStatus;
-                }
-
-                // If we get here, there is a live message but it is a
-                // multiplayer aircraft position so we ignore it while
-                // replaying.
-            }
-            else {
-                // Replay recorded message, unless it is a chat message.
-                //
-                auto replayMessage = mReplayMessageQueue.front();
-                mReplayMessageQueue.pop_front();
-                assert(replayMessage->size() <= sizeof(msgBuf));
-                int length = replayMessage->size();
-                memcpy(&msgBuf.Msg, &replayMessage->front(), length);
-                // Don't return recorded chat messages.
-                if (msgBuf.Header.MsgId != CHAT_MSG_ID) {
-                    SG_LOG(SG_NETWORK, SG_BULK,
-                           "replaying message length=" << replayMessage->size()
-                                                       << ". num remaining messages=" << mReplayMessageQueue.size());
-                    return length;
-                }
-            }
+    const int debugLevel = pMultiPlayDebugLevel->getIntValue();
+    while (!mReplayMessageQueue.empty()) {
+        auto replayMessage = mReplayMessageQueue.front();
+        mReplayMessageQueue.pop_front();
+
+        MsgBuf msgBuf;
+        assert(replayMessage->size() <= sizeof(msgBuf));
+        int length = replayMessage->size();
+        memcpy(&msgBuf.Msg, &replayMessage->front(), length);
+        if (!ValidateMsg(msgBuf, length) || (msgBuf.Header.MsgId != POS_DATA_ID)) {
+            continue;
         }
-    }
-    else {
-        int length = GetMsgNetwork(msgBuf, SenderAddress);
-        
-        // Make raw incoming packet available to recording code.
-        if (length) {
-            std::shared_ptr<std::vector<char>> data( new std::vector<char>(length));
-            memcpy( &data->front(), msgBuf.Msg, length);
-            mRecordMessageQueue.push_back(data);
+
+        SG_LOG(SG_NETWORK, SG_BULK,
+               "replaying message length=" << replayMessage->size()
+                                           << ". num remaining messages=" << mReplayMessageQueue.size());
+
+        std::string modelName;
+        FGExternalMotionData motionInfo;
+        int fallbackModelIndex = 0;
+        if (DecodePosMsg(msgBuf, debugLevel, modelName, motionInfo, fallbackModelIndex)) {
+            ApplyPosMsg(msgBuf.Header.Callsign, modelName, motionInfo,
+                        fallbackModelIndex, stamp);
         }
-        return length;
     }
 }
 
@@ -1980,8 +1565,8 @@ int FGMultiplayMgr::GetMsg(MsgBuf& msgBuf, simgear::IPAddress& SenderAddress)
 //////////////////////////////////////////////////////////////////////
 //
 //  Name: update
-//  Description: Processes data waiting at the receive socket. The
-//  processing ends when there is no more data at the socket.
+//  Description: Applies the messages received since the last
+//  frame, and sends our own position when it is due.
 //
 //////////////////////////////////////////////////////////////////////
 void
@@ -2007,69 +1592,13 @@ FGMultiplayMgr::update(double dt)
   }
 
   //////////////////////////////////////////////////
-  //  Read from receive socket and/or multiplayer
-  //  replay, and process any data.
+  //  Apply the messages decoded by the receive
+  //  thread, and/or the multiplayer replay.
   //////////////////////////////////////////////////
-  ssize_t bytes;
-  do {
-    MsgBuf  msgBuf;
-    simgear::IPAddress SenderAddress;
-    int RecvStatus = GetMsg(msgBuf, SenderAddress);
-    if (RecvStatus == 0) {
-        break;
-    }
-    // status is positive: bytes received
-    bytes = (ssize_t) RecvStatus;
-    if (bytes <= static_cast<ssize_t>(sizeof(T_MsgHdr))) {
-      SG_LOG( SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
-              << "received message with insufficient data" );
-      break;
-    }
-    
-    //////////////////////////////////////////////////
-    //  Read header
-    //////////////////////////////////////////////////
-    T_MsgHdr* MsgHdr = msgBuf.msgHdr();
-    if (MsgHdr->Magic != MSG_MAGIC) {
-        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
-              << "message has invalid magic number!" );
-      break;
-    }
-    if (MsgHdr->Version != PROTO_VER) {
-        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
-              << "message has invalid protocol number!" );
-      break;
-    }
-    if (static_cast<ssize_t>(MsgHdr->MsgLen) != bytes) {
-        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
-             << "message from " << MsgHdr->Callsign << " has invalid length!");
-      break;
-    }
-    //hexdump the incoming packet
-    if (pMultiPlayDebugLevel->getIntValue() & 16)
-        SG_LOG_HEXDUMP(SG_NETWORK, SG_INFO, msgBuf.Msg, MsgHdr->MsgLen);
-
-    //////////////////////////////////////////////////
-    //  Process messages
-    //////////////////////////////////////////////////
-    switch (MsgHdr->MsgId) {
-    case CHAT_MSG_ID:
-      ProcessChatMsg(msgBuf, SenderAddress);
-      break;
-    case POS_DATA_ID:
-      ProcessPosMsg(msgBuf, SenderAddress, stamp);
-      break;
-    case UNUSABLE_POS_DATA_ID:
-    case OLD_OLD_POS_DATA_ID:
-    case OLD_PROP_MSG_ID:
-    case OLD_POS_DATA_ID:
-      break;
-    default:
-        SG_LOG(SG_NETWORK, SG_INFO, "FGMultiplayMgr::MP_ProcessData - "
-              << "Unknown message Id received: " << MsgHdr->MsgId );
-      break;
-    }
-  } while (bytes > 0);
+  ProcessReceivedMsgs(stamp);
+  if (pReplayState->getIntValue()) {
+    ProcessReplayMsgs(stamp);
+  }
 
   // check for expiry
   MultiPlayerMap::iterator it = mMultiPlayerMap.begin();
@@ -2143,7 +1672,8 @@ void FGMultiplayMgr::Send(double mpTime)
     // The orientation of the vehicle wrt the earth centered frame
     motionInfo.orientation = qEc2Hl*hlOr;
 
-    if (!globals->get_subsystem<FDMShell>()->is_suspended()) {
+    auto fdm = globals->get_subsystem<FDMShell>();
+    if (fdm && !fdm->is_suspended()) {
         // velocities
         motionInfo.linearVel = SG_FEET_TO_METER*SGVec3f(ifce.get_uBody(),
             ifce.get_vBody(),
@@ -2170,6 +1700,18 @@ void FGMultiplayMgr::Send(double mpTime)
         motionInfo.angularAccel = SGVec3f::zeros();
     }
 
+    // In delta mode a full keyframe is sent at a fixed interval, so peers
+    // which just joined, or lost a packet, catch up. The mp time can go
+    // backwards, which also forces a keyframe.
+    const bool deltaSend = pDeltaSend->getBoolValue();
+    const double keyframeInterval = pDeltaKeyframeInterval->getDoubleValue();
+    const bool keyframe = !deltaSend || (mpTime >= mNextKeyframeTime) ||
+                          (mpTime < mNextKeyframeTime - keyframeInterval);
+    if (deltaSend && keyframe) {
+        mNextKeyframeTime = mpTime + keyframeInterval;
+    }
+    const int protocolToUse = getProtocolToUse();
+
     PropertyMap::iterator it;
     for (it = mPropertyMap.begin(); it != mPropertyMap.end(); ++it) {
         FGPropertyData* pData = new FGPropertyData;
@@ -2220,30 +1762,98 @@ void FGMultiplayMgr::Send(double mpTime)
             pData->float_value = it->second->getFloatValue();
             break;
         }
+
+        // the bools of an array are sent as one word, so they all go
+        if (!keyframe && (mPropertyDefinition[pData->id]->TransmitAs != TT_BOOLARRAY) &&
+            !ChangedSinceSent(pData, protocolToUse)) {
+            delete pData;
+            continue;
+        }
         motionInfo.properties.push_back(pData);
     }
     SendMyPosition(motionInfo);
 }
 
+// Whether a value differs from the one last sent for its property, once
+// quantised like it is on the wire. For delta mode.
+bool FGMultiplayMgr::ChangedSinceSent(const FGPropertyData* pData, int protocolToUse) const
+{
+    using namespace simgear;
+
+    auto it = mLastSent.find(pData->id);
+    if (it == mLastSent.end())
+        return true;
+    const SentValue& last = it->second;
+
+    switch (static_cast<int>(pData->type)) {
+    case props::INT:
+    case props::LONG:
+    case props::BOOL:
+        return last.intValue != pData->int_value;
+    case props::STRING:
+    case props::UNSPECIFIED:
+        return last.stringValue != (pData->string_value ? pData->string_value : "");
+    default: {
+        double scale = 0.0;
+        if (protocolToUse > 1) {
+            switch (mPropertyDefinition.at(pData->id)->TransmitAs) {
+            case TT_SHORT_FLOAT_1: scale = 10.0; break;
+            case TT_SHORT_FLOAT_2: scale = 100.0; break;
+            case TT_SHORT_FLOAT_3: scale = 1000.0; break;
+            case TT_SHORT_FLOAT_4: scale = 10000.0; break;
+            case TT_SHORT_FLOAT_NORM: scale = 32767.0; break;
+            default: break;
+            }
+        }
+        if (scale > 0.0)
+            return get_scaled_short(last.floatValue, scale) != get_scaled_short(pData->float_value, scale);
+        return last.floatValue != pData->float_value;
+    }
+    }
+}
+
+// Remembers a value written to a position message, for delta mode.
+void FGMultiplayMgr::RecordSentValue(const FGPropertyData* pData)
+{
+    using namespace simgear;
+
+    SentValue& last = mLastSent[pData->id];
+    switch (static_cast<int>(pData->type)) {
+    case props::INT:
+    case props::LONG:
+    case props::BOOL:
+        last.intValue = pData->int_value;
+        break;
+    case props::STRING:
+    case props::UNSPECIFIED:
+        last.stringValue = pData->string_value ? pData->string_value : "";
+        break;
+    default:
+        last.floatValue = pData->float_value;
+        break;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////
 //
-//  handle a position message
+//  decode a position message; called from the receive thread, so this
+//  must not touch the manager or the property tree
 //
 //////////////////////////////////////////////////////////////////////
-void
-FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
-   const simgear::IPAddress& SenderAddress, long stamp)
+bool
+FGMultiplayMgr::DecodePosMsg(const FGMultiplayMgr::MsgBuf& Msg, int debugLevel,
+   std::string& modelName, FGExternalMotionData& motionInfo,
+   int& fallback_model_index, const SGVec3d& viewPos, double fullDetailRangeM)
 {
    const T_MsgHdr* MsgHdr = Msg.msgHdr();
    if (MsgHdr->MsgLen < sizeof(T_MsgHdr) + sizeof(T_PositionMsg)) {
       SG_LOG(SG_NETWORK, SG_DEBUG, "FGMultiplayMgr::MP_ProcessData - "
          << "Position message received with insufficient data");
-      return;
+      return false;
    }
    const T_PositionMsg* PosMsg = Msg.posMsg();
-   FGExternalMotionData motionInfo;
-   int fallback_model_index = 0;
+   modelName.assign(PosMsg->Model, strnlen(PosMsg->Model, MAX_MODEL_NAME_LEN));
    motionInfo.time = XDR_decode_double(PosMsg->time);
    motionInfo.lag = XDR_decode_double(PosMsg->lag);
    for (unsigned i = 0; i < 3; ++i)
@@ -2268,9 +1878,13 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
       SG_LOG(SG_NETWORK, SG_DEBUG, "FGMultiplayMgr::ProcessPosMsg - "
          << "Position message with invalid data (NaN) received from "
          << MsgHdr->Callsign);
-      return;
+      return false;
    }
 
+   // Far away peers are drawn as a dot at most: skip their animation properties.
+   const bool positionOnly = (fullDetailRangeM > 0.0) &&
+      (distSqr(motionInfo.position, viewPos) > fullDetailRangeM * fullDetailRangeM);
+
    //cout << "INPUT MESSAGE\n";
 
    // There was a bug in 1.9.0 and before: T_PositionMsg was 196 bytes
@@ -2301,7 +1915,7 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
         if (verifyProperties(&PosMsg->pad, Msg.propsRecvdEnd()))
             xdr = &PosMsg->pad;
         else if (!verifyProperties(xdr, Msg.propsRecvdEnd()))
-            goto noprops;
+            return true;
     }
     while (xdr < Msg.propsRecvdEnd()) {
         // First element is always the ID
@@ -2323,7 +1937,7 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
             short_int_encoded = true;
         }
 
-        if (pMultiPlayDebugLevel->getIntValue() & 8)
+        if (debugLevel & 8)
             SG_LOG(SG_NETWORK, SG_INFO,
                 "[RECV] add " << std::hex << xdr
                 << std::dec <<
@@ -2334,7 +1948,11 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
         // Check the ID actually exists and get the type
         const IdPropertyList* plist = findProperty(id);
 
-      if (plist)
+      if (plist && positionOnly && !plist->decode_received && !IsEssentialProperty(id))
+      {
+        xdr = SkipProperty(plist, xdr, short_int_encoded, int_value);
+      }
+      else if (plist)
       {
         FGPropertyData* pData = new FGPropertyData;
         if (plist->decode_received)
@@ -2510,10 +2128,22 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
       break;
     }
   }
- noprops:
-  FGAIMultiplayer* mp = getMultiplayer(MsgHdr->Callsign);
+  return true;
+} // FGMultiplayMgr::DecodePosMsg()
+
+
+//////////////////////////////////////////////////////////////////////
+//
+//  apply a decoded position message
+//
+//////////////////////////////////////////////////////////////////////
+void
+FGMultiplayMgr::ApplyPosMsg(const std::string& callsign, const std::string& modelName,
+   FGExternalMotionData& motionInfo, int fallbackModelIndex, long stamp)
+{
+  FGAIMultiplayer* mp = getMultiplayer(callsign);
   if (!mp)
-    mp = addMultiplayer(MsgHdr->Callsign, PosMsg->Model, fallback_model_index);
+    mp = addMultiplayer(callsign, modelName, fallbackModelIndex);
   mp->addMotionInfo(motionInfo, stamp);
   
   // Optionally gather information about the raw speed of a selected
@@ -2521,8 +2151,8 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
   // --test-motion-mp.
   //
   {
-    string callsign = pLogRawSpeedMultiplayer->getStringValue();
-    if (!callsign.empty() && callsign == string(MsgHdr->Callsign)) {
+    string logCallsign = pLogRawSpeedMultiplayer->getStringValue();
+    if (!logCallsign.empty() && logCallsign == callsign) {
         static SGVec3d s_pos_prev;
         static double s_simtime_prev = -1;
         SGVec3d pos = motionInfo.position;
@@ -2547,7 +2177,7 @@ FGMultiplayMgr::ProcessPosMsg(const FGMultiplayMgr::MsgBuf& Msg,
         s_pos_prev = pos;
     }
   }
-} // FGMultiplayMgr::ProcessPosMsg()
+} // FGMultiplayMgr::ApplyPosMsg()
 
 
 std::shared_ptr<std::vector<char>> FGMultiplayMgr::popMessageHistory()
@@ -2570,33 +2200,26 @@ void FGMultiplayMgr::pushMessageHistory(std::shared_ptr<std::vector<char>> messa
 
 //////////////////////////////////////////////////////////////////////
 //
-//  handle a chat message
+//  decode a chat message
 //  FIXME: display chat message within flightgear
 //
 //////////////////////////////////////////////////////////////////////
-void
-FGMultiplayMgr::ProcessChatMsg(const MsgBuf& Msg,
-                               const simgear::IPAddress& SenderAddress)
+bool
+FGMultiplayMgr::DecodeChatMsg(const MsgBuf& Msg, std::string& text)
 {
   const T_MsgHdr* MsgHdr = Msg.msgHdr();
   if (MsgHdr->MsgLen < sizeof(T_MsgHdr) + 1) {
     SG_LOG( SG_NETWORK, SG_DEBUG, "FGMultiplayMgr::MP_ProcessData - "
             << "Chat message received with insufficient data" );
-    return;
+    return false;
   }
 
-  char *chatStr = new char[MsgHdr->MsgLen - sizeof(T_MsgHdr)];
   const T_ChatMsg* ChatMsg
       = reinterpret_cast<const T_ChatMsg *>(Msg.Msg + sizeof(T_MsgHdr));
-  strncpy(chatStr, ChatMsg->Text,
-          MsgHdr->MsgLen - sizeof(T_MsgHdr));
-  chatStr[MsgHdr->MsgLen - sizeof(T_MsgHdr) - 1] = '\0';
-
-  SG_LOG (SG_NETWORK, SG_WARN, "Chat [" << MsgHdr->Callsign << "]"
-           << " " << chatStr);
-
-  delete [] chatStr;
-} // FGMultiplayMgr::ProcessChatMsg ()
+  text.assign(ChatMsg->Text,
+              strnlen(ChatMsg->Text, MsgHdr->MsgLen - sizeof(T_MsgHdr) - 1));
+  return true;
+} // FGMultiplayMgr::DecodeChatMsg ()
 //////////////////////////////////////////////////////////////////////
 
 void
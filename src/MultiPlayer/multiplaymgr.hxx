@@ -13,12 +13,14 @@ const int MIN_MP_PROTOCOL_VERSION = 1;
 const int MAX_MP_PROTOCOL_VERSION = 2;
 
 #include <deque>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <simgear/compiler.h>
 #include <simgear/io/raw_socket.hxx>
+#include <simgear/math/SGMath.hxx>
 #include <simgear/props/props.hxx>
 #include <simgear/structure/subsystem_mgr.hxx>
 
@@ -32,6 +34,7 @@ const std::string MPIRC_SERVER_PORT_PROPERTY{"/network/mpirc/server-port"};
 const std::string MPIRC_NICK_PREFIX{"MP_IRC_"};
 
 struct FGExternalMotionData;
+struct FGPropertyData;
 class MPPropertyListener;
 struct T_MsgHdr;
 class FGAIMultiplayer;
@@ -92,22 +95,41 @@ private:
     short get_scaled_short(double v, double scale);
 
     union MsgBuf;
+    struct ReceivedMsg;
+    class ReceiveThread;
+
     FGAIMultiplayer* addMultiplayer(const std::string& callsign,
                                     const std::string& modelName,
                                     const int fallback_model_index);
     void FillMsgHdr(T_MsgHdr* MsgHdr, int iMsgId, unsigned _len = 0u);
-    void ProcessPosMsg(const MsgBuf& Msg, const simgear::IPAddress& SenderAddress,
-                       long stamp);
-    void ProcessChatMsg(const MsgBuf& Msg, const simgear::IPAddress& SenderAddress);
-    bool isSane(const FGExternalMotionData& motionInfo);
-    int GetMsgNetwork(MsgBuf& msgBuf, simgear::IPAddress& SenderAddress);
-    int GetMsg(MsgBuf& msgBuf, simgear::IPAddress& SenderAddress);
+
+    // decoding is free of side effects on the manager, so it can run on
+    // the receive thread
+    static bool ValidateMsg(const MsgBuf& Msg, int bytes);
+    static bool DecodePosMsg(const MsgBuf& Msg, int debugLevel, std::string& modelName,
+                             FGExternalMotionData& motionInfo, int& fallbackModelIndex,
+                             const SGVec3d& viewPos = SGVec3d::zeros(), double fullDetailRangeM = 0.0);
+    static bool DecodeChatMsg(const MsgBuf& Msg, std::string& text);
+    static bool isSane(const FGExternalMotionData& motionInfo);
+
+    void ApplyPosMsg(const std::string& callsign, const std::string& modelName,
+                     FGExternalMotionData& motionInfo, int fallbackModelIndex,
+                     long stamp);
+    void ProcessReceivedMsgs(long stamp);
+    void ProcessReplayMsgs(long stamp);
 
     /// maps from the callsign string to the FGAIMultiplayer
     typedef std::map<std::string, SGSharedPtr<FGAIMultiplayer>> MultiPlayerMap;
     MultiPlayerMap mMultiPlayerMap;
 
     std::unique_ptr<simgear::Socket> mSocket;
+    // receives and decodes incoming packets off the main thread
+    std::unique_ptr<ReceiveThread> mReceiveThread;
+    SGPropertyNode_ptr pRxDropped;
+    SGPropertyNode_ptr pRxDecoded;
+    SGPropertyNode_ptr pRxDecodeTime;
+    SGPropertyNode_ptr pRxDecodeTiming; // enables pRxDecodeTime
+    SGPropertyNode_ptr pRxPositionOnly;
     simgear::IPAddress mServer;
     bool mHaveServer;
     bool mInitialised;
@@ -125,6 +147,25 @@ private:
     SGPropertyNode* pReplayState;
     SGPropertyNode* pLogRawSpeedMultiplayer;
 
+    // level of detail: peers further away than this only get their
+    // position and a few essential properties decoded
+    SGPropertyNode_ptr pLodFullDetailRange;
+    SGPropertyNode_ptr pVisibility;
+
+    // delta mode: between keyframes, only send the properties which
+    // changed by more than their quantisation step
+    struct SentValue {
+        int intValue = 0;
+        float floatValue = 0.0f;
+        std::string stringValue;
+    };
+    bool ChangedSinceSent(const FGPropertyData* pData, int protocolToUse) const;
+    void RecordSentValue(const FGPropertyData* pData);
+    SGPropertyNode_ptr pDeltaSend;
+    SGPropertyNode_ptr pDeltaKeyframeInterval;
+    std::map<unsigned int, SentValue> mLastSent;
+    double mNextKeyframeTime = 0.0;
+
     typedef std::map<unsigned int, const struct IdPropertyList*> PropertyDefinitionMap;
     PropertyDefinitionMap mPropertyDefinition;
 
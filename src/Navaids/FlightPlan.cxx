@@ -1712,6 +1712,7 @@ bool FlightPlan::Leg::setHoldCount(int count)
   void FlightPlan::Leg::markWaypointDirty()
   {
     auto fp = owner();
+    fp->_modifiedWaypts.push_back(_waypt);
     fp->lockDelegates();
     fp->_waypointsChanged = true;
     fp->unlockDelegates();
@@ -1756,7 +1757,13 @@ void FlightPlan::rebuildLegData()
 {
   _totalDistance = 0.0;
   double totalDistanceIncludingMissed = 0.0;
-  RoutePath path(this);
+  if (_routePath) {
+    // the change flag is already cleared, so update explicitly
+    _routePath->update(this, _modifiedWaypts);
+    _modifiedWaypts.clear();
+    _routePathModificationCount = Waypt::modificationCount();
+  }
+  const RoutePath& path = routePath();
   
   for (unsigned int l=0; l<_legs.size(); ++l) {
     _legs[l]->_courseDeg = path.trackForIndex(l);
@@ -1776,13 +1783,12 @@ void FlightPlan::rebuildLegData()
   
 SGGeod FlightPlan::pointAlongRoute(int aIndex, double aOffsetNm) const
 {
-    RoutePath rp(this);
-    return rp.positionForDistanceFrom(aIndex, aOffsetNm * SG_NM_TO_METER);
+    return routePath().positionForDistanceFrom(aIndex, aOffsetNm * SG_NM_TO_METER);
 }
 
 SGGeod FlightPlan::pointAlongRouteNorm(int aIndex, double aOffsetNorm) const
 {
-    RoutePath rp(this);
+    const RoutePath& rp = routePath();
     if (fabs(aOffsetNorm) > 1.0) {
         SG_LOG(SG_AUTOPILOT, SG_ALERT, "FlightPlan::pointAlongRouteNorm: called with invalid arg:" << aOffsetNorm);
         return rp.positionForIndex(aIndex);
@@ -1804,6 +1810,24 @@ SGGeod FlightPlan::pointAlongRouteNorm(int aIndex, double aOffsetNorm) const
     return rp.positionForDistanceFrom(aIndex, d * aOffsetNorm);
 }
 
+const RoutePath& FlightPlan::routePath() const
+{
+    const unsigned int modificationCount = Waypt::modificationCount();
+    if (!_routePath) {
+        _routePath.reset(new RoutePath(this));
+    } else if (_waypointsChanged || !_modifiedWaypts.empty() ||
+               (modificationCount != _routePathModificationCount)) {
+        // legs changed: either pending inside a delegate lock, or a
+        // waypoint was modified in place, perhaps without going through
+        // its leg (setters on a waypoint shared with a script, for example)
+        _routePath->update(this, _modifiedWaypts);
+    }
+
+    _modifiedWaypts.clear();
+    _routePathModificationCount = modificationCount;
+    return *_routePath;
+}
+
 void FlightPlan::lockDelegates()
 {
   if (_delegateLock == 0) {
@@ -1926,6 +1950,9 @@ FlightPlan::Delegate::~Delegate()
 
 void FlightPlan::setFollowLegTrackToFixes(bool tf)
 {
+    if (tf != _followLegTrackToFix) {
+        _routePath.reset(); // leg courses are computed differently
+    }
     _followLegTrackToFix = tf;
 }
 
@@ -25,10 +25,13 @@
 #define FG_FLIGHTPLAN_HXX
 
 #include <functional>
+#include <memory>
 
 #include <Navaids/route.hxx>
 #include <Airports/airport.hxx>
 
+class RoutePath;
+
 namespace flightgear
 {
 
@@ -358,6 +361,13 @@ public:
      */
   SGGeod pointAlongRouteNorm(int aIndex, double aOffsetNorm) const;
 
+  /**
+   * the computed path of the route, owned by the flight-plan and updated
+   * incrementally when legs change. Prefer this to constructing a
+   * RoutePath, which recomputes every leg.
+   */
+  const RoutePath& routePath() const;
+
   /**
     @brief given an index to insert a waypoint into the plan, find the geographical vicinity.
         This is used to aid disambiguration searches, etc: see the vicinity paramter to 'waypointFromString'
@@ -509,6 +519,12 @@ private:
     double _totalDistance;
     void rebuildLegData();
 
+    mutable std::unique_ptr<RoutePath> _routePath;
+    // waypoints modified in place since the path was last updated
+    mutable WayptVec _modifiedWaypts;
+    // Waypt::modificationCount() when the path was last updated
+    mutable unsigned int _routePathModificationCount = 0;
+
     using LegVec = std::vector<LegRef>;
     LegVec _legs;
 
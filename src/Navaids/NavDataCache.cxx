@@ -10,6 +10,7 @@
 #include "NavDataCache.hxx"
 
 // std
+#include <algorithm>
 #include <cstddef>  // for std::size_t
 #include <map>
 #include <cstring>  // for memcoy
@@ -17,6 +18,8 @@
 #include <stdint.h> // for int64_t
 #include <sstream>  // for std::ostringstream
 #include <mutex>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #ifdef SYSTEM_SQLITE
@@ -51,6 +54,7 @@
 #include <simgear/sg_inlines.h>
 #include <simgear/structure/exception.hxx>
 #include <simgear/threads/SGThread.hxx>
+#include <simgear/timing/timestamp.hxx>
 
 #include "CacheSchema.h"
 #include "PositionedOctree.hxx"
@@ -230,7 +234,41 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////
 
-typedef std::map<PositionedID, FGPositionedRef> PositionedCache;
+typedef std::unordered_map<PositionedID, FGPositionedRef> PositionedCache;
+
+namespace {
+
+// entry of the in-memory frequency indices, ordered by frequency
+struct FrequencyEntry {
+    int freq;
+    int type;
+    PositionedID rowid;
+    SGVec3d cartPos;
+
+    bool operator<(const FrequencyEntry& other) const
+    {
+        if (freq != other.freq) {
+            return freq < other.freq;
+        }
+        return rowid < other.rowid;
+    }
+};
+
+// entry of the in-memory (airport, type, ident) index
+struct AirportItemEntry {
+    PositionedID airport;
+    int type;
+    std::string ident;
+    PositionedID rowid;
+
+    bool operator<(const AirportItemEntry& other) const
+    {
+        return std::tie(airport, type, ident, rowid) <
+               std::tie(other.airport, other.type, other.ident, other.rowid);
+    }
+};
+
+} // of anonymous namespace
 
 class AirportTower : public FGPositioned
 {
@@ -273,13 +311,41 @@ public:
     transactionLevel(0),
     transactionAborted(false)
   {
+      tieStats();
   }
 
   ~NavDataCachePrivate()
   {
+    untieStats();
     close();
   }
 
+  void tieStats()
+  {
+      statsNode = fgGetNode("/sim/navdb/stats", true);
+      tieStat("positioned-cache-hits", &cacheHits);
+      tieStat("positioned-cache-misses", &cacheMisses);
+      tieStat("index-hits", &indexHits);
+      tieStat("index-misses", &indexMisses);
+      tieStat("index-builds", &indexBuilds);
+  }
+
+  void untieStats()
+  {
+      for (auto& node : tiedStats) {
+          node->untie();
+      }
+      tiedStats.clear();
+      statsNode.clear();
+  }
+
+  void tieStat(const char* name, int* counter)
+  {
+      SGPropertyNode_ptr node = statsNode->getNode(name, true);
+      node->tie(SGRawValuePointer<int>(counter), false);
+      tiedStats.push_back(node);
+  }
+
   void init()
   {
       SG_LOG(SG_NAVCACHE, SG_INFO, "NavCache at:" << path);
@@ -601,6 +667,7 @@ public:
     runwayLengthFtQuery = prepare("SELECT length_ft FROM runway WHERE rowid=?1");
 
     removePOIQuery = prepare("DELETE FROM positioned WHERE type=?1 AND ident=?2");
+    findPOIQuery = prepare("SELECT rowid FROM positioned WHERE type=?1 AND ident=?2");
 
   // query statement
     findClosestWithIdent = prepare("SELECT rowid FROM positioned WHERE ident=?1 "
@@ -636,6 +703,8 @@ public:
     insertOctree = prepare("INSERT INTO octree (rowid, children) VALUES (?1, 0)");
 
     getOctreeLeafChildren = prepare("SELECT rowid, type FROM positioned WHERE octree_node=?1");
+    getAllOctreeItems = prepare("SELECT rowid, type, octree_node, cart_x, cart_y, cart_z "
+                                "FROM positioned WHERE octree_node IS NOT NULL");
 
     searchAirports = prepare("SELECT ident, name FROM positioned WHERE (name LIKE ?1 OR ident LIKE ?1) " AND_TYPED
                              // prioritize entries with matching ICAO
@@ -650,6 +719,13 @@ public:
 
     getAirportItemByIdent = prepare("SELECT rowid FROM positioned WHERE airport=?1 AND ident=?2 AND type=?3");
 
+    loadNavaidFrequencies = prepare("SELECT positioned.rowid, type, freq, cart_x, cart_y, cart_z "
+                                    "FROM positioned, navaid WHERE positioned.rowid=navaid.rowid");
+    loadCommFrequencies = prepare("SELECT positioned.rowid, type, freq_khz, cart_x, cart_y, cart_z "
+                                  "FROM positioned, comm WHERE positioned.rowid=comm.rowid");
+    loadAirportItemIdents = prepare("SELECT rowid, airport, type, ident FROM positioned "
+                                    "WHERE airport>0 AND ident<>''");
+
     findAirportRunway = prepare("SELECT airport, rowid FROM positioned WHERE ident=?2 AND type=?3 AND airport="
                                 "(SELECT rowid FROM positioned WHERE type=?4 AND ident=?1)");
     sqlite3_bind_int(findAirportRunway, 3, FGPositioned::RUNWAY);
@@ -835,9 +911,120 @@ public:
     sqlite3_bind_double(insertPositionedQuery, 11, cartPos.z());
 
     PositionedID r = execInsert(insertPositionedQuery);
+    if (mayBeIndexed(ty, apt)) {
+        indicesValid = false;
+    }
     return r;
   }
 
+  /**
+   * User waypoints and POIs, which are also created and removed at runtime,
+   * aren't in the in-memory indices unless they belong to an airport, so
+   * they needn't invalidate them.
+   */
+  static bool mayBeIndexed(FGPositioned::Type ty, PositionedID apt)
+  {
+      switch (ty) {
+      case FGPositioned::WAYPOINT:
+      case FGPositioned::FIX:
+      case FGPositioned::OBSTACLE:
+      case FGPositioned::COUNTRY:
+      case FGPositioned::CITY:
+      case FGPositioned::TOWN:
+      case FGPositioned::VILLAGE:
+          return apt > 0;
+      default:
+          return true;
+      }
+  }
+
+  /**
+   * Should the in-memory indices answer queries? Never while the cache
+   * is being rebuilt, since every insert would invalidate them again.
+   */
+  bool useIndices()
+  {
+      if (outer->rebuildInProgress) {
+          indexMisses++;
+          return false;
+      }
+
+      if (!indicesValid) {
+          buildIndices();
+      }
+
+      indexHits++;
+      return true;
+  }
+
+  void buildIndices()
+  {
+      SGTimeStamp st;
+      st.stamp();
+
+      auto loadFrequencies = [this](sqlite3_stmt_ptr query, std::vector<FrequencyEntry>& entries) {
+          entries.clear();
+          while (stepSelect(query)) {
+              entries.push_back(FrequencyEntry{
+                  sqlite3_column_int(query, 2),
+                  sqlite3_column_int(query, 1),
+                  sqlite3_column_int64(query, 0),
+                  SGVec3d(sqlite3_column_double(query, 3),
+                          sqlite3_column_double(query, 4),
+                          sqlite3_column_double(query, 5))});
+          }
+          reset(query);
+          std::sort(entries.begin(), entries.end());
+      };
+
+      loadFrequencies(loadNavaidFrequencies, navaidsByFreq);
+      loadFrequencies(loadCommFrequencies, commsByFreq);
+
+      airportItemsByIdent.clear();
+      while (stepSelect(loadAirportItemIdents)) {
+          airportItemsByIdent.push_back(AirportItemEntry{
+              sqlite3_column_int64(loadAirportItemIdents, 1),
+              sqlite3_column_int(loadAirportItemIdents, 2),
+              (char*) sqlite3_column_text(loadAirportItemIdents, 3),
+              sqlite3_column_int64(loadAirportItemIdents, 0)});
+      }
+      reset(loadAirportItemIdents);
+      std::sort(airportItemsByIdent.begin(), airportItemsByIdent.end());
+
+      indicesValid = true;
+      indexBuilds++;
+      SG_LOG(SG_NAVCACHE, SG_INFO, "building navcache lookup indices took:" << st.elapsedMSec() << "msec");
+  }
+
+  /**
+   * Entries with the frequency and a type in [minType, maxType], ordered
+   * by distance to cartPos when one is given, and by rowid otherwise.
+   */
+  PositionedIDVec findByFrequency(const std::vector<FrequencyEntry>& entries, int freq,
+                                  int minType, int maxType, const SGVec3d* cartPos)
+  {
+      FrequencyEntry key{freq, 0, 0, SGVec3d()};
+      auto it = std::lower_bound(entries.begin(), entries.end(), key);
+
+      std::vector<std::pair<double, PositionedID>> matches;
+      for (; (it != entries.end()) && (it->freq == freq); ++it) {
+          if ((it->type >= minType) && (it->type <= maxType)) {
+              matches.emplace_back(cartPos ? distSqr(*cartPos, it->cartPos) : 0.0, it->rowid);
+          }
+      }
+
+      if (cartPos) {
+          std::sort(matches.begin(), matches.end());
+      }
+
+      PositionedIDVec result;
+      result.reserve(matches.size());
+      for (const auto& m : matches) {
+          result.push_back(m.second);
+      }
+      return result;
+  }
+
   FGPositionedList findAllByString(const string& s, const string& column,
                                      FGPositioned::Filter* filter, bool exact)
   {
@@ -910,12 +1097,23 @@ public:
     deferredOctreeUpdates.clear();
   }
 
-  void removePositionedWithIdent(FGPositioned::Type ty, const std::string& aIdent)
+  /**
+   * Returns the rowids of the removed items.
+   */
+  PositionedIDVec removePositionedWithIdent(FGPositioned::Type ty, const std::string& aIdent)
   {
+    sqlite3_bind_int(findPOIQuery, 1, ty);
+    sqlite_bind_stdstring(findPOIQuery, 2, aIdent);
+    PositionedIDVec removed = selectIds(findPOIQuery);
+
     sqlite3_bind_int(removePOIQuery, 1, ty);
     sqlite_bind_stdstring(removePOIQuery, 2, aIdent);
     execUpdate(removePOIQuery);
     reset(removePOIQuery);
+    if (mayBeIndexed(ty, 0)) {
+        indicesValid = false;
+    }
+    return removed;
   }
 
   NavDataCache* outer;
@@ -927,12 +1125,30 @@ public:
     // if exit is requested during a rebuild.
     bool abandonCache = false;
 
+    // set once user waypoints changed the octree snapshot overlay in this run
+    bool octreeOverlayChanged = false;
+
 
     /// the actual cache of ID -> instances. This holds an owning reference,
     /// so once items are in the cache they will never be deleted until
     /// the cache drops its reference
     PositionedCache cache;
-    unsigned int cacheHits, cacheMisses;
+    int cacheHits, cacheMisses;
+
+    /// in-memory copies of the navaid and comm frequencies and of the
+    /// airport item idents, sorted for binary search. Built from the
+    /// database on first use, and again after anything they may contain
+    /// was inserted or removed.
+    bool indicesValid = false;
+    std::vector<FrequencyEntry> navaidsByFreq, commsByFreq;
+    std::vector<AirportItemEntry> airportItemsByIdent;
+    // index-misses counts every lookup answered from SQL instead of the
+    // indices: during a rebuild, and for items they don't cover
+    int indexHits = 0, indexMisses = 0, indexBuilds = 0;
+
+    // counters above, tied under /sim/navdb/stats
+    SGPropertyNode_ptr statsNode;
+    std::vector<SGPropertyNode_ptr> tiedStats;
 
     /**
    * record the levels of open transaction objects we have
@@ -955,17 +1171,18 @@ public:
         insertCommStation, insertNavaid;
     sqlite3_stmt_ptr setAirportMetar, setRunwayReciprocal, setRunwayILS, setNavaidColocated,
         setAirportPos;
-    sqlite3_stmt_ptr removePOIQuery;
+    sqlite3_stmt_ptr removePOIQuery, findPOIQuery;
 
     sqlite3_stmt_ptr findClosestWithIdent;
     // octree (spatial index) related queries
     sqlite3_stmt_ptr getOctreeChildren, insertOctree, updateOctreeChildren,
-        getOctreeLeafChildren;
+        getOctreeLeafChildren, getAllOctreeItems;
 
     sqlite3_stmt_ptr searchAirports, getAllAirports;
     sqlite3_stmt_ptr findCommByFreq, findNavsByFreq,
         findNavsByFreqNoPos, findNavaidForRunway;
     sqlite3_stmt_ptr getAirportItems, getAirportItemByIdent;
+    sqlite3_stmt_ptr loadNavaidFrequencies, loadCommFrequencies, loadAirportItemIdents;
     sqlite3_stmt_ptr findAirportRunway,
         findILS;
 
@@ -1355,6 +1572,8 @@ NavDataCache::~NavDataCache()
 // ensure we wip the airports cache too, or we'll get out
 // of sync during tests
   FGAirport::clearAirportsCache();
+  Octree::saveSnapshot();
+  Octree::discardSnapshot();
 
   static_instance = nullptr;
   d.reset();
@@ -1677,6 +1896,8 @@ void NavDataCache::loadDatFiles(
 void NavDataCache::doRebuild()
 {
   rebuildInProgress = true;
+  Octree::discardSnapshot();
+  d->octreeOverlayChanged = false;
 
   try {
     d->close(); // completely close the sqlite object
@@ -1687,6 +1908,16 @@ void NavDataCache::doRebuild()
     d->runSQL("INSERT INTO octree (rowid, children) VALUES (1, 0)");
 
     SGTimeStamp st;
+
+    // wall-clock time of each rebuild phase, summarised at the end
+    std::vector<std::pair<string, int64_t>> phaseTimes;
+    SGTimeStamp phaseSt;
+    phaseSt.stamp();
+    auto endPhase = [&phaseTimes, &phaseSt](const string& name) {
+        phaseTimes.emplace_back(name, phaseSt.elapsedMSec());
+        phaseSt.stamp();
+    };
+
     {
         Transaction txn(this);
         APTLoader aptLoader;
@@ -1695,8 +1926,18 @@ void NavDataCache::doRebuild()
 
         using namespace std::placeholders;  // for _1, _2, _3...
 
+        // decompress and split all apt.dat files concurrently; the SQLite
+        // writes below all stay on this thread
+        const DatFilesGroupInfo& aptFilesInfo = getDatFilesInfo(DATFILETYPE_APT);
+        st.stamp();
+        aptLoader.preloadAptDatFiles(aptFilesInfo.paths, aptFilesInfo.totalSize);
+        SG_LOG(SG_NAVCACHE, SG_INFO,
+               "reading apt.dat files took:" << st.elapsedMSec());
+        endPhase("read apt.dat");
+
         loadDatFiles(DATFILETYPE_APT,
                      std::bind(&APTLoader::readAptDatFile, &aptLoader, _1, _2, _3));
+        endPhase("merge apt.dat");
 
         st.stamp();
         setRebuildPhaseProgress(REBUILD_UNKNOWN);
@@ -1705,20 +1946,25 @@ void NavDataCache::doRebuild()
         SG_LOG(SG_NAVCACHE, SG_INFO,
                "processing airports took:" <<
                st.elapsedMSec());
+        endPhase("load airports");
 
         setRebuildPhaseProgress(REBUILD_UNKNOWN);
         metarDataLoad(d->metarDatPath);
         stampCacheFile(d->metarDatPath);
+        endPhase("metar.dat");
 
         loadDatFiles(DATFILETYPE_FIX,
                      std::bind(&FixesLoader::loadFixes, &fixesLoader, _1, _2, _3));
+        endPhase("fix.dat");
         loadDatFiles(DATFILETYPE_NAV,
                      std::bind(&NavLoader::loadNav, &navLoader, _1, _2, _3));
+        endPhase("nav.dat");
 
         setRebuildPhaseProgress(REBUILD_UNKNOWN);
         st.stamp();
         txn.commit();
         SG_LOG(SG_NAVCACHE, SG_INFO, "stage 1 commit took:" << st.elapsedMSec());
+        endPhase("stage 1 commit");
     }
 
 #if 0
@@ -1736,6 +1982,7 @@ void NavDataCache::doRebuild()
           st.stamp();
           txn.commit();
           SG_LOG(SG_NAVCACHE, SG_INFO, "POI commit took:" << st.elapsedMSec());
+          endPhase("poi.dat");
       }
 #endif
 
@@ -1758,8 +2005,17 @@ void NavDataCache::doRebuild()
           st.stamp();
           txn.commit();
           SG_LOG(SG_NAVCACHE, SG_INFO, "final commit took:" << st.elapsedMSec());
+          endPhase("carrier/awy.dat and final commit");
+      }
 
+      // any existing octree snapshot describes the old content
+      bumpOctreeGeneration();
+
+      std::ostringstream summary;
+      for (const auto& phase : phaseTimes) {
+          summary << "\n  " << phase.first << ": " << phase.second << " msec";
       }
+      SG_LOG(SG_NAVCACHE, SG_INFO, "navcache rebuild phases:" << summary.str());
 
   } catch (sg_exception& e) {
     SG_LOG(SG_NAVCACHE, SG_ALERT, "caught exception rebuilding navCache:" << e.what());
@@ -1991,6 +2247,12 @@ void NavDataCache::abortTransaction()
   d->transactionAborted = true;
 }
 
+void NavDataCache::resetStatisticsProperties()
+{
+    d->untieStats();
+    d->tieStats();
+}
+
 void NavDataCache::clearDynamicPositioneds()
 {
     std::for_each(d->cache.begin(), d->cache.end(), [](PositionedCache::value_type& v) {
@@ -2216,13 +2478,27 @@ PositionedID NavDataCache::insertFix(const std::string& ident, const SGGeod& aPo
 
 PositionedID NavDataCache::createPOI(FGPositioned::Type ty, const std::string& ident, const SGGeod& aPos)
 {
-  return d->insertPositioned(ty, ident, string(), aPos, 0,
-                             true /* spatial index */);
+  PositionedID id = d->insertPositioned(ty, ident, string(), aPos, 0,
+                                        true /* spatial index */);
+  if (!rebuildInProgress) {
+    // user waypoints: the flat octree snapshot keeps them in its overlay
+    Octree::addToSnapshot(id, ty, SGVec3d::fromGeod(aPos));
+    octreeOverlayChanged();
+  }
+
+  return id;
 }
 
 bool NavDataCache::removePOI(FGPositioned::Type ty, const std::string& aIdent)
 {
-  d->removePositionedWithIdent(ty, aIdent);
+  const PositionedIDVec removed = d->removePositionedWithIdent(ty, aIdent);
+  if (!rebuildInProgress && !removed.empty()) {
+    for (PositionedID id : removed) {
+      Octree::removeFromSnapshot(id);
+    }
+    octreeOverlayChanged();
+  }
+
   // should remove from the live cache too?
 
     return true;
@@ -2343,6 +2619,71 @@ NavDataCache::getOctreeLeafChildren(int64_t octreeNodeId)
   return r;
 }
 
+std::vector<NavDataCache::OctreeItem> NavDataCache::getAllOctreeItems()
+{
+  std::vector<OctreeItem> r;
+  while (d->stepSelect(d->getAllOctreeItems)) {
+    r.push_back(OctreeItem{
+        sqlite3_column_int64(d->getAllOctreeItems, 0),
+        static_cast<FGPositioned::Type>(sqlite3_column_int(d->getAllOctreeItems, 1)),
+        sqlite3_column_int64(d->getAllOctreeItems, 2),
+        SGVec3d(sqlite3_column_double(d->getAllOctreeItems, 3),
+                sqlite3_column_double(d->getAllOctreeItems, 4),
+                sqlite3_column_double(d->getAllOctreeItems, 5))});
+  }
+
+  d->reset(d->getAllOctreeItems);
+  return r;
+}
+
+int64_t NavDataCache::octreeGeneration()
+{
+  const string value = readStringProperty("octree_generation");
+  if (!value.empty()) {
+    return std::stoll(value);
+  }
+
+  // caches built before the snapshot existed
+  if (isReadOnly()) {
+    return 0;
+  }
+
+  bumpOctreeGeneration();
+  return std::stoll(readStringProperty("octree_generation"));
+}
+
+void NavDataCache::bumpOctreeGeneration()
+{
+  if (isReadOnly()) {
+    return;
+  }
+
+  // any value not used before will do: the current time is simplest
+  SGTimeStamp now;
+  now.stamp();
+  writeStringProperty("octree_generation", std::to_string(now.toUSecs()));
+}
+
+void NavDataCache::octreeOverlayChanged()
+{
+  if (d->octreeOverlayChanged) {
+    return;
+  }
+
+  // Once per run, not per waypoint: the snapshot on disk is stale until it
+  // is written back with its overlay when the cache is closed, and must not
+  // be used if we never get there.
+  bumpOctreeGeneration();
+  d->octreeOverlayChanged = true;
+}
+
+SGPath NavDataCache::octreeSnapshotPath() const
+{
+  SGPath p = d->path;
+  p.concat(".octree");
+  return p;
+}
+
 
 /**
  * A special purpose helper (used by FGAirport::searchNamesAndIdents) to
@@ -2421,6 +2762,20 @@ char** NavDataCache::searchAirportNamesAndIdents(const std::string& searchInput)
 FGPositionedRef
 NavDataCache::findCommByFreq(int freqKhz, const SGGeod& aPos, FGPositioned::Filter* aFilter)
 {
+  if (d->useIndices()) {
+    const int minType = aFilter ? aFilter->minType() : FGPositioned::FREQ_GROUND;
+    const int maxType = aFilter ? aFilter->maxType() : FGPositioned::FREQ_UNICOM;
+    SGVec3d cartPos(SGVec3d::fromGeod(aPos));
+    for (PositionedID id : d->findByFrequency(d->commsByFreq, freqKhz, minType, maxType, &cartPos)) {
+      FGPositionedRef p = loadById(id);
+      if (!aFilter || aFilter->pass(p)) {
+        return p;
+      }
+    }
+
+    return {};
+  }
+
   sqlite3_bind_int(d->findCommByFreq, 1, freqKhz);
   if (aFilter) {
     sqlite3_bind_int(d->findCommByFreq, 2, aFilter->minType());
@@ -2453,6 +2808,14 @@ NavDataCache::findCommByFreq(int freqKhz, const SGGeod& aPos, FGPositioned::Filt
 PositionedIDVec
 NavDataCache::findNavaidsByFreq(int freqKhz, const SGGeod& aPos, FGPositioned::Filter* aFilter)
 {
+  if (d->useIndices()) {
+    SGVec3d cartPos(SGVec3d::fromGeod(aPos));
+    return d->findByFrequency(d->navaidsByFreq, freqKhz,
+                              aFilter ? aFilter->minType() : FGPositioned::NDB,
+                              aFilter ? aFilter->maxType() : FGPositioned::GS,
+                              &cartPos);
+  }
+
   sqlite3_bind_int(d->findNavsByFreq, 1, freqKhz);
   if (aFilter) {
     sqlite3_bind_int(d->findNavsByFreq, 2, aFilter->minType());
@@ -2473,6 +2836,13 @@ NavDataCache::findNavaidsByFreq(int freqKhz, const SGGeod& aPos, FGPositioned::F
 PositionedIDVec
 NavDataCache::findNavaidsByFreq(int freqKhz, FGPositioned::Filter* aFilter)
 {
+  if (d->useIndices()) {
+    return d->findByFrequency(d->navaidsByFreq, freqKhz,
+                              aFilter ? aFilter->minType() : FGPositioned::NDB,
+                              aFilter ? aFilter->maxType() : FGPositioned::GS,
+                              nullptr);
+  }
+
   sqlite3_bind_int(d->findNavsByFreqNoPos, 1, freqKhz);
   if (aFilter) {
     sqlite3_bind_int(d->findNavsByFreqNoPos, 2, aFilter->minType());
@@ -2504,6 +2874,20 @@ PositionedID
 NavDataCache::airportItemWithIdent(PositionedID apt, FGPositioned::Type ty,
                                    const std::string& ident)
 {
+  // empty idents (comm stations, towers) are not indexed
+  if (ident.empty()) {
+    d->indexMisses++;
+  } else if (d->useIndices()) {
+    AirportItemEntry key{apt, ty, ident, 0};
+    auto it = std::lower_bound(d->airportItemsByIdent.begin(), d->airportItemsByIdent.end(), key);
+    if ((it != d->airportItemsByIdent.end()) && (it->airport == apt) &&
+        (it->type == ty) && (it->ident == ident)) {
+      return it->rowid;
+    }
+
+    return 0;
+  }
+
   sqlite3_bind_int64(d->getAirportItemByIdent, 1, apt);
   sqlite_bind_stdstring(d->getAirportItemByIdent, 2, ident);
   sqlite3_bind_int(d->getAirportItemByIdent, 3, ty);
@@ -275,6 +275,30 @@ public:
    */
     TypedPositionedVec getOctreeLeafChildren(int64_t octreeNodeId);
 
+    struct OctreeItem {
+        PositionedID rowid;
+        FGPositioned::Type type;
+        int64_t leaf; ///< octree leaf node ID
+        SGVec3d cart;
+    };
+
+    /**
+     * all spatially indexed items, for building the flat octree snapshot
+     */
+    std::vector<OctreeItem> getAllOctreeItems();
+
+    /**
+     * Identifies the current set of spatially indexed items: changes when
+     * the cache is rebuilt, or POIs are added or removed. Zero if unknown
+     * (read-only cache without the value).
+     */
+    int64_t octreeGeneration();
+
+    /**
+     * where the flat octree snapshot of this cache is stored
+     */
+    SGPath octreeSnapshotPath() const;
+
     // airways
     int findAirway(int network, const std::string& aName, bool create);
 
@@ -319,6 +343,9 @@ public:
 
     bool isReadOnly() const;
 
+    bool isRebuilding() const
+    { return rebuildInProgress; }
+
     class ThreadedGUISearch
     {
     public:
@@ -336,6 +363,12 @@ public:
 
     void clearDynamicPositioneds();
 
+    /**
+     * Tie the statistics under /sim/navdb/stats again, after the property
+     * root was replaced during a reset: the cache outlives the old tree.
+     */
+    void resetStatisticsProperties();
+
 private:
     NavDataCache();
 
@@ -348,6 +381,9 @@ private:
 
     void doRebuild();
 
+    void bumpOctreeGeneration();
+    void octreeOverlayChanged();
+
     friend class Transaction;
 
     void beginTransaction();
@@ -28,10 +28,13 @@
 
 #include <cassert>
 #include <algorithm> // for sort
+#include <cmath>
 #include <cstring> // for memset
 #include <iostream>
 
 #include <simgear/debug/logstream.hxx>
+#include <simgear/io/iostreams/sgstream.hxx>
+#include <simgear/io/sg_mmap.hxx>
 #include <simgear/structure/exception.hxx>
 #include <simgear/timing/timestamp.hxx>
 
@@ -46,8 +49,19 @@ namespace Octree
 static std::unique_ptr<Node> global_spatialOctree;
 static std::unique_ptr<Node> global_transientOctree;
 
+static std::unique_ptr<FlatSnapshot> global_snapshot;
+// set once loading or building the snapshot was attempted, so a failure
+// isn't retried on every search
+static bool global_snapshotAttempted = false;
+
 double RADIUS_EARTH_M = 7000 * 1000.0; // 7000km is plenty
 
+static SGBoxd rootBox()
+{
+    SGVec3d earthExtent(RADIUS_EARTH_M, RADIUS_EARTH_M, RADIUS_EARTH_M);
+    return SGBoxd(-earthExtent, earthExtent);
+}
+
 Node* globalTransientOctree()
 {
     if (!global_transientOctree) {
@@ -333,6 +347,10 @@ int Branch::childMask() const
 
 bool findNearestN(const SGVec3d& aPos, unsigned int aN, double aCutoffM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec)
 {
+  if (FlatSnapshot* snapshot = activeSnapshot()) {
+    return snapshot->findNearestN(aPos, aN, aCutoffM, aFilter, aResults, aCutoffMsec);
+  }
+
   aResults.clear();
   FindNearestPQueue pq;
   FindNearestResults results;
@@ -374,6 +392,10 @@ bool findNearestN(const SGVec3d& aPos, unsigned int aN, double aCutoffM, FGPosit
 
 bool findAllWithinRange(const SGVec3d& aPos, double aRangeM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec)
 {
+  if (FlatSnapshot* snapshot = activeSnapshot()) {
+    return snapshot->findAllWithinRange(aPos, aRangeM, aFilter, aResults, aCutoffMsec);
+  }
+
   aResults.clear();
   FindNearestPQueue pq;
   FindNearestResults results;
@@ -400,6 +422,645 @@ bool findAllWithinRange(const SGVec3d& aPos, double aRangeM, FGPositioned::Filte
   return !pq.empty();
 }
 
+bool findAllWithinRangeBatch(const std::vector<RangeQuery>& aQueries, FGPositionedList& aItems,
+                             std::vector<size_t>& aOffsets, int aCutoffMsec)
+{
+  aItems.clear();
+  aOffsets.assign(1, 0);
+
+  const size_t MAX_BATCH = 64; // queries per traversal, one bit each
+  FlatSnapshot* snapshot = activeSnapshot();
+  std::vector<FindNearestResults> results;
+  FGPositionedList single;
+  bool partial = false;
+
+  for (size_t first = 0; first < aQueries.size(); first += MAX_BATCH) {
+    const size_t count = std::min(MAX_BATCH, aQueries.size() - first);
+
+    if (snapshot) {
+      results.assign(count, FindNearestResults());
+      partial |= snapshot->findAllWithinRangeBatch(&aQueries[first], count, results, aCutoffMsec);
+      for (const auto& r : results) {
+        for (const auto& item : r) {
+          aItems.push_back(item.get());
+        }
+        aOffsets.push_back(aItems.size());
+      }
+      continue;
+    }
+
+    // no snapshot: one search of the lazily loaded tree per query
+    for (size_t q = first; q < first + count; ++q) {
+      single.clear();
+      if (aQueries[q].rangeM >= 0.0) {
+        partial |= findAllWithinRange(aQueries[q].cart, aQueries[q].rangeM, aQueries[q].filter, single, aCutoffMsec);
+      }
+      aItems.insert(aItems.end(), single.begin(), single.end());
+      aOffsets.push_back(aItems.size());
+    }
+  }
+
+  return partial;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const uint32_t SNAPSHOT_MAGIC = 0x534f4746; // 'FGOS'
+const uint32_t SNAPSHOT_VERSION = 2;
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t generation;
+    uint64_t nodeCount;
+    uint64_t itemCount;
+    // the overlay follows the items
+    uint64_t addedCount;
+    uint64_t removedCount;
+};
+
+SGBoxd childBox(const SGBoxd& parent, unsigned int aCorner)
+{
+    // must match Branch::boxForChild
+    SGBoxd r(parent.getCenter());
+    r.expandBy(parent.getCorner(aCorner));
+    return r;
+}
+
+double distToNode(const SGVec3d& aPos, const FlatSnapshot::FlatNode& aNode)
+{
+    double d2 = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        double d = 0.0;
+        if (aPos[i] < aNode.boxMin[i]) {
+            d = aNode.boxMin[i] - aPos[i];
+        } else if (aPos[i] > aNode.boxMax[i]) {
+            d = aPos[i] - aNode.boxMax[i];
+        }
+        d2 += d * d;
+    }
+    return sqrt(d2);
+}
+
+typedef std::pair<double, uint32_t> QueuedNode;
+
+} // of anonymous namespace
+
+FlatSnapshot::~FlatSnapshot()
+{
+    if (_mapped) {
+        _mapped->close();
+    }
+}
+
+std::unique_ptr<FlatSnapshot> FlatSnapshot::build(std::vector<NavDataCache::OctreeItem> items)
+{
+    // all leaves are at the same depth, see Branch::childAtIndex
+    const SGBoxd root = rootBox();
+    int leafDepth = 0;
+    for (SGBoxd box = root;;) {
+        box = childBox(box, 0);
+        ++leafDepth;
+        if (dot(box.getSize(), box.getSize()) < LEAF_SIZE_SQR) {
+            break;
+        }
+    }
+
+    const int64_t firstLeaf = int64_t(1) << (3 * leafDepth);
+    for (const auto& item : items) {
+        if ((item.leaf < firstLeaf) || (item.leaf >= 2 * firstLeaf)) {
+            SG_LOG(SG_NAVCACHE, SG_WARN, "octree snapshot: item " << item.rowid << " has invalid leaf " << item.leaf);
+            return {};
+        }
+    }
+
+    std::sort(items.begin(), items.end(), [](const NavDataCache::OctreeItem& a, const NavDataCache::OctreeItem& b) {
+        if (a.leaf != b.leaf) {
+            return a.leaf < b.leaf;
+        }
+        if (a.type != b.type) {
+            return a.type < b.type;
+        }
+        return a.rowid < b.rowid;
+    });
+
+    // node IDs of each level, in ascending order; since children append
+    // three bits to the parent ID, the children of each node are contiguous
+    std::vector<std::vector<int64_t>> levels(leafDepth + 1);
+    for (const auto& item : items) {
+        if (levels[leafDepth].empty() || (levels[leafDepth].back() != item.leaf)) {
+            levels[leafDepth].push_back(item.leaf);
+        }
+    }
+
+    for (int depth = leafDepth - 1; depth >= 0; --depth) {
+        for (int64_t childId : levels[depth + 1]) {
+            const int64_t id = childId >> 3;
+            if (levels[depth].empty() || (levels[depth].back() != id)) {
+                levels[depth].push_back(id);
+            }
+        }
+    }
+
+    if (levels[0].empty()) {
+        // empty cache: keep a root without children
+        levels[0].push_back(1);
+    }
+
+    std::unique_ptr<FlatSnapshot> result(new FlatSnapshot);
+    std::vector<FlatNode>& nodes = result->_ownedNodes;
+    std::vector<SGBoxd> boxes;
+
+    auto addNode = [&nodes, &boxes](const SGBoxd& box) {
+        FlatNode n = {};
+        for (int i = 0; i < 3; ++i) {
+            n.boxMin[i] = box.getMin()[i];
+            n.boxMax[i] = box.getMax()[i];
+        }
+        nodes.push_back(n);
+        boxes.push_back(box);
+    };
+
+    addNode(root);
+    size_t levelStart = 0;
+    size_t nextItem = 0;
+    for (int depth = 0; depth <= leafDepth; ++depth) {
+        const size_t childLevelStart = levelStart + levels[depth].size();
+        size_t child = 0;
+
+        for (size_t i = 0; i < levels[depth].size(); ++i) {
+            const size_t nodeIndex = levelStart + i;
+            const int64_t id = levels[depth][i];
+
+            if (depth == leafDepth) {
+                nodes[nodeIndex].firstItem = static_cast<uint32_t>(nextItem);
+                while ((nextItem < items.size()) && (items[nextItem].leaf == id)) {
+                    ++nextItem;
+                }
+                nodes[nodeIndex].itemCount = static_cast<uint32_t>(nextItem - nodes[nodeIndex].firstItem);
+                continue;
+            }
+
+            const std::vector<int64_t>& childLevel = levels[depth + 1];
+            nodes[nodeIndex].firstChild = static_cast<uint32_t>(childLevelStart + child);
+            while ((child < childLevel.size()) && ((childLevel[child] >> 3) == id)) {
+                addNode(childBox(boxes[nodeIndex], childLevel[child] & 0x07));
+                ++child;
+            }
+            nodes[nodeIndex].childCount = static_cast<uint32_t>(childLevelStart + child - nodes[nodeIndex].firstChild);
+        }
+
+        levelStart = childLevelStart;
+    }
+
+    std::vector<FlatItem>& flatItems = result->_ownedItems;
+    flatItems.reserve(items.size());
+    for (const auto& item : items) {
+        FlatItem f = {};
+        f.cart[0] = item.cart.x();
+        f.cart[1] = item.cart.y();
+        f.cart[2] = item.cart.z();
+        f.rowid = item.rowid;
+        f.type = item.type;
+        flatItems.push_back(f);
+    }
+
+    result->_nodes = nodes.data();
+    result->_nodeCount = nodes.size();
+    result->_items = flatItems.data();
+    result->_itemCount = flatItems.size();
+    return result;
+}
+
+std::unique_ptr<FlatSnapshot> FlatSnapshot::load(const SGPath& path, int64_t generation)
+{
+    if (!path.exists()) {
+        return {};
+    }
+
+    std::unique_ptr<SGMMapFile> mapped(new SGMMapFile(path));
+    if (!mapped->open(SG_IO_IN)) {
+        return {};
+    }
+
+    const char* data = mapped->get();
+    const size_t size = mapped->get_size();
+    if (!data || (size < sizeof(SnapshotHeader))) {
+        return {};
+    }
+
+    SnapshotHeader header;
+    memcpy(&header, data, sizeof(header));
+    if ((header.magic != SNAPSHOT_MAGIC) || (header.version != SNAPSHOT_VERSION) ||
+        (header.generation != generation) || (header.nodeCount == 0)) {
+        return {};
+    }
+
+    const size_t itemsEnd = sizeof(SnapshotHeader) + header.nodeCount * sizeof(FlatNode) +
+                            header.itemCount * sizeof(FlatItem);
+    const size_t expectedSize = itemsEnd + header.addedCount * sizeof(FlatItem) +
+                                header.removedCount * sizeof(int64_t);
+    if (size != expectedSize) {
+        SG_LOG(SG_NAVCACHE, SG_WARN, "octree snapshot " << path << " has the wrong size, ignoring");
+        return {};
+    }
+
+    std::unique_ptr<FlatSnapshot> result(new FlatSnapshot);
+    result->_nodes = reinterpret_cast<const FlatNode*>(data + sizeof(SnapshotHeader));
+    result->_nodeCount = header.nodeCount;
+    result->_items = reinterpret_cast<const FlatItem*>(data + sizeof(SnapshotHeader) + header.nodeCount * sizeof(FlatNode));
+    result->_itemCount = header.itemCount;
+
+    result->_added.resize(header.addedCount);
+    memcpy(result->_added.data(), data + itemsEnd, header.addedCount * sizeof(FlatItem));
+    const char* removed = data + itemsEnd + header.addedCount * sizeof(FlatItem);
+    for (uint64_t i = 0; i < header.removedCount; ++i) {
+        int64_t rowid;
+        memcpy(&rowid, removed + i * sizeof(int64_t), sizeof(rowid));
+        result->_removed.insert(rowid);
+    }
+
+    result->_mapped = std::move(mapped);
+    return result;
+}
+
+bool FlatSnapshot::save(const SGPath& path, int64_t generation) const
+{
+    // write to a temporary file first, another process may have the
+    // current one mapped
+    SGPath tmp = path;
+    tmp.concat(".tmp");
+
+    {
+        sg_ofstream out(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+
+        SnapshotHeader header = {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, generation, _nodeCount, _itemCount,
+                                 _added.size(), _removed.size()};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(_nodes), _nodeCount * sizeof(FlatNode));
+        out.write(reinterpret_cast<const char*>(_items), _itemCount * sizeof(FlatItem));
+        out.write(reinterpret_cast<const char*>(_added.data()), _added.size() * sizeof(FlatItem));
+        for (PositionedID rowid : _removed) {
+            const int64_t r = rowid;
+            out.write(reinterpret_cast<const char*>(&r), sizeof(r));
+        }
+        if (!out) {
+            return false;
+        }
+    }
+
+    SGPath target = path;
+    if (target.exists()) {
+        target.remove();
+    }
+    return tmp.rename(target);
+}
+
+void FlatSnapshot::addItem(PositionedID aRowid, FGPositioned::Type aType, const SGVec3d& aCart)
+{
+    FlatItem item = {{aCart.x(), aCart.y(), aCart.z()}, aRowid, aType, 0};
+    auto it = std::upper_bound(_added.begin(), _added.end(), item, [](const FlatItem& a, const FlatItem& b) {
+        return a.type < b.type;
+    });
+    _added.insert(it, item);
+    _overlayChanged = true;
+}
+
+void FlatSnapshot::removeItem(PositionedID aRowid)
+{
+    auto it = std::find_if(_added.begin(), _added.end(), [aRowid](const FlatItem& item) {
+        return item.rowid == aRowid;
+    });
+    if (it != _added.end()) {
+        _added.erase(it);
+    } else {
+        _removed.insert(aRowid);
+    }
+    _overlayChanged = true;
+}
+
+void FlatSnapshot::visitLeaf(const FlatNode& aNode, const SGVec3d& aPos, double aCutoff,
+                             FGPositioned::Filter* aFilter, FindNearestResults& aResults) const
+{
+    const FlatItem* begin = _items + aNode.firstItem;
+    visitItems(begin, begin + aNode.itemCount, aPos, aCutoff, aFilter, aResults);
+}
+
+// the items must be sorted by type
+void FlatSnapshot::visitItems(const FlatItem* aBegin, const FlatItem* aEnd, const SGVec3d& aPos, double aCutoff,
+                              FGPositioned::Filter* aFilter, FindNearestResults& aResults) const
+{
+    const int minType = aFilter ? aFilter->minType() : FGPositioned::INVALID;
+    const int maxType = aFilter ? aFilter->maxType() : FGPositioned::LAST_TYPE;
+
+    const FlatItem* it = std::lower_bound(aBegin, aEnd, minType, [](const FlatItem& item, int ty) {
+        return item.type < ty;
+    });
+
+    const size_t previousResultsSize = aResults.size();
+    NavDataCache* cache = NavDataCache::instance();
+
+    for (; (it != aEnd) && (it->type <= maxType); ++it) {
+        if (!_removed.empty() && _removed.count(it->rowid)) {
+            continue;
+        }
+
+        // test the distance before loading the item
+        double d = dist(aPos, SGVec3d(it->cart[0], it->cart[1], it->cart[2]));
+        if (d > aCutoff) {
+            continue;
+        }
+
+        FGPositioned* p = cache->loadById(it->rowid);
+        if (aFilter && !aFilter->pass(p)) {
+            continue;
+        }
+
+        aResults.push_back(OrderedPositioned(p, d));
+    }
+
+    if (aResults.size() == previousResultsSize) {
+        return;
+    }
+
+    // keep aResults sorted, as Leaf::visit does
+    std::sort(aResults.begin() + previousResultsSize, aResults.end());
+    std::inplace_merge(aResults.begin(),
+                       aResults.begin() + previousResultsSize, aResults.end());
+}
+
+bool FlatSnapshot::findNearestN(const SGVec3d& aPos, unsigned int aN, double aCutoffM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec) const
+{
+    aResults.clear();
+
+    FindNearestResults results;
+    std::vector<QueuedNode> pq;
+
+    // min-heap on the distance
+    const auto heapCompare = std::greater<QueuedNode>();
+    pq.push_back(QueuedNode(0.0, 0));
+
+    SGTimeStamp tm;
+    tm.stamp();
+
+    while (!pq.empty() && (tm.elapsedMSec() < aCutoffMsec)) {
+        if (!results.empty() && (results.size() >= aN) && (results.back().order() < pq.front().first)) {
+            // no node still on the queue contains a closer match
+            pq.clear();
+            break;
+        }
+
+        std::pop_heap(pq.begin(), pq.end(), heapCompare);
+        const FlatNode& nd = _nodes[pq.back().second];
+        pq.pop_back();
+
+        if (nd.childCount == 0) {
+            visitLeaf(nd, aPos, aCutoffM, aFilter, results);
+            continue;
+        }
+
+        for (uint32_t c = nd.firstChild; c < nd.firstChild + nd.childCount; ++c) {
+            double d = distToNode(aPos, _nodes[c]);
+            if (d > aCutoffM) {
+                continue;
+            }
+
+            pq.push_back(QueuedNode(d, c));
+            std::push_heap(pq.begin(), pq.end(), heapCompare);
+        }
+    }
+
+    visitItems(_added.data(), _added.data() + _added.size(), aPos, aCutoffM, aFilter, results);
+
+    unsigned int numResults = std::min((unsigned int) results.size(), aN);
+    aResults.resize(numResults);
+    for (unsigned int r = 0; r < numResults; ++r) {
+        aResults[r] = results[r].get();
+    }
+
+    return !pq.empty();
+}
+
+bool FlatSnapshot::findAllWithinRange(const SGVec3d& aPos, double aRangeM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec) const
+{
+    aResults.clear();
+
+    FindNearestResults results;
+    std::vector<uint32_t> stack;
+
+    // no ordering needed when collecting everything in range
+    stack.push_back(0);
+
+    SGTimeStamp tm;
+    tm.stamp();
+
+    while (!stack.empty() && (tm.elapsedMSec() < aCutoffMsec)) {
+        const FlatNode& nd = _nodes[stack.back()];
+        stack.pop_back();
+
+        if (nd.childCount == 0) {
+            visitLeaf(nd, aPos, aRangeM, aFilter, results);
+            continue;
+        }
+
+        for (uint32_t c = nd.firstChild; c < nd.firstChild + nd.childCount; ++c) {
+            if (distToNode(aPos, _nodes[c]) <= aRangeM) {
+                stack.push_back(c);
+            }
+        }
+    }
+
+    visitItems(_added.data(), _added.data() + _added.size(), aPos, aRangeM, aFilter, results);
+
+    aResults.resize(results.size());
+    for (size_t r = 0; r < results.size(); ++r) {
+        aResults[r] = results[r].get();
+    }
+
+    return !stack.empty();
+}
+
+bool FlatSnapshot::findAllWithinRangeBatch(const RangeQuery* aQueries, size_t aCount,
+                                           std::vector<FindNearestResults>& aResults, int aCutoffMsec) const
+{
+    assert(aCount <= 64);
+    assert(aResults.size() >= aCount);
+
+    // the type range of each query, to avoid virtual calls per item
+    int minType[64], maxType[64];
+    uint64_t rootMask = 0;
+    for (size_t q = 0; q < aCount; ++q) {
+        FGPositioned::Filter* filter = aQueries[q].filter;
+        minType[q] = filter ? filter->minType() : FGPositioned::INVALID;
+        maxType[q] = filter ? filter->maxType() : FGPositioned::LAST_TYPE;
+        if (aQueries[q].rangeM >= 0.0) {
+            rootMask |= uint64_t(1) << q;
+        }
+    }
+
+    // nodes to visit, with the set of queries whose range reaches them
+    std::vector<std::pair<uint32_t, uint64_t>> stack;
+    if (rootMask) {
+        stack.emplace_back(0, rootMask);
+    }
+
+    NavDataCache* cache = NavDataCache::instance();
+    SGTimeStamp tm;
+    tm.stamp();
+
+    while (!stack.empty() && (tm.elapsedMSec() < aCutoffMsec)) {
+        const FlatNode& nd = _nodes[stack.back().first];
+        const uint64_t mask = stack.back().second;
+        stack.pop_back();
+
+        if (nd.childCount > 0) {
+            for (uint32_t c = nd.firstChild; c < nd.firstChild + nd.childCount; ++c) {
+                uint64_t childMask = 0;
+                for (size_t q = 0; q < aCount; ++q) {
+                    if ((mask & (uint64_t(1) << q)) &&
+                        (distToNode(aQueries[q].cart, _nodes[c]) <= aQueries[q].rangeM)) {
+                        childMask |= uint64_t(1) << q;
+                    }
+                }
+
+                if (childMask) {
+                    stack.emplace_back(c, childMask);
+                }
+            }
+            continue;
+        }
+
+        const FlatItem* end = _items + nd.firstItem + nd.itemCount;
+        for (const FlatItem* it = _items + nd.firstItem; it != end; ++it) {
+            if (!_removed.empty() && _removed.count(it->rowid)) {
+                continue;
+            }
+
+            const SGVec3d cart(it->cart[0], it->cart[1], it->cart[2]);
+            FGPositioned* p = nullptr; // loaded once, by the first query needing it
+
+            for (size_t q = 0; q < aCount; ++q) {
+                if (!(mask & (uint64_t(1) << q)) || (it->type < minType[q]) || (it->type > maxType[q])) {
+                    continue;
+                }
+
+                const double d = dist(aQueries[q].cart, cart);
+                if (d > aQueries[q].rangeM) {
+                    continue;
+                }
+
+                if (!p) {
+                    p = cache->loadById(it->rowid);
+                }
+
+                if (aQueries[q].filter && !aQueries[q].filter->pass(p)) {
+                    continue;
+                }
+
+                aResults[q].push_back(OrderedPositioned(p, d));
+            }
+        }
+    }
+
+    for (size_t q = 0; q < aCount; ++q) {
+        std::sort(aResults[q].begin(), aResults[q].end());
+        if (aQueries[q].rangeM >= 0.0) {
+            visitItems(_added.data(), _added.data() + _added.size(), aQueries[q].cart,
+                       aQueries[q].rangeM, aQueries[q].filter, aResults[q]);
+        }
+    }
+
+    return !stack.empty();
+}
+
+FlatSnapshot* activeSnapshot()
+{
+    if (global_snapshot || global_snapshotAttempted) {
+        return global_snapshot.get();
+    }
+
+    NavDataCache* cache = NavDataCache::instance();
+    if (!cache || cache->isRebuilding()) {
+        return nullptr;
+    }
+
+    global_snapshotAttempted = true;
+    const int64_t generation = cache->octreeGeneration();
+    if (generation == 0) {
+        return nullptr;
+    }
+
+    SGTimeStamp st;
+    st.stamp();
+
+    const SGPath path = cache->octreeSnapshotPath();
+    global_snapshot = FlatSnapshot::load(path, generation);
+    if (global_snapshot) {
+        SG_LOG(SG_NAVCACHE, SG_INFO, "mapped octree snapshot with " << global_snapshot->itemCount()
+                                     << " items in " << st.elapsedMSec() << "msec");
+        return global_snapshot.get();
+    }
+
+    global_snapshot = FlatSnapshot::build(cache->getAllOctreeItems());
+    if (!global_snapshot) {
+        return nullptr;
+    }
+
+    SG_LOG(SG_NAVCACHE, SG_INFO, "built octree snapshot with " << global_snapshot->itemCount()
+                                 << " items in " << st.elapsedMSec() << "msec");
+
+    if (!cache->isReadOnly() && !global_snapshot->save(path, generation)) {
+        SG_LOG(SG_NAVCACHE, SG_WARN, "unable to write octree snapshot to " << path);
+    }
+
+    return global_snapshot.get();
+}
+
+void addToSnapshot(PositionedID aRowid, FGPositioned::Type aType, const SGVec3d& aCart)
+{
+    // map the snapshot now: the one on disk doesn't have the item yet
+    if (FlatSnapshot* snapshot = activeSnapshot()) {
+        snapshot->addItem(aRowid, aType, aCart);
+    }
+}
+
+void removeFromSnapshot(PositionedID aRowid)
+{
+    if (FlatSnapshot* snapshot = activeSnapshot()) {
+        snapshot->removeItem(aRowid);
+    }
+}
+
+void saveSnapshot()
+{
+    NavDataCache* cache = NavDataCache::instance();
+    if (!global_snapshot || !global_snapshot->overlayChanged() || !cache || cache->isReadOnly()) {
+        return;
+    }
+
+    const SGPath path = cache->octreeSnapshotPath();
+    if (!global_snapshot->save(path, cache->octreeGeneration())) {
+        SG_LOG(SG_NAVCACHE, SG_WARN, "unable to write octree snapshot to " << path);
+    }
+}
+
+void invalidateSnapshot()
+{
+    global_snapshot.reset();
+    global_snapshotAttempted = true;
+}
+
+void discardSnapshot()
+{
+    global_snapshot.reset();
+    global_snapshotAttempted = false;
+}
+
 } // of namespace Octree
 
 } // of namespace flightgear
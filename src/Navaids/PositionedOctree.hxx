@@ -27,14 +27,19 @@
 // std
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <vector>
 
 // SimGear
 #include <simgear/math/SGGeometry.hxx>
+#include <simgear/misc/sg_path.hxx>
+
+class SGMMapFile;
 
 #include <Navaids/positioned.hxx>
 #include <Navaids/NavDataCache.hxx>
@@ -246,8 +251,153 @@ namespace Octree
     mutable bool _childrenLoaded = false;
   };
 
+  /// one search of a batch, see findAllWithinRangeBatch()
+  struct RangeQuery {
+      SGVec3d cart;
+      double rangeM; ///< negative to match nothing
+      FGPositioned::Filter* filter;
+  };
+
+  /**
+   * Read-only copy of the persistent octree, stored as two flat arrays:
+   * the nodes in breadth-first order, each with its box, the range of its
+   * children (which are contiguous) and, for leaves, the range of its
+   * items; and the items, grouped by leaf and sorted by type, with their
+   * cartesian position. The layout holds no pointers, so it is written to
+   * a file next to the navigation cache and memory-mapped on later runs.
+   *
+   * Only nodes which contain items are present. Searches only load the
+   * FGPositioned instances which are within range and pass the type
+   * range of the filter.
+   */
+  class FlatSnapshot
+  {
+  public:
+      struct FlatNode {
+          double boxMin[3];
+          double boxMax[3];
+          uint32_t firstChild;
+          uint32_t childCount; // zero for leaves
+          uint32_t firstItem;
+          uint32_t itemCount;
+      };
+
+      struct FlatItem {
+          double cart[3];
+          int64_t rowid;
+          int32_t type;
+          int32_t padding;
+      };
+
+      ~FlatSnapshot();
+
+      /**
+       * Build the snapshot from all spatially indexed items of the cache.
+       * Returns nullptr if the items don't describe a valid tree.
+       */
+      static std::unique_ptr<FlatSnapshot> build(std::vector<NavDataCache::OctreeItem> items);
+
+      /**
+       * Memory-map a snapshot file; returns nullptr if it is missing, damaged
+       * or was written for another generation of the cache content.
+       */
+      static std::unique_ptr<FlatSnapshot> load(const SGPath& path, int64_t generation);
+      bool save(const SGPath& path, int64_t generation) const;
+
+      size_t nodeCount() const
+      { return _nodeCount; }
+
+      size_t itemCount() const
+      { return _itemCount; }
+
+      /**
+       * Items created or removed at runtime, such as user waypoints, are
+       * kept in a small overlay which searches take into account, instead
+       * of rebuilding the snapshot. The overlay is saved with the snapshot.
+       */
+      void addItem(PositionedID aRowid, FGPositioned::Type aType, const SGVec3d& aCart);
+      void removeItem(PositionedID aRowid);
+
+      /// true if the overlay changed since the snapshot was loaded or built
+      bool overlayChanged() const
+      { return _overlayChanged; }
+
+      bool findNearestN(const SGVec3d& aPos, unsigned int aN, double aCutoffM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec) const;
+      bool findAllWithinRange(const SGVec3d& aPos, double aRangeM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec) const;
+
+      /**
+       * Range searches for up to 64 queries in one traversal: a node is
+       * visited once, for all queries whose range reaches it.
+       */
+      bool findAllWithinRangeBatch(const RangeQuery* aQueries, size_t aCount,
+                                   std::vector<FindNearestResults>& aResults, int aCutoffMsec) const;
+
+  private:
+      FlatSnapshot() = default;
+
+      void visitLeaf(const FlatNode& aNode, const SGVec3d& aPos, double aCutoff,
+                     FGPositioned::Filter* aFilter, FindNearestResults& aResults) const;
+      void visitItems(const FlatItem* aBegin, const FlatItem* aEnd, const SGVec3d& aPos, double aCutoff,
+                      FGPositioned::Filter* aFilter, FindNearestResults& aResults) const;
+
+      // either views into _mapped, or into the owned vectors
+      const FlatNode* _nodes = nullptr;
+      const FlatItem* _items = nullptr;
+      size_t _nodeCount = 0;
+      size_t _itemCount = 0;
+
+      std::unique_ptr<SGMMapFile> _mapped;
+      std::vector<FlatNode> _ownedNodes;
+      std::vector<FlatItem> _ownedItems;
+
+      // the runtime overlay: items added since the snapshot was made, sorted
+      // by type, and rowids of removed items to skip
+      std::vector<FlatItem> _added;
+      std::set<PositionedID> _removed;
+      bool _overlayChanged = false;
+  };
+
+  /**
+   * The flat snapshot of the persistent octree, loaded or built on first
+   * use. nullptr while the cache is being rebuilt, or once the snapshot
+   * was invalidated.
+   */
+  FlatSnapshot* activeSnapshot();
+
+  /**
+   * Spatially indexed items created or removed at runtime, e.g. user
+   * waypoints: the snapshot keeps them in its overlay.
+   */
+  void addToSnapshot(PositionedID aRowid, FGPositioned::Type aType, const SGVec3d& aCart);
+  void removeFromSnapshot(PositionedID aRowid);
+
+  /**
+   * Write the snapshot back if its overlay changed, under the current
+   * generation of the cache; used when the cache is closed.
+   */
+  void saveSnapshot();
+
+  /**
+   * Drop the snapshot: searches use the lazily loaded tree for the rest of
+   * the run.
+   */
+  void invalidateSnapshot();
+
+  /**
+   * Drop the snapshot, and load or build it again on next use; used when
+   * the cache is rebuilt or closed.
+   */
+  void discardSnapshot();
+
   bool findNearestN(const SGVec3d& aPos, unsigned int aN, double aCutoffM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec);
   bool findAllWithinRange(const SGVec3d& aPos, double aRangeM, FGPositioned::Filter* aFilter, FGPositionedList& aResults, int aCutoffMsec);
+
+  /**
+   * Several range searches at once; the results of query i are stored in
+   * aItems[aOffsets[i] .. aOffsets[i + 1]), each sorted by distance.
+   */
+  bool findAllWithinRangeBatch(const std::vector<RangeQuery>& aQueries, FGPositionedList& aItems,
+                               std::vector<size_t>& aOffsets, int aCutoffMsec);
 } // of namespace Octree
 
 
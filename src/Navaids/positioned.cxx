@@ -322,6 +322,22 @@ FGPositioned::findWithinRangePartial(const SGGeod& aPos, double aRangeNm, Filter
   return result;
 }
 
+bool
+FGPositioned::findWithinRangeBatch(const std::vector<RangeQuery>& aQueries, BatchResults& aResults,
+                                   int aLimitMsec)
+{
+  std::vector<Octree::RangeQuery> queries;
+  queries.reserve(aQueries.size());
+  for (const auto& q : aQueries) {
+    validateSGGeod(q.pos);
+    // invalid filters give empty results, as for findWithinRange()
+    const bool valid = validateFilter(q.filter);
+    queries.push_back({SGVec3d::fromGeod(q.pos), valid ? q.rangeNm * SG_NM_TO_METER : -1.0, q.filter});
+  }
+
+  return Octree::findAllWithinRangeBatch(queries, aResults.items, aResults.offsets, aLimitMsec);
+}
+
 FGPositionedList
 FGPositioned::findAllWithIdent(const std::string& aIdent, Filter* aFilter, bool aExact)
 {
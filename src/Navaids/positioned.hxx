@@ -199,6 +199,44 @@ public:
   static FGPositionedList findWithinRange(const SGGeod& aPos, double aRangeNm, Filter* aFilter);
   
   static FGPositionedList findWithinRangePartial(const SGGeod& aPos, double aRangeNm, Filter* aFilter, bool& aPartial);
+
+  /**
+   * One range search of a batch, see findWithinRangeBatch()
+   */
+  struct RangeQuery
+  {
+    SGGeod pos;
+    double rangeNm;
+    Filter* filter;
+  };
+
+  /**
+   * Results of a batch of range searches: the items found by query i are
+   * items[offsets[i]] .. items[offsets[i + 1] - 1], sorted by distance.
+   */
+  struct BatchResults
+  {
+    FGPositionedList items;
+    std::vector<size_t> offsets;
+
+    size_t count(size_t query) const
+    { return offsets[query + 1] - offsets[query]; }
+
+    FGPositionedList::const_iterator begin(size_t query) const
+    { return items.begin() + offsets[query]; }
+
+    FGPositionedList::const_iterator end(size_t query) const
+    { return items.begin() + offsets[query + 1]; }
+  };
+
+  /**
+   * Answer several range searches, typically with different filters, in
+   * one traversal of the spatial index. Each query gives the same result
+   * as findWithinRange(). With a time-bound in msec, returns true if the
+   * results are partial.
+   */
+  static bool findWithinRangeBatch(const std::vector<RangeQuery>& aQueries, BatchResults& aResults,
+                                   int aLimitMsec = 0xffffff);
         
   static FGPositionedRef findClosestWithIdent(const std::string& aIdent, const SGGeod& aPos, Filter* aFilter = NULL);
 
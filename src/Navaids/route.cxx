@@ -214,6 +214,20 @@ void Waypt::setFlag(WayptFlag aFlag, bool aV)
 
   _flags = (_flags & ~aFlag);
   if (aV) _flags |= aFlag;
+  markModified();
+}
+
+static unsigned int static_waypointModificationCount = 0;
+
+unsigned int Waypt::modificationCount()
+{
+    return static_waypointModificationCount;
+}
+
+void Waypt::markModified()
+{
+    ++_revision;
+    ++static_waypointModificationCount;
 }
 
 bool Waypt::matches(Waypt* aOther) const
@@ -254,11 +268,13 @@ void Waypt::setAltitude(double aAlt, RouteRestriction aRestrict, RouteUnits aUni
   _altitude = aAlt;
     _altitudeUnits = aUnit;
   _altRestrict = aRestrict;
+    markModified();
 }
 
 void Waypt::setConstraintAltitude(double aAlt)
 {
     _constraintAltitude = aAlt;
+    markModified();
 }
 
 void Waypt::setSpeed(double aSpeed, RouteRestriction aRestrict, RouteUnits aUnit)
@@ -274,6 +290,7 @@ void Waypt::setSpeed(double aSpeed, RouteRestriction aRestrict, RouteUnits aUnit
   _speed = aSpeed;
   _speedUnits = aUnit;
   _speedRestrict = aRestrict;
+    markModified();
 }
 
 double Waypt::speedKts() const
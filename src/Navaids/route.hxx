@@ -157,6 +157,19 @@ public:
   { return _flags; }
   
   void setFlag(WayptFlag aFlag, bool aV = true);
+
+    /**
+     * Incremented each time this waypoint is modified in place, so cached
+     * route paths through it can tell they are stale.
+     */
+    unsigned int revision() const
+    { return _revision; }
+
+    /**
+     * Incremented each time any waypoint is modified in place: owners of
+     * cached paths only compare revisions once this has changed.
+     */
+    static unsigned int modificationCount();
   
   /**
    * Factory method
@@ -234,6 +247,11 @@ protected:
     typedef Waypt*(FactoryFunction)(RouteBase* aOwner);
     static void registerFactory(const std::string aNodeType, FactoryFunction* aFactory);
 
+    /**
+     * Setters call this, to bump the revision of the waypoint
+     */
+    void markModified();
+
     double _altitude = 0.0;
     /// some restriction types specify two altitudes, in which case this is the second value, corresponding to
     ///  AltitudeCons in the level-D XML procedures format.
@@ -255,6 +273,7 @@ private:
 
     const RouteBase* _owner = nullptr;
 	unsigned short _flags = 0;
+    unsigned int _revision = 0;
     mutable double _magVarDeg = 0.0; ///< cached mag var at this location
 };
 
@@ -259,7 +259,8 @@ public:
     pathDistanceM(0.0),
     turnPathDistanceM(0.0),
     overflightCompensationAngle(0.0),
-    flyOver(w->flag(WPT_OVERFLIGHT))
+    flyOver(w->flag(WPT_OVERFLIGHT)),
+    revision(w->revision())
   {
   }
   
@@ -624,6 +625,32 @@ public:
       theta = copysign(theta, turnEntryAngle);
       return pointOnEntryTurnFromHeading(legCourseTrue + theta);
   }
+
+  /**
+   * test if the other data is for the same waypoint, with identical
+   * computed position, courses and turns
+   */
+  bool sameResultAs(const WayptData& other) const
+  {
+    auto sameGeod = [](const SGGeod& a, const SGGeod& b) {
+      return (a.getLongitudeRad() == b.getLongitudeRad()) &&
+             (a.getLatitudeRad() == b.getLatitudeRad()) &&
+             (a.getElevationM() == b.getElevationM());
+    };
+
+    return (wpt == other.wpt) && (hasEntry == other.hasEntry) &&
+           (posValid == other.posValid) && (legCourseValid == other.legCourseValid) &&
+           (skipped == other.skipped) && (flyOver == other.flyOver) &&
+           sameGeod(pos, other.pos) && sameGeod(turnEntryPos, other.turnEntryPos) &&
+           sameGeod(turnExitPos, other.turnExitPos) &&
+           sameGeod(turnEntryCenter, other.turnEntryCenter) &&
+           sameGeod(turnExitCenter, other.turnExitCenter) &&
+           (turnEntryAngle == other.turnEntryAngle) && (turnExitAngle == other.turnExitAngle) &&
+           (turnRadius == other.turnRadius) && (legCourseTrue == other.legCourseTrue) &&
+           (pathDistanceM == other.pathDistanceM) &&
+           (turnPathDistanceM == other.turnPathDistanceM) &&
+           (overflightCompensationAngle == other.overflightCompensationAngle);
+  }
   
   WayptRef wpt;
   bool hasEntry, posValid, legCourseValid, skipped;
@@ -633,6 +660,7 @@ public:
   double turnPathDistanceM; // for flyBy, this is half the distance; for flyOver it's the complete distance
   double overflightCompensationAngle;
   bool flyOver;
+  unsigned int revision; // of wpt, when this data was computed
 };
 
 bool isDescentWaypoint(const WayptRef& wpt)
@@ -645,6 +673,13 @@ class RoutePath::RoutePathPrivate
 public:
     WayptDataVec waypoints;
 
+    // state of each waypoint just before its turn was computed, so an
+    // update can restart the computation part-way along the route
+    WayptDataVec initialStates;
+
+    // path distance from the route start to each waypoint
+    std::vector<double> cumulativeDistanceM;
+
     AircraftPerformance perf;
     bool constrainLegCourses;
     double maxFlyByTurnAngleDeg = 90.0;
@@ -866,15 +901,41 @@ public:
     }
 }; // of RoutePathPrivate class
 
-RoutePath::RoutePath(const flightgear::FlightPlan* fp) :
-  d(new RoutePathPrivate)
+/**
+ * The data of the route before an update, which is reused from the point
+ * the recomputed waypoints match it again.
+ */
+struct RoutePath::PreviousState
 {
+    WayptDataVec waypoints;
+    WayptDataVec initialStates;
+
+    // first new index which may be taken from the previous data
+    int firstReusable;
+
+    // (known altitude index, index) of each climbing heading-to-altitude
+    // leg: its position depends on the path between the two
+    std::vector<std::pair<int, int>> climbLegs;
+};
+
+static WayptVec waypointsOfPlan(const flightgear::FlightPlan* fp)
+{
+    WayptVec r;
     for (int l=0; l<fp->numLegs(); ++l) {
         WayptRef wpt = fp->legAtIndex(l)->waypoint();
         if (!wpt) {
             SG_LOG(SG_NAVAID, SG_DEV_ALERT, "Waypoint " << l << " of " << fp->numLegs() << "is NULL");
             break;
         }
+        r.push_back(wpt);
+    }
+    return r;
+}
+
+RoutePath::RoutePath(const flightgear::FlightPlan* fp) :
+  d(new RoutePathPrivate)
+{
+    for (const auto& wpt : waypointsOfPlan(fp)) {
         d->waypoints.push_back(WayptData(wpt));
     }
 
@@ -898,21 +959,131 @@ RoutePath::~RoutePath()
 {
 }
 
-void RoutePath::commonInit()
+void RoutePath::update(const flightgear::FlightPlan* fp, const WayptVec& modified)
 {
-  for (auto& w : d->waypoints) {
-    w.initPass0();
+  const WayptVec wpts = waypointsOfPlan(fp);
+  if (fp->followLegTrackToFixes() != d->constrainLegCourses) {
+    *this = RoutePath(fp);
+    return;
   }
-  
-  for (unsigned int i=1; i<d->waypoints.size(); ++i) {
-    WayptData* nextPtr = ((i + 1) < d->waypoints.size()) ? &d->waypoints[i+1] : nullptr;
-    auto prev = d->previousValidWaypoint(i);
-    WayptData* prevPtr = (prev == d->waypoints.end()) ? nullptr : &(*prev);
-    d->waypoints[i].initPass1(prevPtr, nextPtr);
+
+  const int oldSize = static_cast<int>(d->waypoints.size());
+  const int newSize = static_cast<int>(wpts.size());
+  const int common = std::min(oldSize, newSize);
+
+  auto unchanged = [&](int oldIndex, int newIndex) {
+    const WayptRef& w = wpts[newIndex];
+    return (d->waypoints[oldIndex].wpt == w) &&
+           (d->waypoints[oldIndex].revision == w->revision()) &&
+           (std::find(modified.begin(), modified.end(), w) == modified.end());
+  };
+
+  int prefix = 0;
+  while ((prefix < common) && unchanged(prefix, prefix)) {
+    ++prefix;
+  }
+
+  if ((prefix == oldSize) && (prefix == newSize)) {
+    return; // nothing changed
+  }
+
+  int suffix = 0;
+  while ((suffix < (common - prefix)) && unchanged(oldSize - 1 - suffix, newSize - 1 - suffix)) {
+    ++suffix;
+  }
+
+  // The initial state of a waypoint depends on its successor (vectors take
+  // the next position), and its turn on the next valid waypoint. So the
+  // last valid waypoint before the one preceding the change is the first
+  // whose data can differ; its initial state is still valid.
+  int first = 0;
+  if (prefix >= 2) {
+    auto it = d->previousValidWaypoint(prefix - 1);
+    if (it != d->waypoints.end()) {
+      first = static_cast<int>(std::distance(d->waypoints.begin(), it));
+    }
   }
 
-  for (unsigned int i=0; i<d->waypoints.size(); ++i) {
-      if (d->waypoints[i].skipped) {
+  // descending heading-to-altitude legs use the next known altitude, which
+  // may be in the changed part
+  for (int i = 1; i < first; ++i) {
+    if ((d->waypoints[i].wpt->type() == "hdgToAlt") && isDescentWaypoint(d->waypoints[i - 1].wpt)) {
+      first = i;
+      break;
+    }
+  }
+
+  PreviousState previous;
+  previous.waypoints = std::move(d->waypoints);
+  previous.initialStates = std::move(d->initialStates);
+  previous.firstReusable = std::max(first + 1, newSize - suffix);
+
+  d->waypoints.assign(previous.waypoints.begin(), previous.waypoints.begin() + first);
+  d->initialStates.assign(previous.initialStates.begin(), previous.initialStates.begin() + first);
+  int prepared = 0;
+  if (first > 0) {
+    d->waypoints.push_back(previous.initialStates[first]);
+    prepared = first + 1;
+  }
+
+  for (int i = static_cast<int>(d->waypoints.size()); i < newSize; ++i) {
+    d->waypoints.push_back(WayptData(wpts[i]));
+  }
+
+  for (int i = 1; i < newSize; ++i) {
+    if ((d->waypoints[i].wpt->type() == "hdgToAlt") && !isDescentWaypoint(d->waypoints[i - 1].wpt)) {
+      previous.climbLegs.emplace_back(d->findPreceedingKnownAltitude(i - 1), i);
+    }
+  }
+
+  computeFrom(first, prepared, &previous);
+}
+
+void RoutePath::commonInit()
+{
+  computeFrom(0, 0, nullptr);
+}
+
+/**
+ * Compute the data of the waypoints from 'first' onwards, whose entries
+ * must be fresh apart from the initial state of 'first' itself, if
+ * 'prepared' is past it. With previous data, stop as soon as a waypoint
+ * in the unchanged tail of the route gets the same result as before: the
+ * remaining waypoints cannot change either.
+ */
+void RoutePath::computeFrom(int first, int prepared, const PreviousState* previous)
+{
+  WayptDataVec& wps(d->waypoints);
+  const int sz = static_cast<int>(wps.size());
+
+  // the three passes of the computation, interleaved: the turn of each
+  // waypoint needs the first two passes up to the next valid waypoint
+  int pass0 = prepared, pass1 = prepared;
+  auto prepare = [&](int index) {
+    index = std::min(index, sz - 1);
+    for (; pass1 <= index; ++pass1) {
+      // vectors use the position of the following waypoint
+      for (; pass0 <= std::min(pass1 + 1, sz - 1); ++pass0) {
+        wps[pass0].initPass0();
+      }
+
+      if (pass1 > 0) {
+        WayptData* nextPtr = ((pass1 + 1) < sz) ? &wps[pass1 + 1] : nullptr;
+        auto prev = d->previousValidWaypoint(pass1);
+        WayptData* prevPtr = (prev == wps.end()) ? nullptr : &(*prev);
+        wps[pass1].initPass1(prevPtr, nextPtr);
+      }
+    }
+  };
+
+  for (int i=first; i<sz; ++i) {
+      int next = i;
+      do {
+        prepare(++next);
+      } while ((next < sz) && (wps[next].skipped || (wps[next].wpt->type() == "discontinuity")));
+
+      d->initialStates.push_back(wps[i]);
+      if (wps[i].skipped) {
           continue;
       }
 
@@ -947,6 +1118,32 @@ void RoutePath::commonInit()
     
     // now turn is computed, can resolve distances
     d->waypoints[i].pathDistanceM = computeDistanceForIndex(i);
+
+    if (previous && (i >= previous->firstReusable) && (wps[i].wpt->type() != "discontinuity")) {
+        const int offset = static_cast<int>(previous->waypoints.size()) - sz;
+        bool reusable = wps[i].sameResultAs(previous->waypoints[i + offset]);
+        for (const auto& climb : previous->climbLegs) {
+            if ((climb.second > i) && (climb.first < i)) {
+                reusable = false; // its position depends on the path up to here
+            }
+        }
+
+        if (reusable) {
+            wps.erase(wps.begin() + i + 1, wps.end());
+            wps.insert(wps.end(), previous->waypoints.begin() + i + 1 + offset, previous->waypoints.end());
+            d->initialStates.insert(d->initialStates.end(),
+                                    previous->initialStates.begin() + i + 1 + offset,
+                                    previous->initialStates.end());
+            break;
+        }
+    }
+  }
+
+  d->cumulativeDistanceM.resize(sz);
+  double total = 0.0;
+  for (int i=0; i<sz; ++i) {
+    total += wps[i].pathDistanceM;
+    d->cumulativeDistanceM[i] = total;
   }
 }
 
@@ -1213,7 +1410,11 @@ double RoutePath::distanceBetweenIndices(int from, int to) const
         to = sz - 1;
     }
 
-    return d->distanceBetweenIndices(from, to);
+    if (from >= to) {
+        return 0.0;
+    }
+
+    return d->cumulativeDistanceM[to] - d->cumulativeDistanceM[from];
 }
 
 SGGeod RoutePath::positionForDistanceFrom(int index, double distanceM) const
@@ -1228,33 +1429,27 @@ SGGeod RoutePath::positionForDistanceFrom(int index, double distanceM) const
                              "RoutePath::positionForDistanceFrom");
   }
   
-  // find the actual leg we're within
+  // find the actual leg we're within, by searching the cumulative path
+  // distances. Note pathDistanceM is 0 for skipped waypoints, so this
+  // works out
+  const std::vector<double>& cumulative(d->cumulativeDistanceM);
+  const double target = cumulative[index] + distanceM;
   if (distanceM < 0.0) {
-    // scan backwards
-    while ((index > 0) && (distanceM < 0.0)) {
-      // we are looking at index n, say 4, but with a negative distance.
-      // we want to look at index n-1 (so, 3), and see if this makes
-      // distance positive. We need to offset by distance from 3 -> 4,
-      // which is waypoint 4's path distance.
-      
-      // note pathDistanceM is 0 for skipped waypoints, so this works out
-      distanceM += d->waypoints[index].pathDistanceM;
-      --index;
-    }
-    
-    if (distanceM < 0.0) {
-      // still negative, return route start
+    // the last waypoint at or before the target distance
+    auto it = std::upper_bound(cumulative.begin(), cumulative.begin() + index + 1, target);
+    if (it == cumulative.begin()) {
+      // before the route start
       return d->waypoints[0].pos;
     }
-    
+
+    index = static_cast<int>(std::distance(cumulative.begin(), it)) - 1;
   } else {
-    // scan forwards
-    int nextIndex = index + 1;
-    while ((nextIndex < sz) && (d->waypoints[nextIndex].pathDistanceM < distanceM)) {
-      distanceM -= d->waypoints[nextIndex].pathDistanceM;
-      index = nextIndex++;
-    }
+    // the leg ends at the first later waypoint reaching the target distance
+    auto it = std::lower_bound(cumulative.begin() + index + 1, cumulative.end(), target);
+    index = static_cast<int>(std::distance(cumulative.begin(), it)) - 1;
   }
+
+  distanceM = target - cumulative[index];
   
   auto nextIt = d->nextValidWaypoint(index);
   if (nextIt == d->waypoints.end()) {
@@ -45,6 +45,15 @@ public:
   RoutePath(const RoutePath& other);
   RoutePath& operator=(const RoutePath& other);
 
+  /**
+   * Bring the path up to date with the legs of the flight-plan. Waypoints
+   * which are unchanged at the start and end of the route are detected by
+   * identity and kept; only the changed legs, and the neighbouring legs
+   * whose turns depend on them, are recomputed. Waypoints modified in
+   * place are detected by their revision, or can be listed in 'modified'.
+   */
+  void update(const flightgear::FlightPlan* fp, const flightgear::WayptVec& modified);
+
   flightgear::SGGeodVec pathForIndex(int index) const;
   
   SGGeod positionForIndex(int index) const;
@@ -59,8 +68,11 @@ public:
 
 private:
   class RoutePathPrivate;
+  struct PreviousState;
   
   void commonInit();
+
+  void computeFrom(int first, int prepared, const PreviousState* previous);
   
   double computeDistanceForIndex(int index) const;
 
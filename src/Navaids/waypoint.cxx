@@ -283,28 +283,33 @@ Hold::Hold(RouteBase* aOwner) :
 void Hold::setHoldRadial(double aInboundRadial)
 {
   _bearing = aInboundRadial;
+  markModified();
 }
 
 void Hold::setHoldDistance(double aDistanceNm)
 {
   _isDistance = true;
   _holdTD = aDistanceNm;
+  markModified();
 }
 
 void Hold::setHoldTime(double aTimeSec)
 {
   _isDistance = false;
   _holdTD = aTimeSec;
+  markModified();
 }
 
 void Hold::setRightHanded()
 {
   _righthanded = true;
+  markModified();
 }
 
 void Hold::setLeftHanded()
 {
   _righthanded = false;
+  markModified();
 }
 
 bool Hold::initFromProperties(SGPropertyNode_ptr aProp)
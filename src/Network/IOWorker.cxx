@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileName: IOWorker.cxx
+ * SPDX-FileComment: runs the I/O of a protocol channel on its own thread
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "IOWorker.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+#if !defined(_WIN32)
+#include <signal.h>
+#endif
+
+#include "protocol.hxx"
+
+namespace {
+
+#if !defined(_WIN32)
+// SIGURG is ignored by default, so a stray one is harmless. The handler is
+// installed without SA_RESTART: the blocked call fails with EINTR.
+const int INTERRUPT_SIGNAL = SIGURG;
+
+void onInterrupt(int)
+{
+}
+
+void installInterruptHandler()
+{
+    static std::once_flag installed;
+    std::call_once(installed, [] {
+        struct sigaction action = {};
+        action.sa_handler = onInterrupt;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = 0;
+        sigaction(INTERRUPT_SIGNAL, &action, nullptr);
+    });
+}
+#endif
+
+} // of anonymous namespace
+
+void FGIORunningStat::add(double sec)
+{
+    _average = (_count == 0) ? sec : _average + (sec - _average) / 16.0;
+    _max = std::max(_max, sec);
+    ++_count;
+}
+
+void FGIORunningStat::publish(SGPropertyNode* node, const std::string& name) const
+{
+    node->setDoubleValue(name + "-ms", _average * 1000.0);
+    node->setDoubleValue(name + "-max-ms", _max * 1000.0);
+}
+
+FGIOWorker::FGIOWorker(FGProtocol* protocol) :
+    _protocol(protocol),
+    _period(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / protocol->get_hz()))),
+    _polled(protocol->get_direction() == SG_IO_IN)
+{
+#if !defined(_WIN32)
+    installInterruptHandler();
+#endif
+}
+
+FGIOWorker::~FGIOWorker()
+{
+#if defined(_WIN32)
+    if (_thread) {
+        CloseHandle(_thread);
+    }
+#endif
+}
+
+void FGIOWorker::stop()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+    _wakeup.notify_one();
+}
+
+void FGIOWorker::interrupt()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_running || _exited) {
+        return;
+    }
+#if defined(_WIN32)
+    CancelSynchronousIo(_thread);
+#else
+    pthread_kill(_thread, INTERRUPT_SIGNAL);
+#endif
+}
+
+bool FGIOWorker::waitForExit(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _exit.wait_for(lock, timeout, [this] { return _exited; });
+}
+
+void FGIOWorker::run()
+{
+    std::vector<std::string> input;
+    std::deque<Message> output;
+    std::vector<double> latencies;
+    Clock::time_point lastTransfer;
+    Clock::time_point nextPoll = Clock::now();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+#if defined(_WIN32)
+    DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(),
+                    &_thread, 0, FALSE, DUPLICATE_SAME_ACCESS);
+#else
+    _thread = pthread_self();
+#endif
+    _running = true;
+
+    while (!_stop) {
+        if (_polled) {
+            _wakeup.wait_until(lock, nextPoll, [this] { return _stop; });
+        } else {
+            _wakeup.wait(lock, [this] { return _stop || !_outbox.empty(); });
+        }
+        if (_stop) {
+            break;
+        }
+
+        output.swap(_outbox);
+        lock.unlock();
+
+        // the channel may block here, the main loop goes on
+        bool ok = true;
+        const Clock::time_point start = Clock::now();
+        if (_polled) {
+            ok = _protocol->transfer(std::string(), input);
+            nextPoll = std::max(nextPoll + _period, start);
+        } else {
+            for (const auto& msg : output) {
+                ok = _protocol->transfer(msg.data, input) && ok;
+                latencies.push_back(std::chrono::duration<double>(Clock::now() - msg.stamp).count());
+            }
+        }
+        output.clear();
+        const Clock::time_point end = Clock::now();
+
+        lock.lock();
+        for (double sec : latencies) {
+            _txLatency.add(sec);
+        }
+        latencies.clear();
+        ++_transfers;
+        if (lastTransfer != Clock::time_point()) {
+            const double interval = std::chrono::duration<double>(start - lastTransfer).count();
+            _jitter.add(std::fabs(interval - std::chrono::duration<double>(_period).count()));
+        }
+        lastTransfer = start;
+        if (!ok) {
+            ++_errors;
+        }
+
+        for (auto& data : input) {
+            if (_inbox.size() >= QUEUE_CAPACITY) {
+                _inbox.pop_front();
+                ++_dropped;
+            }
+            _inbox.push_back({end, std::move(data)});
+        }
+        input.clear();
+    }
+
+    _exited = true;
+    _exit.notify_all();
+}
+
+void FGIOWorker::exchange()
+{
+    const Clock::time_point start = Clock::now();
+
+    std::string out;
+    const bool haveOutput = _protocol->gen_output(out) && !out.empty();
+
+    std::deque<Message> input;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (haveOutput) {
+            if (_outbox.size() >= QUEUE_CAPACITY) {
+                _outbox.pop_front();
+                ++_dropped;
+            }
+            _outbox.push_back({start, std::move(out)});
+            _wakeup.notify_one();
+        }
+        input.swap(_inbox);
+    }
+
+    for (const auto& msg : input) {
+        _rxLatency.add(std::chrono::duration<double>(start - msg.stamp).count());
+        _protocol->apply_input(msg.data);
+    }
+
+    _mainLoopTime.add(std::chrono::duration<double>(Clock::now() - start).count());
+}
+
+void FGIOWorker::publishStats(SGPropertyNode* node)
+{
+    node->setBoolValue("async", true);
+    _rxLatency.publish(node, "rx-latency");
+    _mainLoopTime.publish(node, "main-loop");
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _txLatency.publish(node, "tx-latency");
+    _jitter.publish(node, "jitter");
+    node->setIntValue("transfers", static_cast<int>(_transfers));
+    node->setIntValue("errors", static_cast<int>(_errors));
+    node->setIntValue("dropped", static_cast<int>(_dropped));
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileName: IOWorker.hxx
+ * SPDX-FileComment: runs the I/O of a protocol channel on its own thread
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include <simgear/props/props.hxx>
+#include <simgear/threads/SGThread.hxx>
+
+class FGProtocol;
+
+/**
+ * Running average and maximum of a time, in seconds. The average uses
+ * the gain of 1/16 RFC 3550 uses for the interarrival jitter.
+ */
+class FGIORunningStat
+{
+public:
+    void add(double sec);
+
+    unsigned long count() const { return _count; }
+    double average() const { return _average; }
+    double max() const { return _max; }
+
+    /// as <name>-ms and <name>-max-ms
+    void publish(SGPropertyNode* node, const std::string& name) const;
+
+private:
+    unsigned long _count = 0;
+    double _average = 0.0;
+    double _max = 0.0;
+};
+
+/**
+ * Runs the reading and writing of a protocol channel on a dedicated thread,
+ * so a slow device or a blocking socket doesn't stall the frame.
+ *
+ * The main loop calls exchange() at the channel rate: it hands over the
+ * output the protocol generated from the property tree, and applies the
+ * input records read since. The worker only calls FGProtocol::transfer().
+ * If the main loop falls behind, the oldest input records are dropped; if
+ * the channel falls behind, the oldest output is.
+ *
+ * A transfer blocked reading a quiet device is woken by interrupt(), which
+ * makes the system call fail without touching the channel: a signal on
+ * POSIX systems, CancelSynchronousIo() on Windows.
+ */
+class FGIOWorker : public SGThread
+{
+public:
+    explicit FGIOWorker(FGProtocol* protocol);
+    ~FGIOWorker();
+
+    void run() override;
+
+    /// ask the thread to exit; join() it afterwards
+    void stop();
+
+    /// after stop(): wake the thread if it is blocked in a system call of
+    /// the channel. A wake-up sent just before the call is lost, so repeat
+    /// it until waitForExit() succeeds.
+    void interrupt();
+
+    /// after stop(): wait up to <timeout> for the thread to exit. False if
+    /// it is still blocked in the channel.
+    bool waitForExit(std::chrono::milliseconds timeout);
+
+    /// main thread only
+    void exchange();
+
+    /// main thread only: latency, jitter and counters
+    void publishStats(SGPropertyNode* node);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Message {
+        Clock::time_point stamp;
+        std::string data;
+    };
+
+    static const size_t QUEUE_CAPACITY = 64;
+
+    FGProtocol* _protocol;
+    const Clock::duration _period;
+    const bool _polled; ///< reads without something to write
+
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    std::condition_variable _exit;
+    std::deque<Message> _outbox;
+    std::deque<Message> _inbox;
+    bool _stop = false;
+    bool _exited = false;
+    bool _running = false; ///< _thread is valid
+#if defined(_WIN32)
+    HANDLE _thread = nullptr;
+#else
+    pthread_t _thread;
+#endif
+
+    // guarded by _mutex
+    FGIORunningStat _txLatency;
+    FGIORunningStat _jitter;
+    unsigned long _transfers = 0;
+    unsigned long _errors = 0;
+    unsigned long _dropped = 0;
+
+    // main thread only
+    FGIORunningStat _rxLatency;
+    FGIORunningStat _mainLoopTime;
+};
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cstdio>
+#include <vector>
 
 #include <simgear/debug/logstream.hxx>
 #include <simgear/constants.h>
@@ -17,6 +18,7 @@
 #include <simgear/math/sg_geodesy.hxx>
 #include <simgear/sg_inlines.h>
 
+#include <AIModel/AIManager.hxx>
 #include <FDM/flightProperties.hxx>
 #include <Main/fg_props.hxx>
 #include <Main/globals.hxx>
@@ -69,6 +71,7 @@ using namespace NMEA;
  *   All Flarm configuration properties are mirrored to /sim/flarm/config.
  *   Useful properties:
  *   /sim/flarm/config/RANGE    Range in meters when considering traffic targets
+ *   /sim/flarm/config/VRANGE   Vertical range in meters, above and below
  *   /sim/flarm/config/NMEAOUT  NMEA message mode (0=off, 1=all, 2=Garmin/NMEA messages only, 3=Flarm messages only)
  *   /sim/flarm/config/ACFT     Aircraft type (1=glider, 3=helicopter, 8=motor aircraft, 9=jet)
  *
@@ -115,6 +118,7 @@ FGFlarm::FGFlarm() :
     setDefaultConfigValue("PILOT",      "Curt"); // :-)))
     setDefaultConfigValue("PRIV",       zero);
     setDefaultConfigValue("RANGE",      25500);
+    setDefaultConfigValue("VRANGE",     500);
     setDefaultConfigValue("THRE",       2);
     setDefaultConfigValue("UI",         zero);
 }
@@ -167,16 +171,31 @@ bool FGFlarm::gen_message()
     {
         double altitude_ft = mFdm.get_Altitude();
 
-        // check all AI/MP aircraft
-        SGPropertyNode* pAi = fgGetNode("/ai/models", true);
-        simgear::PropertyList aircraftList = pAi->getChildren("aircraft");
-        for (simgear::PropertyList::iterator i = aircraftList.begin(); i != aircraftList.end(); ++i)
+        // candidate targets from the AI traffic snapshot: a sphere around the
+        // corners of the cylinder the range test below accepts. The 10% cover
+        // its flat-earth distances and the curvature.
+        double FlarmRangeM = mFlarmConfig->getIntValue("RANGE", 25500);
+        double FlarmVRangeM = mFlarmConfig->getIntValue("VRANGE", 500);
+        double QueryRangeM = 1.1 * sqrt(FlarmRangeM*FlarmRangeM + FlarmVRangeM*FlarmVRangeM);
+        std::vector<size_t> targets;
+        auto aiManager = globals->get_subsystem<FGAIManager>();
+        const FGAITrafficSnapshot* traffic = aiManager ? &aiManager->trafficSnapshot() : nullptr;
+        if (traffic)
         {
-            SGPropertyNode* pModel = *i;
-            if ((pModel)&&(pModel->nChildren()))
+            SGVec3d cartPos = SGVec3d::fromGeod(SGGeod::fromDegFt(lond, latd, altitude_ft));
+            traffic->findWithinRange(cartPos, QueryRangeM * SG_METER_TO_NM, targets);
+        }
+
+        // check all AI aircraft
+        for (size_t t : targets)
+        {
+            if (traffic->type(t) != FGAIBase::object_type::otAircraft)
+                continue;
+
+            SGPropertyNode* pModel = traffic->props(t);
             {
-                double GroundSpeedKt = pModel->getDoubleValue("velocities/true-airspeed-kt", 0.0);
-                int threatLevel = pModel->getIntValue("tcas/threat-level", -99);
+                double GroundSpeedKt = traffic->speedKts(t);
+                int threatLevel = pModel ? pModel->getIntValue("tcas/threat-level", -99) : -99;
                 // threatLevel is undefined (-99) when no TCAS is installed
                 if (threatLevel == -99)
                 {
@@ -188,8 +207,8 @@ bool FGFlarm::gen_message()
                 if (threatLevel >= 0)
                 {
                     // position data of current intruder
-                    double targetLatd = pModel->getDoubleValue("position/latitude-deg", 0.0);
-                    double targetLond = pModel->getDoubleValue("position/longitude-deg", 0.0);
+                    double targetLatd = traffic->latitudeDeg(t);
+                    double targetLond = traffic->longitudeDeg(t);
 
                     // calculate the relative North and relative East distances in meters, as
                     // required by the Flarm protocol
@@ -201,6 +220,7 @@ bool FGFlarm::gen_message()
                                         abs(cos(latd*SGD_DEGREES_TO_RADIANS)) * RelEastAngleDeg;
 
 #ifdef FLARM_DEBUGGING
+                    if (pModel)
                     {
                         double distanceM = sqrt(RelNorth*RelNorth+RelEast*RelEast);
                         pModel->setDoubleValue("flarm/distance", distanceM);
@@ -208,29 +228,28 @@ bool FGFlarm::gen_message()
                     }
 #endif
 
-                    // do not consider targets beyond 100km (1e5 meters)
-                    double FlarmRangeM = mFlarmConfig->getIntValue("RANGE", 25500);
+                    // do not consider targets beyond the configured range
                     double DistanceM2 = RelNorth*RelNorth+RelEast*RelEast;
-                    if (DistanceM2 < FlarmRangeM*FlarmRangeM)
+                    int RelVerticalM = (traffic->altitudeFt(t)-altitude_ft)* SG_FEET_TO_METER;
+                    if ((DistanceM2 < FlarmRangeM*FlarmRangeM) && (abs(RelVerticalM) <= FlarmVRangeM))
                     {
                         TargetCount++;
 #if 0//def FLARM_DEBUGGING
                         {
                             double distanceM = sqrt(RelNorth*RelNorth+RelEast*RelEast);
                             printf("%3u: id %3u, %s, distance: %.1fkm, North: %.1f, East: %.1f, speed: %.1f kt\n",
-                                    pModel->getIndex(),
-                                    pModel->getIntValue("id"),
-                                    pModel->getStringValue("callsign", "<no name>"),
+                                    (unsigned int) t,
+                                    traffic->id(t),
+                                    traffic->callsign(t).c_str(),
                                     distanceM/1000.0, RelNorth/1e3, RelEast/1e3, GroundSpeedKt);
                         }
 #endif
 
-                        int RelVerticalM = (pModel->getDoubleValue("position/altitude-ft", 0.0)-altitude_ft)* SG_FEET_TO_METER;
-                        int Track = pModel->getDoubleValue("orientation/true-heading-deg", 0.0);
-                        int ClimbRateMs = pModel->getDoubleValue("velocities/vertical-speed-fps", 0.0) * (SG_FPS_TO_KT * SG_KT_TO_MPS);
+                        int Track = traffic->headingDeg(t);
+                        int ClimbRateMs = traffic->verticalSpeedFps(t) * (SG_FPS_TO_KT * SG_KT_TO_MPS);
                         int AcftType = 9; // report as jet aircraft for now
                         // generate some fake 6-digit hex code
-                        unsigned int ID = pModel->getIntValue("id") & 0x00FFFFFF;
+                        unsigned int ID = traffic->id(t) & 0x00FFFFFF;
                         //$PFLAA,AlarmLevel,RelNorth,RelEast,RelVertical,IDType,ID,Track,TurnRate,GroundSpeed,ClimbRate,AcftType
                         snprintf( nmea, 256, "$PFLAA,%u,%i,%i,%i,2,%06X,%u,,%i,%i,%u",
                                  threatLevel, (int)RelNorth, (int)RelEast, RelVerticalM, ID,
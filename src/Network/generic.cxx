@@ -11,6 +11,7 @@
 
 #include <string.h>                // strstr()
 #include <stdlib.h>                // strtod(), atoi()
+#include <algorithm>
 #include <cstdio>
 
 #include <simgear/debug/logstream.hxx>
@@ -255,6 +256,11 @@ bool FGGeneric::gen_message_binary() {
     std::string generic_sentence;
     length = 0;
 
+    if (!_out_plan.empty()) {
+        encode_binary_plan();
+        return finish_message_binary();
+    }
+
     double val;
     for (unsigned int i = 0; i < _out_message.size(); i++) {
 
@@ -367,6 +373,11 @@ bool FGGeneric::gen_message_binary() {
         }
     }
 
+    return finish_message_binary();
+}
+
+// add the footer and the wrapper to the record in buf
+bool FGGeneric::finish_message_binary() {
     // add the footer to the packet ("line")
     switch (binary_footer_type) {
         case FOOTER_LENGTH:
@@ -465,7 +476,185 @@ bool FGGeneric::gen_message() {
     }
 }
 
+namespace {
+
+inline void put32(char* p, uint32_t v, bool swap)
+{
+    if (swap) {
+        v = sg_bswap_32(v);
+    }
+    memcpy(p, &v, sizeof(v));
+}
+
+inline void put64(char* p, uint64_t v, bool swap)
+{
+    if (swap) {
+        v = sg_bswap_64(v);
+    }
+    memcpy(p, &v, sizeof(v));
+}
+
+inline uint32_t get32(const char* p, bool swap)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return swap ? sg_bswap_32(v) : v;
+}
+
+inline uint64_t get64(const char* p, bool swap)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return swap ? sg_bswap_64(v) : v;
+}
+
+} // of anonymous namespace
+
+// Returns false, leaving the plan empty, for records which can't be
+// compiled: those with strings, whose layout depends on the values.
+bool FGGeneric::compile_binary_plan(std::vector<_serial_prot>& msg, std::vector<_binary_op>& plan) {
+    plan.clear();
+    if (!binary_mode) {
+        return false;
+    }
+
+    int pos = 0;
+    for (auto& chunk : msg) {
+        int width;
+        switch (chunk.type) {
+        case FG_BOOL:
+        case FG_BYTE:
+            width = 1;
+            break;
+        case FG_WORD:
+            width = 2;
+            break;
+        case FG_DOUBLE:
+            width = 8;
+            break;
+        case FG_STRING:
+            plan.clear();
+            return false;
+        default:
+            width = 4;
+            break;
+        }
+
+        plan.push_back({pos, chunk.type, chunk.offset, chunk.factor, chunk.prop.get(), &chunk});
+        pos += width;
+    }
+
+    // leave room for the footer
+    if (pos + static_cast<int>(sizeof(int32_t)) > FG_MAX_MSG_SIZE) {
+        plan.clear();
+        return false;
+    }
+    if (&plan == &_out_plan) {
+        _out_plan_length = pos;
+    }
+    return true;
+}
+
+// The conversions are those of the interpreting loop of gen_message_binary().
+void FGGeneric::encode_binary_plan() {
+    const bool swap = (binary_byte_order != BYTE_ORDER_MATCHES_NETWORK_ORDER);
+
+    for (const auto& op : _out_plan) {
+        char* p = buf + op.pos;
+        switch (op.type) {
+        case FG_INT:
+            put32(p, static_cast<int32_t>(op.offset + op.prop->getFloatValue() * op.factor), swap);
+            break;
+        case FG_BOOL:
+            *p = op.prop->getBoolValue() ? 1 : 0;
+            break;
+        case FG_FIXED: {
+            const double val = op.offset + op.prop->getFloatValue() * op.factor;
+            put32(p, static_cast<int32_t>(val * 65536.0f), swap);
+            break;
+        }
+        case FG_FLOAT: {
+            u32 tmpun32;
+            tmpun32.floatVal = static_cast<float>(op.offset + op.prop->getFloatValue() * op.factor);
+            put32(p, tmpun32.intVal, swap);
+            break;
+        }
+        case FG_DOUBLE: {
+            u64 tmpun64;
+            tmpun64.doubleVal = op.offset + op.prop->getDoubleValue() * op.factor;
+            put64(p, tmpun64.longVal, swap);
+            break;
+        }
+        case FG_BYTE:
+            *p = static_cast<int8_t>(op.offset + op.prop->getFloatValue() * op.factor);
+            break;
+        case FG_WORD: {
+            // words are always written in host byte order
+            const int16_t wordVal = op.offset + op.prop->getFloatValue() * op.factor;
+            memcpy(p, &wordVal, sizeof(wordVal));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    length = _out_plan_length;
+}
+
+// The conversions are those of the interpreting loop of parse_message_binary().
+void FGGeneric::decode_binary_plan(int length) {
+    const bool swap = (binary_byte_order == BYTE_ORDER_NEEDS_CONVERSION);
+
+    for (const auto& op : _in_plan) {
+        if (op.pos >= length) {
+            break;
+        }
+
+        const char* p = buf + op.pos;
+        switch (op.type) {
+        case FG_INT:
+            updateValue(*op.chunk, static_cast<int>(static_cast<int32_t>(get32(p, swap))));
+            break;
+        case FG_BOOL:
+            updateValue(*op.chunk, p[0] != 0);
+            break;
+        case FG_FIXED:
+            updateValue(*op.chunk, static_cast<float>(static_cast<int32_t>(get32(p, swap))) / 65536.0f);
+            break;
+        case FG_FLOAT: {
+            u32 tmpun32;
+            tmpun32.intVal = get32(p, swap);
+            updateValue(*op.chunk, tmpun32.floatVal);
+            break;
+        }
+        case FG_DOUBLE: {
+            u64 tmpun64;
+            tmpun64.longVal = get64(p, swap);
+            updateValue(*op.chunk, tmpun64.doubleVal);
+            break;
+        }
+        case FG_BYTE:
+            updateValue(*op.chunk, static_cast<int>(static_cast<int8_t>(*p)));
+            break;
+        case FG_WORD: {
+            int16_t raw;
+            memcpy(&raw, p, sizeof(raw));
+            // a swapped word isn't sign extended
+            updateValue(*op.chunk, swap ? static_cast<int>(sg_bswap_16(raw)) : static_cast<int>(raw));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
 bool FGGeneric::parse_message_binary(int length) {
+    if (!_in_plan.empty()) {
+        decode_binary_plan(length);
+        return true;
+    }
+
     char *p2, *p1 = buf;
     int32_t tmp32;
     int i = -1;
@@ -712,6 +901,82 @@ error_out:
 }
 
 
+bool FGGeneric::gen_output(std::string& out) {
+    if (writeFailed && exitOnError) {
+        fgOSExit(1);
+        return false;
+    }
+
+    out.clear();
+    if ((get_direction() == SG_IO_OUT) || (get_direction() == SG_IO_BI)) {
+        if (!gen_message()) {
+            return false;
+        }
+        out.assign(buf, length);
+    }
+    return true;
+}
+
+// Runs on the I/O worker: the member buffer belongs to the main loop, so
+// read into a local one.
+bool FGGeneric::transfer(const std::string& out, std::vector<std::string>& in) {
+    SGIOChannel *io = get_io_channel();
+
+    if (!out.empty() && !io->write(out.data(), out.size())) {
+        SG_LOG( SG_IO, SG_WARN, "Error writing data." );
+        writeFailed = true;
+        return false;
+    }
+
+    if ((get_direction() != SG_IO_IN) && (get_direction() != SG_IO_BI)) {
+        return true;
+    }
+
+    char readBuf[FG_MAX_MSG_SIZE];
+    int len;
+    if (io->get_type() == sgFileType) {
+        // one record per call, so a recording plays back at the channel rate
+        len = binary_mode ? io->read(readBuf, binary_record_length)
+                          : io->readline(readBuf, FG_MAX_MSG_SIZE);
+        if (len <= 0) {
+            SG_LOG( SG_IO, SG_ALERT, "Error reading data." );
+            return false;
+        }
+        if (binary_mode && (len != binary_record_length)) {
+            SG_LOG( SG_IO, SG_ALERT,
+                    "Generic protocol: Received binary "
+                    "record of unexpected size, expected: "
+                    << binary_record_length << " but received: "
+                    << len);
+            return true;
+        }
+        in.emplace_back(readBuf, len);
+    } else if (!binary_mode) {
+        while ((len = io->readline(readBuf, FG_MAX_MSG_SIZE)) > 0) {
+            in.emplace_back(readBuf, len);
+        }
+    } else {
+        while ((len = io->read(readBuf, binary_record_length)) == binary_record_length) {
+            in.emplace_back(readBuf, len);
+        }
+        if (len > 0) {
+            SG_LOG( SG_IO, SG_ALERT,
+                "Generic protocol: Received binary "
+                "record of unexpected size, expected: "
+                << binary_record_length << " but received: "
+                << len);
+        }
+    }
+    return true;
+}
+
+bool FGGeneric::apply_input(const std::string& in) {
+    length = std::min(static_cast<int>(in.size()), FG_MAX_MSG_SIZE);
+    memcpy(buf, in.data(), length);
+    return parse_message_len(length);
+}
+
+
 // close the channel
 bool FGGeneric::close() {
     SGIOChannel *io = get_io_channel();
@@ -760,11 +1025,13 @@ FGGeneric::reinit()
         SGPropertyNode *output = root.getNode("generic/output");
         if (output) {
             _out_message.clear();
+            _out_plan.clear();
             if (!read_config(output, _out_message))
             {
                 // bad configuration
                 return;
             }
+            compile_binary_plan(_out_message, _out_plan);
         }
     }
 
@@ -772,11 +1039,13 @@ FGGeneric::reinit()
         SGPropertyNode *input = root.getNode("generic/input");
         if (input) {
             _in_message.clear();
+            _in_plan.clear();
             if (!read_config(input, _in_message))
             {
                 // bad configuration
                 return;
             }
+            compile_binary_plan(_in_message, _in_plan);
             if (!binary_mode && (line_separator.empty() ||
                 *line_separator.rbegin() != '\n')) {
 
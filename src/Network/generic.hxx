@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include <simgear/compiler.h>
@@ -31,6 +32,12 @@ public:
     // process work for this port
     bool process();
 
+    // split processing, see FGProtocol
+    bool supports_async() const { return true; }
+    bool gen_output(std::string& out);
+    bool transfer(const std::string& out, std::vector<std::string>& in);
+    bool apply_input(const std::string& in);
+
     // close the channel
     bool close();
 
@@ -83,14 +90,38 @@ private:
     enum { BYTE_ORDER_NEEDS_CONVERSION,
            BYTE_ORDER_MATCHES_NETWORK_ORDER } binary_byte_order;
 
+    // A binary record without strings has a fixed layout, so its chunk
+    // list is compiled into a flat list of ops at known offsets, which
+    // gen_message_binary() and parse_message_binary() execute instead of
+    // interpreting the chunks.
+    struct _binary_op {
+        int pos;             // byte offset in the record
+        e_type type;
+        double offset;
+        double factor;
+        SGPropertyNode* prop; // owned by the chunk
+        _serial_prot* chunk;
+    };
+
     bool gen_message_ascii();
     bool gen_message_binary();
+    bool finish_message_binary();
+    void encode_binary_plan();
     bool parse_message_ascii(int length);
     bool parse_message_binary(int length);
+    void decode_binary_plan(int length);
     bool read_config(SGPropertyNode* root, std::vector<_serial_prot>& msg);
+    bool compile_binary_plan(std::vector<_serial_prot>& msg, std::vector<_binary_op>& plan);
+
+    std::vector<_binary_op> _out_plan;
+    std::vector<_binary_op> _in_plan;
+    int _out_plan_length = 0;
     bool exitOnError;
     bool initOk;
 
+    // set by transfer() on the I/O worker, acted on by gen_output()
+    std::atomic<bool> writeFailed{false};
+
     class FGProtocolWrapper* wrapper;
 
     template <class T>
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileName: MessagePack.cxx
+ * SPDX-FileComment: minimal MessagePack encoder for the binary property stream
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "MessagePack.hxx"
+
+#include <cmath>
+#include <cstring>
+
+#include <simgear/props/props.hxx>
+
+namespace flightgear {
+namespace http {
+
+// MessagePack is big endian throughout
+void MessagePackWriter::put16(uint16_t v)
+{
+    put8(v >> 8);
+    put8(v & 0xff);
+}
+
+void MessagePackWriter::put32(uint32_t v)
+{
+    put16(v >> 16);
+    put16(v & 0xffff);
+}
+
+void MessagePackWriter::put64(uint64_t v)
+{
+    put32(v >> 32);
+    put32(v & 0xffffffff);
+}
+
+void MessagePackWriter::writeNil()
+{
+    put8(0xc0);
+}
+
+void MessagePackWriter::writeBool(bool b)
+{
+    put8(b ? 0xc3 : 0xc2);
+}
+
+void MessagePackWriter::writeInt(int64_t i)
+{
+    if (i >= 0) {
+        if (i < 128) {
+            put8(static_cast<uint8_t>(i)); // positive fixint
+        } else if (i <= 0xff) {
+            put8(0xcc);
+            put8(static_cast<uint8_t>(i));
+        } else if (i <= 0xffff) {
+            put8(0xcd);
+            put16(static_cast<uint16_t>(i));
+        } else if (i <= 0xffffffffLL) {
+            put8(0xce);
+            put32(static_cast<uint32_t>(i));
+        } else {
+            put8(0xcf);
+            put64(static_cast<uint64_t>(i));
+        }
+    } else if (i >= -32) {
+        put8(static_cast<uint8_t>(i)); // negative fixint
+    } else if (i >= INT8_MIN) {
+        put8(0xd0);
+        put8(static_cast<uint8_t>(i));
+    } else if (i >= INT16_MIN) {
+        put8(0xd1);
+        put16(static_cast<uint16_t>(i));
+    } else if (i >= INT32_MIN) {
+        put8(0xd2);
+        put32(static_cast<uint32_t>(i));
+    } else {
+        put8(0xd3);
+        put64(static_cast<uint64_t>(i));
+    }
+}
+
+void MessagePackWriter::writeFloat(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    put8(0xca);
+    put32(bits);
+}
+
+void MessagePackWriter::writeDouble(double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    put8(0xcb);
+    put64(bits);
+}
+
+void MessagePackWriter::writeString(const std::string& s)
+{
+    const size_t n = s.size();
+    if (n < 32) {
+        put8(0xa0 | static_cast<uint8_t>(n));
+    } else if (n <= 0xff) {
+        put8(0xd9);
+        put8(static_cast<uint8_t>(n));
+    } else if (n <= 0xffff) {
+        put8(0xda);
+        put16(static_cast<uint16_t>(n));
+    } else {
+        put8(0xdb);
+        put32(static_cast<uint32_t>(n));
+    }
+    _data.append(s);
+}
+
+void MessagePackWriter::writeArrayHeader(uint32_t n)
+{
+    if (n < 16) {
+        put8(0x90 | static_cast<uint8_t>(n));
+    } else if (n <= 0xffff) {
+        put8(0xdc);
+        put16(static_cast<uint16_t>(n));
+    } else {
+        put8(0xdd);
+        put32(n);
+    }
+}
+
+void MessagePackWriter::writePropertyValue(SGPropertyNode* node)
+{
+    if (!node->hasValue()) {
+        writeNil();
+        return;
+    }
+
+    switch (node->getType()) {
+    case simgear::props::BOOL:
+        writeBool(node->getBoolValue());
+        break;
+    case simgear::props::INT:
+    case simgear::props::LONG:
+        writeInt(node->getLongValue());
+        break;
+    case simgear::props::FLOAT: {
+        // NaN goes as nil, as in the JSON encoding
+        const float f = node->getFloatValue();
+        std::isnan(f) ? writeNil() : writeFloat(f);
+        break;
+    }
+    case simgear::props::DOUBLE: {
+        const double d = node->getDoubleValue();
+        std::isnan(d) ? writeNil() : writeDouble(d);
+        break;
+    }
+    default:
+        writeString(node->getStringValue());
+        break;
+    }
+}
+
+} // namespace http
+} // namespace flightgear
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileName: MessagePack.hxx
+ * SPDX-FileComment: minimal MessagePack encoder for the binary property stream
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class SGPropertyNode;
+
+namespace flightgear {
+namespace http {
+
+/**
+ * Appends MessagePack (https://msgpack.org/) encoded values to a byte
+ * string, always choosing the shortest encoding. Only what the property
+ * stream needs is supported: nil, booleans, integers, floats, strings and
+ * arrays.
+ */
+class MessagePackWriter
+{
+public:
+    void writeNil();
+    void writeBool(bool b);
+    void writeInt(int64_t i);
+    void writeFloat(float f);
+    void writeDouble(double d);
+    void writeString(const std::string& s);
+
+    /// the n elements of the array follow
+    void writeArrayHeader(uint32_t n);
+
+    /// the value of a property in its natural type, nil if it has none
+    void writePropertyValue(SGPropertyNode* node);
+
+    const std::string& data() const { return _data; }
+    void clear() { _data.clear(); }
+
+private:
+    void put8(uint8_t v) { _data.push_back(static_cast<char>(v)); }
+    void put16(uint16_t v);
+    void put32(uint32_t v);
+    void put64(uint64_t v);
+
+    std::string _data;
+};
+
+} // namespace http
+} // namespace flightgear
@@ -19,6 +19,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 #include "MirrorPropertyTreeWebsocket.hxx"
+#include "MessagePack.hxx"
 #include "jsonprops.hxx"
 
 #include <algorithm>
@@ -152,12 +153,9 @@ using std::string;
                 // not new to the server, but new to the client
                 newNodes.insert(node);
             } else {
-                assert(previousValues.size() > it->second);
-                PropertyValue newVal(node);
-                if (!previousValues[it->second].equals(node, newVal)) {
-                    previousValues[it->second] = newVal;
-                    changedNodes.insert(node);
-                }
+                // compared against the sent value in filterChangedNodes, so
+                // a node changing every frame costs one comparison per send
+                changedNodes.insert(node);
             }
         }
 
@@ -184,18 +182,10 @@ using std::string;
                 removedNodes.erase(id); // don't remove it!
                 idHash.insert(std::make_pair(node, id));
                 
-                // we can still do change compression here, but this also
-                // deals with type mutation when removing + re-adding with a
-                // different type
-                PropertyValue newVal(node);
-                if (!previousValues[id].equals(node, newVal)) {
-                    previousValues[id] = newVal;
-                    changedNodes.insert(node);
-#if defined (MIRROR_DEBUG)
-                    SG_LOG(SG_NETWORK, SG_INFO, "\tand will actually change" << node->getPath());
-#endif
-                }
-                
+                // change compression still applies, and also deals with type
+                // mutation when removing + re-adding with a different type
+                changedNodes.insert(node);
+
                 recentlyRemoved.erase(rrIt);
                 return;
             }
@@ -259,6 +249,30 @@ using std::string;
             return it->second;
         }
 
+        /// drop changed nodes whose value is the one the client already has,
+        /// and update the sent values of the others. Call once per send.
+        void filterChangedNodes()
+        {
+            for (auto it = changedNodes.begin(); it != changedNodes.end();) {
+                auto idIt = idHash.find(*it);
+                if (idIt == idHash.end()) {
+                    ++it;
+                    continue;
+                }
+
+                assert(previousValues.size() > idIt->second);
+                PropertyValue newVal(*it);
+                if (previousValues[idIt->second].equals(*it, newVal)) {
+                    it = changedNodes.erase(it);
+                } else {
+                    previousValues[idIt->second] = newVal;
+                    ++it;
+                }
+            }
+
+            recentlyRemoved.clear();
+        }
+
         cJSON* makeJSONData()
         {
 #if defined (MIRROR_DEBUG)
@@ -342,16 +356,71 @@ using std::string;
 #if defined (MIRROR_DEBUG)
             SG_LOG(SG_NETWORK, SG_INFO, "making JSON data took:" << st.elapsedMSec() << " for " << newSize << "/" << changedSize << "/" << removedSize);
 #endif
-            recentlyRemoved.clear();
-
             return result;
         }
 
+        /// the binary equivalent of makeJSONData, see MirrorPropertyTreeWebsocket
+        /// for the layout. Created nodes refer to their parent by id, so
+        /// parents are always sent before their children.
+        void makeBinaryData(SGPropertyNode* root, MessagePackWriter& writer)
+        {
+            createdOrder.clear();
+            for (auto prop : newNodes) {
+                addCreated(prop, root);
+            }
+            newNodes.clear();
+
+            writer.writeArrayHeader(3);
+            writer.writeArrayHeader(6 * createdOrder.size());
+            for (auto prop : createdOrder) {
+                const bool isRoot = (prop == root) || !prop->getParent();
+                writer.writeInt(idHash[prop]);
+                writer.writeInt(isRoot ? 0 : idHash[prop->getParent()]);
+                writer.writeString(isRoot ? std::string() : prop->getNameString());
+                writer.writeInt(prop->getIndex());
+                writer.writeInt(prop->getPosition());
+                if (prop->getType() == simgear::props::NONE) {
+                    writer.writeNil();
+                } else {
+                    writer.writePropertyValue(prop);
+                }
+            }
+
+            writer.writeArrayHeader(removedNodes.size());
+            for (auto propId : removedNodes) {
+                writer.writeInt(propId);
+            }
+            removedNodes.clear();
+
+            writer.writeArrayHeader(2 * changedNodes.size());
+            for (auto prop : changedNodes) {
+                writer.writeInt(idForProperty(prop));
+                writer.writePropertyValue(prop);
+            }
+            changedNodes.clear();
+        }
+
         bool haveChangesToSend() const
         {
             return !newNodes.empty() || !changedNodes.empty() || !removedNodes.empty();
         }
     private:
+        void addCreated(SGPropertyNode* prop, SGPropertyNode* root)
+        {
+            if (idHash.find(prop) != idHash.end()) {
+                return; // already known to the client
+            }
+
+            SGPropertyNode* parent = prop->getParent();
+            if ((prop != root) && parent) {
+                addCreated(parent, root);
+            }
+
+            changedNodes.erase(prop); // avoid duplicate send
+            idForProperty(prop);
+            createdOrder.push_back(prop);
+        }
+
         PropertyId nextPropertyId = 1;
         std::unordered_map<SGPropertyNode*, PropertyId> idHash;
         std::vector<PropertyValue> previousValues;
@@ -360,6 +429,9 @@ using std::string;
         /// after with the same type, since we can make this much more efficient
         /// when sending over the wire.
         std::vector<RemovedNode> recentlyRemoved;
+
+        // kept to avoid an allocation per send
+        std::vector<SGPropertyNode*> createdOrder;
     };
 
 #if 0
@@ -417,10 +489,11 @@ static void handleExecCommand(cJSON* json)
 }
 #endif
 
-MirrorPropertyTreeWebsocket::MirrorPropertyTreeWebsocket(const std::string& path) :
+MirrorPropertyTreeWebsocket::MirrorPropertyTreeWebsocket(const std::string& path, bool binary) :
     _rootPath(path),
     _listener(new MirrorTreeListener),
-    _minSendInterval(100)
+    _minSendInterval(static_cast<int>(fgGetDouble("/sim/http/mirror-websocket/update-interval-secs", 0.1) * 1000)),
+    _binary(binary)
 {
     checkNodeExists();
 }
@@ -446,6 +519,14 @@ void MirrorPropertyTreeWebsocket::checkNodeExists()
     }
 }
 
+void MirrorPropertyTreeWebsocket::sendBinaryData(WebsocketWriter& writer)
+{
+    _writer.clear();
+    _listener->makeBinaryData(_subtreeRoot.get(), _writer);
+    writer.writeBinary(_writer.data().data(), _writer.data().size());
+    _sentBinaryFrame = true;
+}
+
 void MirrorPropertyTreeWebsocket::handleRequest(const HTTPRequest & request, WebsocketWriter &writer)
 {
     if (!_subtreeRoot) {
@@ -516,6 +597,11 @@ void MirrorPropertyTreeWebsocket::poll(WebsocketWriter & writer)
     if (!_subtreeRoot) {
         checkNodeExists();
         if (!_subtreeRoot) {
+            if (_binary && !_sentBinaryFrame) {
+                // an empty update, so the client knows the binary encoding
+                // is served and doesn't fall back to JSON meanwhile
+                sendBinaryData(writer);
+            }
             return;
         }
     }
@@ -531,6 +617,18 @@ void MirrorPropertyTreeWebsocket::poll(WebsocketWriter & writer)
     // okay, we will send now, update the send stamp
     _lastSendTime.stamp();
 
+    // everything that changed since the last send goes in one message, and
+    // values which changed back meanwhile aren't sent at all
+    _listener->filterChangedNodes();
+    if (!_listener->haveChangesToSend()) {
+        return;
+    }
+
+    if (_binary) {
+        sendBinaryData(writer);
+        return;
+    }
+
     cJSON * json = _listener->makeJSONData();
     char * jsonString = cJSON_PrintUnformatted( json );
     writer.writeText( jsonString );
@@ -21,6 +21,7 @@
 #ifndef MIRROR_PROP_TREE_WEBSOCKET_HXX_
 #define MIRROR_PROP_TREE_WEBSOCKET_HXX_
 
+#include "MessagePack.hxx"
 #include "Websocket.hxx"
 
 #include <simgear/props/props.hxx>
@@ -33,11 +34,27 @@ namespace flightgear {
 namespace http {
 
     class MirrorTreeListener;
-    
+
+/**
+ * Mirrors a property sub-tree to the client: the whole tree first, then
+ * created, removed and changed nodes, at most once per
+ * /sim/http/mirror-websocket/update-interval-secs.
+ *
+ * The default encoding is JSON text frames. The binary encoding sends a
+ * MessagePack array of three arrays per update, keeping paths and names
+ * out of everything but node creation:
+ *
+ *   [[id, parent-id, name, index, position, value, ...],   created
+ *    [id, ...],                                            removed
+ *    [id, value, ...]]                                     changed
+ *
+ * The mirrored root has parent id 0 and an empty name. While the root
+ * doesn't exist, a single update with three empty arrays is sent.
+ */
 class MirrorPropertyTreeWebsocket : public Websocket
 {
 public:
-    MirrorPropertyTreeWebsocket(const std::string& path);
+    MirrorPropertyTreeWebsocket(const std::string& path, bool binary = false);
     ~MirrorPropertyTreeWebsocket() override;
 
     void close() override;
@@ -46,6 +63,7 @@ public:
 
 private:
     void checkNodeExists();
+    void sendBinaryData(WebsocketWriter& writer);
 
     friend class MirrorTreeListener;
 
@@ -54,6 +72,9 @@ private:
     std::unique_ptr<MirrorTreeListener> _listener;
     int _minSendInterval;
     SGTimeStamp _lastSendTime;
+    bool _binary;
+    bool _sentBinaryFrame = false;
+    MessagePackWriter _writer;
 };
 
 }
@@ -20,12 +20,31 @@
 
 #include "PropertyChangeObserver.hxx"
 
+#include <cmath>
+
 #include <Main/fg_props.hxx>
 using std::string;
 namespace flightgear {
 namespace http {
 
+PropertyChangeObserverEntry::PropertyChangeObserverEntry(SGPropertyNode* node)
+    : _node(node),
+      _version(1) // watchers start at 0, so they send the initial value
+{
+  _node->addChangeListener(this);
+}
 
+PropertyChangeObserverEntry::~PropertyChangeObserverEntry()
+{
+  _node->removeChangeListener(this);
+}
+
+void PropertyChangeObserverEntry::valueChanged(SGPropertyNode* node)
+{
+  // changes of the children are reported to us, too
+  if (node == _node)
+    ++_version;
+}
 
 PropertyChangeObserver::PropertyChangeObserver()
 {
@@ -38,67 +57,72 @@ PropertyChangeObserver::~PropertyChangeObserver()
 
 void PropertyChangeObserver::check()
 {
-
-  for (Entries_t::iterator it = _entries.begin(); it != _entries.end(); ++it) {
-    if (!(*it)->_node.isShared()) {
-      // node is no longer used but by us - remove the entry
+  for (Entries_t::iterator it = _entries.begin(); it != _entries.end();) {
+    if (!it->isShared()) {
+      // no websocket watches the node any more - remove the entry
       it = _entries.erase(it);
       continue;
     }
 
-    if(!(*it)->_changed ) {
-      (*it)->_changed = (*it)->_prevValue != (*it)->_node->getStringValue();
-      if ((*it)->_changed)
-        (*it)->_prevValue = (*it)->_node->getStringValue();
-
-    }
-  }
-}
-
-void PropertyChangeObserver::uncheck()
-{
-  for (Entries_t::iterator it = _entries.begin(); it != _entries.end(); ++it) {
-    (*it)->_changed = false;
+    if ((*it)->_node->isTied())
+      ++(*it)->_version;
+    ++it;
   }
 }
 
-const SGPropertyNode_ptr PropertyChangeObserver::addObservation( const string propertyName)
+const PropertyChangeObserverEntryRef PropertyChangeObserver::addObservation( const string propertyName)
 {
   for (Entries_t::iterator it = _entries.begin(); it != _entries.end(); ++it) {
     if (propertyName == (*it)->_node->getPath(true) ) {
-      // if a new observer is added to a property, mark it as changed to ensure the observer
-      // gets notified on initial call. This also causes a notification for all other observers of this
-      // property.
-      (*it)->_changed = true;
-      return (*it)->_node;
+      return *it;
     }
   }
 
   try {
-    PropertyChangeObserverEntryRef entry = new PropertyChangeObserverEntry();
-    entry->_node = fgGetNode( propertyName, true );
+    PropertyChangeObserverEntryRef entry = new PropertyChangeObserverEntry(fgGetNode( propertyName, true ));
     _entries.push_back( entry );
-    return entry->_node;
+    return entry;
   }
   catch( string & s ) {
     SG_LOG(SG_NETWORK,SG_WARN,"httpd: can't observer '" << propertyName << "'. Invalid name." );
   }
 
-  SGPropertyNode_ptr empty;
-  return empty;
+  return PropertyChangeObserverEntryRef();
 }
 
-bool PropertyChangeObserver::isChangedValue(const SGPropertyNode_ptr node)
+bool PropertyWatch::needsUpdate()
 {
-  for (Entries_t::iterator it = _entries.begin(); it != _entries.end(); ++it) {
-    PropertyChangeObserverEntryRef entry = *it;
-
-    if( entry->_node == node && entry->_changed ) {
-      return true;
+  if (_seenVersion == _entry->_version)
+    return false;
+  _seenVersion = _entry->_version;
+
+  SGPropertyNode* node = _entry->_node;
+  switch (node->getType()) {
+  case simgear::props::FLOAT:
+  case simgear::props::DOUBLE: {
+    const double value = node->getDoubleValue();
+    if (_sent) {
+      // NaN compares unequal to everything, itself included
+      if (std::isnan(value) && std::isnan(_sentNumber))
+        return false;
+      if (std::fabs(value - _sentNumber) <= _deadband)
+        return false;
     }
+    _sentNumber = value;
+    break;
+  }
+  default: {
+    // bools and integers are sent on any change, whatever the deadband
+    string value = node->getStringValue();
+    if (_sent && value == _sentString)
+      return false;
+    _sentString = std::move(value);
+    break;
+  }
   }
 
-  return false;
+  _sent = true;
+  return true;
 }
 
 }  // namespace http
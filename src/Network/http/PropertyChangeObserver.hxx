@@ -28,28 +28,56 @@
 namespace flightgear {
 namespace http {
 
-struct PropertyChangeObserverEntry : public SGReferenced {
-  PropertyChangeObserverEntry()
-      : _changed(true)
-  {
-  }
+/**
+ * A watched property, shared by all websockets watching it. Property
+ * listeners bump _version whenever the node is written, so watchers only
+ * look at the value of nodes which were written since they last sent it.
+ * Tied nodes don't notify listeners; their version is bumped every check().
+ */
+struct PropertyChangeObserverEntry : public SGReferenced,
+                                     public SGPropertyChangeListener {
+  PropertyChangeObserverEntry(SGPropertyNode* node);
+  ~PropertyChangeObserverEntry();
+
+  void valueChanged(SGPropertyNode* node) override;
+
   SGPropertyNode_ptr _node;
-  std::string _prevValue;
-  bool _changed;
+  unsigned _version;
 };
 
 typedef SGSharedPtr<PropertyChangeObserverEntry> PropertyChangeObserverEntryRef;
 
+/**
+ * A node watched by one websocket, and what it last sent of it. Floating
+ * point values are compared as numbers, against the deadband; everything
+ * else, bools and integers included, is compared exactly as a string.
+ */
+struct PropertyWatch {
+  PropertyWatch(const PropertyChangeObserverEntryRef& entry, double deadband)
+      : _entry(entry), _deadband(deadband)
+  {
+  }
+
+  /// whether the node changed enough since we last sent it
+  bool needsUpdate();
+
+  PropertyChangeObserverEntryRef _entry;
+  unsigned _seenVersion = 0;
+  double _deadband = 0.0;
+  bool _sent = false;
+  double _sentNumber = 0.0;
+  std::string _sentString;
+};
+
 class PropertyChangeObserver {
 public:
   PropertyChangeObserver();
   virtual ~PropertyChangeObserver();
 
-  const SGPropertyNode_ptr addObservation( const std::string propertyName);
-  bool isChangedValue(const SGPropertyNode_ptr node);
+  const PropertyChangeObserverEntryRef addObservation( const std::string propertyName);
 
+  /// poll the tied nodes, and forget the entries nobody watches any more
   void check();
-  void uncheck();
 
   void clear() { _entries.clear(); }
 
@@ -121,7 +121,9 @@ PropertyChangeWebsocket::PropertyChangeWebsocket(PropertyChangeObserver * proper
     : id(++nextid),
       _propertyChangeObserver(propertyChangeObserver),
       _minTriggerInterval(fgGetDouble("/sim/http/property-websocket/update-interval-secs", 0.05)), // default 20Hz
-      _lastTrigger(-1000)
+      _lastTrigger(-1000),
+      _defaultDeadband(fgGetDouble("/sim/http/property-websocket/deadband", 0.0)),
+      _batch(fgGetBool("/sim/http/property-websocket/batch", false))
 {
 }
 
@@ -162,7 +164,8 @@ void PropertyChangeWebsocket::handleRequest(const HTTPRequest & request, Websock
    '/bar/baz',
    '/foo/bar'
    ],
-   node: '/bax/foo'
+   node: '/bax/foo',
+   deadband: 0.01
    }
    */
   cJSON * json = cJSON_Parse(request.Content.c_str());
@@ -197,9 +200,16 @@ void PropertyChangeWebsocket::handleRequest(const HTTPRequest & request, Websock
     } else if (command == "exec") {
       handleExecCommand(json);
     } else {
+      // floating point changes smaller than the deadband aren't sent
+      double deadband = _defaultDeadband;
+      j = cJSON_GetObjectItem(json, "deadband");
+      if ( NULL != j && cJSON_Number == j->type) {
+        deadband = j->valuedouble;
+      }
+
       string_list::const_iterator it;
       for (it = nodeNames.begin(); it != nodeNames.end(); ++it) {
-        _watchedNodes.handleCommand(command, *it, _propertyChangeObserver);
+        _watchedNodes.handleCommand(command, *it, deadband, _propertyChangeObserver);
       }
     }
     
@@ -218,35 +228,49 @@ void PropertyChangeWebsocket::poll(WebsocketWriter & writer)
     _lastTrigger = now;
   }
 
+  // All changes since the last trigger are coalesced into the current
+  // value; with batching they go out as a single array.
+  string batch;
   for (WatchedNodesList::iterator it = _watchedNodes.begin(); it != _watchedNodes.end(); ++it) {
-    SGPropertyNode_ptr node = *it;
+    if (!it->needsUpdate())
+      continue;
 
-    string newValue;
-    if (_propertyChangeObserver->isChangedValue(node)) {
-      string out = JSON::toJsonString( false, node, 0, now );
-      SG_LOG(SG_NETWORK, SG_DEBUG, "PropertyChangeWebsocket::poll() new Value for " << node->getPath(true) << " '" << node->getStringValue() << "' #" << id << ": " << out );
+    SGPropertyNode_ptr node = it->_entry->_node;
+    string out = JSON::toJsonString( false, node, 0, now );
+    SG_LOG(SG_NETWORK, SG_DEBUG, "PropertyChangeWebsocket::poll() new Value for " << node->getPath(true) << " #" << id << ": " << out );
+    if (_batch) {
+      batch += batch.empty() ? "[" : ",";
+      batch += out;
+    } else {
       writer.writeText( out );
     }
   }
+
+  if (!batch.empty()) {
+    batch += "]";
+    writer.writeText( batch );
+  }
 }
 
 void PropertyChangeWebsocket::WatchedNodesList::handleCommand(const string & command, const string & node,
-    PropertyChangeObserver * propertyChangeObserver)
+    double deadband, PropertyChangeObserver * propertyChangeObserver)
 {
   if (command == "addListener") {
     for (iterator it = begin(); it != end(); ++it) {
-      if (node == (*it)->getPath(true)) {
+      if (node == it->_entry->_node->getPath(true)) {
         SG_LOG(SG_NETWORK, SG_WARN, "httpd: " << command << " '" << node << "' ignored (duplicate)");
         return; // dupliate
       }
     }
-    SGPropertyNode_ptr n = propertyChangeObserver->addObservation(node);
-    if (n.valid()) push_back(n);
+    PropertyChangeObserverEntryRef entry = propertyChangeObserver->addObservation(node);
+    if (entry.valid()) {
+      push_back(PropertyWatch(entry, deadband));
+    }
     SG_LOG(SG_NETWORK, SG_INFO, "httpd: " << command << " '" << node << "' success");
 
   } else if (command == "removeListener") {
     for (iterator it = begin(); it != end(); ++it) {
-      if (node == (*it)->getPath(true)) {
+      if (node == it->_entry->_node->getPath(true)) {
         this->erase(it);
         SG_LOG(SG_NETWORK, SG_INFO, "httpd: " << command << " '" << node << "' success");
         return;
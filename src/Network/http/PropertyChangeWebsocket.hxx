@@ -22,6 +22,7 @@
 #define PROPERTYCHANGEWEBSOCKET_HXX_
 
 #include "Websocket.hxx"
+#include "PropertyChangeObserver.hxx"
 #include <simgear/props/props.hxx>
 
 #include <vector>
@@ -29,8 +30,6 @@
 namespace flightgear {
 namespace http {
 
-class PropertyChangeObserver;
-
 class PropertyChangeWebsocket: public Websocket {
 public:
   PropertyChangeWebsocket(PropertyChangeObserver * propertyChangeObserver);
@@ -44,15 +43,18 @@ private:
   PropertyChangeObserver * _propertyChangeObserver;
 
   void handleGetCommand(const string_list& nodes, WebsocketWriter &writer);
-  
-  class WatchedNodesList: public std::vector<SGPropertyNode_ptr> {
+
+  class WatchedNodesList: public std::vector<PropertyWatch> {
   public:
-    void handleCommand(const std::string & command, const std::string & node, PropertyChangeObserver * propertyChangeObserver);
+    void handleCommand(const std::string & command, const std::string & node, double deadband,
+                       PropertyChangeObserver * propertyChangeObserver);
   };
 
   WatchedNodesList _watchedNodes;
   double _minTriggerInterval;
   double _lastTrigger;
+  double _defaultDeadband;
+  bool _batch;
 };
 
 }
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileName: PropertyStreamWebsocket.cxx
+ * SPDX-FileComment: A websocket streaming property values as packed binary frames
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "PropertyStreamWebsocket.hxx"
+#include "jsonprops.hxx"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <simgear/debug/logstream.hxx>
+#include <simgear/misc/strutils.hxx>
+
+#include <Main/fg_props.hxx>
+
+#include <cJSON.h>
+
+namespace flightgear {
+namespace http {
+
+using std::string;
+
+PropertyStreamWebsocket::PropertyStreamWebsocket(PropertyChangeObserver* propertyChangeObserver)
+    : _propertyChangeObserver(propertyChangeObserver),
+      _minTriggerInterval(fgGetDouble("/sim/http/property-websocket/update-interval-secs", 0.05)),
+      _defaultDeadband(fgGetDouble("/sim/http/property-websocket/deadband", 0.0))
+{
+}
+
+PropertyStreamWebsocket::~PropertyStreamWebsocket()
+{
+}
+
+void PropertyStreamWebsocket::close()
+{
+    SG_LOG(SG_NETWORK, SG_INFO, "closing PropertyStreamWebsocket");
+    _changed.clear();
+    _nodes.clear();
+}
+
+void PropertyStreamWebsocket::handleRequest(const HTTPRequest& request, WebsocketWriter& writer)
+{
+    if (request.Content.empty()) return;
+
+    cJSON* json = cJSON_Parse(request.Content.c_str());
+    if (!json) {
+        SG_LOG(SG_NETWORK, SG_WARN, "httpd: PropertyStream: can't parse '" << request.Content << "'");
+        return;
+    }
+
+    string command;
+    cJSON* j = cJSON_GetObjectItem(json, "command");
+    if (j && j->valuestring) {
+        command = j->valuestring;
+    }
+
+    string_list nodeNames;
+    j = cJSON_GetObjectItem(json, "node");
+    if (j && j->valuestring) {
+        nodeNames.push_back(simgear::strutils::strip(string(j->valuestring)));
+    }
+    cJSON* nodes = cJSON_GetObjectItem(json, "nodes");
+    if (nodes) {
+        for (int i = 0; i < cJSON_GetArraySize(nodes); i++) {
+            cJSON* node = cJSON_GetArrayItem(nodes, i);
+            if (node && node->valuestring) {
+                nodeNames.push_back(simgear::strutils::strip(string(node->valuestring)));
+            }
+        }
+    }
+
+    if (command == "addListener") {
+        double deadband = _defaultDeadband;
+        j = cJSON_GetObjectItem(json, "deadband");
+        if (j && j->type == cJSON_Number) {
+            deadband = j->valuedouble;
+        }
+
+        cJSON* reply = cJSON_CreateObject();
+        cJSON_AddItemToObject(reply, "command", cJSON_CreateString("ids"));
+        cJSON* ids = cJSON_CreateArray();
+        cJSON_AddItemToObject(reply, "nodes", ids);
+        for (const auto& name : nodeNames) {
+            addNode(name, deadband, ids);
+        }
+
+        char* text = cJSON_PrintUnformatted(reply);
+        writer.writeText(text);
+        free(text);
+        cJSON_Delete(reply);
+    } else if (command == "removeListener") {
+        for (const auto& name : nodeNames) {
+            removeNode(name);
+        }
+    } else {
+        SG_LOG(SG_NETWORK, SG_WARN, "httpd: PropertyStream: unknown command '" << command << "'");
+    }
+
+    cJSON_Delete(json);
+}
+
+void PropertyStreamWebsocket::addNode(const string& path, double deadband, cJSON* ids)
+{
+    auto it = std::find_if(_nodes.begin(), _nodes.end(), [&path](const StreamedNode& n) {
+        return n._watch._entry->_node->getPath(true) == path;
+    });
+
+    unsigned id;
+    SGPropertyNode* node;
+    if (it != _nodes.end()) {
+        // subscribing again resends the current value
+        it->_watch._deadband = deadband;
+        it->_watch._seenVersion = 0;
+        it->_watch._sent = false;
+        id = it->_id;
+        node = it->_watch._entry->_node;
+    } else {
+        PropertyChangeObserverEntryRef entry = _propertyChangeObserver->addObservation(path);
+        if (!entry.valid()) {
+            return;
+        }
+
+        id = _nextId++;
+        node = entry->_node;
+        _nodes.emplace_back(entry, deadband, id);
+    }
+
+    cJSON* item = cJSON_CreateObject();
+    cJSON_AddItemToObject(item, "path", cJSON_CreateString(path.c_str()));
+    cJSON_AddItemToObject(item, "id", cJSON_CreateNumber(id));
+    cJSON_AddItemToObject(item, "type", cJSON_CreateString(JSON::getPropertyTypeString(node->getType())));
+    cJSON_AddItemToArray(ids, item);
+}
+
+void PropertyStreamWebsocket::removeNode(const string& path)
+{
+    auto it = std::find_if(_nodes.begin(), _nodes.end(), [&path](const StreamedNode& n) {
+        return n._watch._entry->_node->getPath(true) == path;
+    });
+    if (it == _nodes.end()) {
+        SG_LOG(SG_NETWORK, SG_WARN, "httpd: PropertyStream: removeListener '" << path << "' ignored (not found)");
+        return;
+    }
+
+    _nodes.erase(it);
+}
+
+void PropertyStreamWebsocket::poll(WebsocketWriter& writer)
+{
+    const double now = fgGetDouble("/sim/time/elapsed-sec");
+    if (_minTriggerInterval > 0.0) {
+        if (now - _lastTrigger <= _minTriggerInterval)
+            return;
+        _lastTrigger = now;
+    }
+
+    _changed.clear();
+    for (auto& n : _nodes) {
+        if (n._watch.needsUpdate()) {
+            _changed.push_back(&n);
+        }
+    }
+    if (_changed.empty()) {
+        return;
+    }
+
+    _writer.clear();
+    _writer.writeArrayHeader(1 + 2 * _changed.size());
+    _writer.writeDouble(now);
+    for (auto n : _changed) {
+        _writer.writeInt(n->_id);
+        _writer.writePropertyValue(n->_watch._entry->_node);
+    }
+    writer.writeBinary(_writer.data().data(), _writer.data().size());
+}
+
+} // namespace http
+} // namespace flightgear
@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileName: PropertyStreamWebsocket.hxx
+ * SPDX-FileComment: A websocket streaming property values as packed binary frames
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "MessagePack.hxx"
+#include "PropertyChangeObserver.hxx"
+#include "Websocket.hxx"
+
+#include <string>
+#include <vector>
+
+struct cJSON;
+
+namespace flightgear {
+namespace http {
+
+/**
+ * The binary counterpart of PropertyChangeWebsocket, for clients streaming
+ * many values.
+ *
+ * Clients subscribe with the same JSON text commands as on
+ * /PropertyListener (addListener and removeListener, with node or nodes
+ * and an optional deadband). Each addListener is answered with a text
+ * frame assigning numeric ids:
+ *
+ *   {"command":"ids","nodes":[{"path":"/velocities/airspeed-kt","id":0,"type":"double"}]}
+ *
+ * From then on, changes come as binary frames holding one MessagePack
+ * array: the sim time, followed by an id and the new value for each
+ * changed node.
+ *
+ *   [elapsed-sec, id, value, id, value, ...]
+ *
+ * Ids aren't reused within a connection.
+ */
+class PropertyStreamWebsocket : public Websocket
+{
+public:
+    PropertyStreamWebsocket(PropertyChangeObserver* propertyChangeObserver);
+    ~PropertyStreamWebsocket() override;
+
+    void close() override;
+    void handleRequest(const HTTPRequest& request, WebsocketWriter& writer) override;
+    void poll(WebsocketWriter& writer) override;
+
+private:
+    struct StreamedNode {
+        StreamedNode(const PropertyChangeObserverEntryRef& entry, double deadband, unsigned id)
+            : _watch(entry, deadband), _id(id)
+        {
+        }
+
+        PropertyWatch _watch;
+        unsigned _id;
+    };
+
+    void addNode(const std::string& path, double deadband, cJSON* ids);
+    void removeNode(const std::string& path);
+
+    PropertyChangeObserver* _propertyChangeObserver;
+    std::vector<StreamedNode> _nodes;
+    unsigned _nextId = 0;
+    double _minTriggerInterval;
+    double _lastTrigger = -1000.0;
+    double _defaultDeadband;
+
+    // kept to avoid an allocation per frame
+    std::vector<StreamedNode*> _changed;
+    MessagePackWriter _writer;
+};
+
+} // namespace http
+} // namespace flightgear
@@ -24,6 +24,7 @@
 #include "HTTPRequest.hxx"
 #include "PropertyChangeWebsocket.hxx"
 #include "MirrorPropertyTreeWebsocket.hxx"
+#include "PropertyStreamWebsocket.hxx"
 #include "ScreenshotUriHandler.hxx"
 #include "PropertyUriHandler.hxx"
 #include "JsonUriHandler.hxx"
@@ -554,7 +555,6 @@ void MongooseHttpd::update(double dt)
 {
   _propertyChangeObserver.check();
   mg_poll_server(_server, 0);
-  _propertyChangeObserver.uncheck();
 }
 
 int MongooseHttpd::poll(struct mg_connection * connection)
@@ -595,10 +595,17 @@ Websocket * MongooseHttpd::newWebsocket(const string & uri)
   if (uri.find("/PropertyListener") == 0) {
     SG_LOG(SG_NETWORK, SG_INFO, "new PropertyChangeWebsocket for: " << uri);
     return new PropertyChangeWebsocket(&_propertyChangeObserver);
+  } else if (uri.find("/PropertyStream") == 0) {
+    SG_LOG(SG_NETWORK, SG_INFO, "new PropertyStreamWebsocket for: " << uri);
+    return new PropertyStreamWebsocket(&_propertyChangeObserver);
   } else if (uri.find("/PropertyTreeMirror/") == 0) {
     const auto path = uri.substr(20);
     SG_LOG(SG_NETWORK, SG_INFO, "new MirrorPropertyTreeWebsocket for: " << path);
     return new MirrorPropertyTreeWebsocket(path);
+  } else if (uri.find("/PropertyTreeMirrorBinary/") == 0) {
+    const auto path = uri.substr(26);
+    SG_LOG(SG_NETWORK, SG_INFO, "new binary MirrorPropertyTreeWebsocket for: " << path);
+    return new MirrorPropertyTreeWebsocket(path, true);
   }
   return NULL;
 }
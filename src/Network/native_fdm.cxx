@@ -25,6 +25,8 @@
 #  include <config.h>
 #endif
 
+#include <cstring>
+
 #include <simgear/debug/logstream.hxx>
 #include <simgear/io/iochannel.hxx>
 #include <simgear/timing/sg_time.hxx>
@@ -128,6 +130,67 @@ bool FGNativeFDM::process() {
     return true;
 }
 
+bool FGNativeFDM::gen_output( std::string& out ) {
+    out.clear();
+    if ( get_direction() != SG_IO_OUT ) {
+        return true;
+    }
+
+    if ( get_io_channel()->get_type() == sgDDSType ) {
+        FGProps2FDM( globals->get_props(), &fdm.dds );
+        out.assign( reinterpret_cast<const char*>(&fdm.dds), sizeof(FG_DDS_FDM) );
+    } else {
+        FGProps2FDM( globals->get_props(), &fdm.net );
+        out.assign( reinterpret_cast<const char*>(&fdm.net), sizeof(FGNetFDM) );
+    }
+    return true;
+}
+
+// Runs on the I/O worker, so it mustn't use the fdm member.
+bool FGNativeFDM::transfer( const std::string& out, std::vector<std::string>& in ) {
+    SGIOChannel *io = get_io_channel();
+
+    if ( !out.empty() && !io->write( out.data(), out.size() ) ) {
+        SG_LOG( SG_IO, SG_ALERT, "Error writing data." );
+        return false;
+    }
+
+    if ( get_direction() != SG_IO_IN ) {
+        return true;
+    }
+
+    const int length = ( io->get_type() == sgDDSType ) ? sizeof(FG_DDS_FDM) : sizeof(FGNetFDM);
+    std::string record( length, '\0' );
+    if ( io->get_type() == sgFileType ) {
+        if ( io->read( &record[0], length ) == length ) {
+            in.push_back( record );
+        }
+    } else {
+        while ( io->read( &record[0], length ) == length ) {
+            in.push_back( record );
+        }
+    }
+    return true;
+}
+
+bool FGNativeFDM::apply_input( const std::string& in ) {
+    if ( get_io_channel()->get_type() == sgDDSType ) {
+        if ( in.size() != sizeof(FG_DDS_FDM) ) {
+            return false;
+        }
+        memcpy( &fdm.dds, in.data(), in.size() );
+        FGFDM2Props( globals->get_props(), &fdm.dds );
+    } else {
+        if ( in.size() != sizeof(FGNetFDM) ) {
+            return false;
+        }
+        memcpy( &fdm.net, in.data(), in.size() );
+        FGFDM2Props( globals->get_props(), &fdm.net );
+    }
+    return true;
+}
+
+
 // close the channel
 bool FGNativeFDM::close() {
     SGIOChannel *io = get_io_channel();
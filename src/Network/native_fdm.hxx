@@ -56,6 +56,12 @@ public:
     // process work for this port
     bool process();
 
+    // split processing, see FGProtocol
+    bool supports_async() const { return true; }
+    bool gen_output( std::string& out );
+    bool transfer( const std::string& out, std::vector<std::string>& in );
+    bool apply_input( const std::string& in );
+
     // close the channel
     bool close();
 };
@@ -108,6 +108,20 @@ bool FGProtocol::parse_message() {
 }
 
 
+// dummy split processing routines, for protocols which don't support it
+bool FGProtocol::gen_output( std::string& ) {
+    return false;
+}
+
+bool FGProtocol::transfer( const std::string&, std::vector<std::string>& ) {
+    return false;
+}
+
+bool FGProtocol::apply_input( const std::string& ) {
+    return false;
+}
+
+
 void FGProtocol::set_direction( const std::string& d ) {
     if ( d == "in" ) {
 	dir = SG_IO_IN;
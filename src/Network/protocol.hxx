@@ -77,6 +77,16 @@ public:
     virtual bool gen_message();
     virtual bool parse_message();
 
+    // Split processing, for channels driven by an FGIOWorker thread.
+    // gen_output() and apply_input() are called from the main loop and
+    // are the only parts which may touch the property tree; transfer()
+    // is called from the worker and may only touch the I/O channel. It
+    // writes out (unless it is empty) and appends the records read.
+    virtual bool supports_async() const { return false; }
+    virtual bool gen_output( std::string& out );
+    virtual bool transfer( const std::string& out, std::vector<std::string>& in );
+    virtual bool apply_input( const std::string& in );
+
     // inline std::string get_protocol() const { return protocol_str; }
     // inline void set_protocol( const std::string& str ) { protocol_str = str; }
 
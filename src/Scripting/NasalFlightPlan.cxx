@@ -583,7 +583,24 @@ static void waypointGhostSetMember(naContext c, void* g, naRef field, naRef valu
 {
     const char* fieldName = naStr_data(field);
     Waypt*      wpt = (Waypt*)g;
-    waypointCommonSetMember(c, wpt, fieldName, value);
+    if (!waypointCommonSetMember(c, wpt, fieldName, value)) {
+        return;
+    }
+
+    // the waypoint may be shared with a flight plan leg: tell the plan, so
+    // its route path and delegates see the change
+    auto fp = dynamic_cast<FlightPlan*>(wpt->owner());
+    if (!fp) {
+        return;
+    }
+
+    for (int i = 0; i < fp->numLegs(); ++i) {
+        auto leg = fp->legAtIndex(i);
+        if (leg->waypoint() == wpt) {
+            leg->markWaypointDirty();
+            break;
+        }
+    }
 }
 
 static void legGhostSetMember(naContext c, void* g, naRef field, naRef value)
@@ -2122,7 +2139,7 @@ static naRef f_leg_courseAndDistanceFrom(naContext c, naRef me, int argc, naRef*
     SGGeod pos;
     geodFromArgs(args, 0, argc, pos);
 
-    RoutePath path(leg->owner());
+    const RoutePath& path = leg->owner()->routePath();
     SGGeod    wpPos = path.positionForIndex(leg->index());
     double    courseDeg, az2, distanceM;
     SGGeodesy::inverse(pos, wpPos, courseDeg, az2, distanceM);
@@ -2140,7 +2157,7 @@ static naRef f_leg_path(naContext c, naRef me, int argc, naRef* args)
         naRuntimeError(c, "leg.setAltitude called on non-flightplan-leg object");
     }
 
-    RoutePath path(leg->owner());
+    const RoutePath& path = leg->owner()->routePath();
     SGGeodVec gv(path.pathForIndex(leg->index()));
 
     naRef result = naNewVector(c);
@@ -63,6 +63,7 @@ FGAISchedule::FGAISchedule()
       radius(0),
       groundOffset(0),
       distanceToUser(0),
+      distanceUpdated(false),
       score(0),
       runCount(0),
       hits(0),
@@ -101,6 +102,7 @@ FGAISchedule::FGAISchedule(const string& model,
       radius(rad),
       groundOffset(grnd),
       distanceToUser(0),
+      distanceUpdated(false),
       score(0),
       runCount(0),
       hits(0),
@@ -132,6 +134,7 @@ FGAISchedule::FGAISchedule(const FGAISchedule& other) : modelPath{other.modelPat
     groundOffset = other.groundOffset;
     score = other.score;
     distanceToUser = other.distanceToUser;
+    distanceUpdated = other.distanceUpdated;
     runCount = other.runCount;
     hits = other.hits;
     lastRun = other.lastRun;
@@ -194,6 +197,7 @@ bool FGAISchedule::update(time_t now, const SGVec3d& userCart)
     time_t remainingTimeEnroute;
     time_t deptime = 0;
 
+    distanceUpdated = false;
     if (!valid) {
         return true; // processing complete
     }
@@ -298,6 +302,7 @@ bool FGAISchedule::update(time_t now, const SGVec3d& userCart)
     // cartesian calculations are more numerically stable over the (potentially)
     // large distances involved here: see bug #80
     distanceToUser = dist(userCart, SGVec3d::fromGeod(position)) * SG_METER_TO_NM;
+    distanceUpdated = true;
 
 
     // If distance between user and simulated aircraft is less
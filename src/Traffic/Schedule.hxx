@@ -57,6 +57,7 @@ private:
     double radius;
     double groundOffset;
     double distanceToUser;
+    bool distanceUpdated; ///< the last update() computed distanceToUser
     double score;
     unsigned int runCount;
     unsigned int hits;
@@ -119,6 +120,13 @@ public:
     const std::string& getAircraft() { return acType; };
     std::string getCallSign();
     const std::string& getRegistration() { return registration; };
+    const std::string& getHomePort() { return homePort; };
+    /** Distance to the user (nm) as of the last update(). */
+    double getDistanceToUser() { return distanceToUser; };
+    /** False if the last update() returned before computing the distance. */
+    bool isDistanceUpdated() const { return distanceUpdated; };
+    /** Whether the AIManager simulates the aircraft right now. */
+    bool isAIMode() const { return aiAircraft.valid(); };
     std::string getFlightRules();
     bool getHeavy() { return heavy; };
     double getCourse() { return courseToDest; };
@@ -0,0 +1,300 @@
+/*
+ * SPDX-FileName: ScheduleCache.cxx
+ * SPDX-FileComment: binary cache of parsed traffic schedule files
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <config.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+#include <simgear/debug/logstream.hxx>
+#include <simgear/io/iostreams/sgstream.hxx>
+
+#include <Main/globals.hxx>
+
+#include "ScheduleCache.hxx"
+
+namespace {
+
+const uint32_t CACHE_MAGIC = 0x43544746; // 'FGTC'
+const uint32_t CACHE_VERSION = 1;
+
+/// minimal bounds-checked reader over the loaded file
+class BufferReader
+{
+public:
+    BufferReader(const std::vector<char>& buf) : _buf(buf) {}
+
+    template <typename T>
+    bool read(T& value)
+    {
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool readBytes(void* dest, size_t n)
+    {
+        if (_pos + n > _buf.size()) {
+            return false;
+        }
+        memcpy(dest, _buf.data() + _pos, n);
+        _pos += n;
+        return true;
+    }
+
+    bool readString(std::string& s)
+    {
+        uint32_t len;
+        if (!read(len) || (_pos + len > _buf.size())) {
+            return false;
+        }
+        s.assign(_buf.data() + _pos, len);
+        _pos += len;
+        return true;
+    }
+
+private:
+    const std::vector<char>& _buf;
+    size_t _pos = 0;
+};
+
+template <typename T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeString(std::ostream& os, const std::string& s)
+{
+    writeValue(os, static_cast<uint32_t>(s.size()));
+    os.write(s.data(), s.size());
+}
+
+} // of anonymous namespace
+
+FGTrafficScheduleCache::FGTrafficScheduleCache(const SGPath& trafficDir)
+{
+    // FNV-1a of the directory path: stable between runs and builds
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : trafficDir.utf8Str()) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(hash));
+    _cachePath = globals->get_fg_home() / "ai" / "traffic-cache" / name;
+}
+
+FGTrafficScheduleCache::FileStamp FGTrafficScheduleCache::stampFor(const SGPath& path)
+{
+    FileStamp stamp;
+    stamp.path = path.utf8Str();
+    stamp.modTime = path.exists() ? static_cast<int64_t>(path.modTime()) : -1;
+    stamp.size = path.exists() ? static_cast<int64_t>(path.sizeInBytes()) : -1;
+    return stamp;
+}
+
+void FGTrafficScheduleCache::addSourceFile(const SGPath& path)
+{
+    _sources.push_back(stampFor(path));
+}
+
+void FGTrafficScheduleCache::addDependency(const SGPath& path)
+{
+    FileStamp stamp = stampFor(path);
+    if (std::find(_dependencies.begin(), _dependencies.end(), stamp) == _dependencies.end()) {
+        _dependencies.push_back(stamp);
+    }
+}
+
+uint32_t FGTrafficScheduleCache::intern(const std::string& s)
+{
+    auto it = _stringIds.find(s);
+    if (it != _stringIds.end()) {
+        return it->second;
+    }
+
+    const uint32_t id = static_cast<uint32_t>(_strings.size());
+    _strings.push_back(s);
+    _stringIds.emplace(s, id);
+    return id;
+}
+
+void FGTrafficScheduleCache::clearRecords()
+{
+    _strings.clear();
+    _stringIds.clear();
+    _records.clear();
+    _dependencies.clear();
+}
+
+void FGTrafficScheduleCache::addAircraft(const std::string strings[NumAircraftStrings], bool heavy, double radius, double offset)
+{
+    Record r{};
+    r.kind = Aircraft;
+    r.heavy = heavy ? 1 : 0;
+    r.radius = radius;
+    r.offset = offset;
+    for (int i = 0; i < NumAircraftStrings; ++i) {
+        r.strings[i] = intern(strings[i]);
+    }
+    _records.push_back(r);
+}
+
+void FGTrafficScheduleCache::addFlight(const std::string strings[NumFlightStrings], int cruiseAlt)
+{
+    Record r{};
+    r.kind = Flight;
+    r.cruiseAlt = cruiseAlt;
+    for (int i = 0; i < NumFlightStrings; ++i) {
+        r.strings[i] = intern(strings[i]);
+    }
+    _records.push_back(r);
+}
+
+bool FGTrafficScheduleCache::load()
+{
+    if (!_cachePath.exists()) {
+        return false;
+    }
+
+    std::vector<char> buf;
+    {
+        sg_ifstream in(_cachePath, std::ios::in | std::ios::binary);
+        if (!in.is_open()) {
+            return false;
+        }
+        buf.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    BufferReader reader(buf);
+    uint32_t magic, version;
+    if (!reader.read(magic) || !reader.read(version) ||
+        (magic != CACHE_MAGIC) || (version != CACHE_VERSION)) {
+        SG_LOG(SG_AI, SG_INFO, "traffic cache " << _cachePath << " has an unknown format, ignoring");
+        return false;
+    }
+
+    auto readStamps = [&reader](std::vector<FileStamp>& stamps) {
+        uint32_t count;
+        if (!reader.read(count)) {
+            return false;
+        }
+        stamps.resize(count);
+        for (auto& stamp : stamps) {
+            if (!reader.readString(stamp.path) || !reader.read(stamp.modTime) || !reader.read(stamp.size)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<FileStamp> cachedSources, cachedDependencies;
+    if (!readStamps(cachedSources) || !readStamps(cachedDependencies)) {
+        return false;
+    }
+
+    if (cachedSources != _sources) {
+        SG_LOG(SG_AI, SG_INFO, "traffic cache " << _cachePath << " is out of date");
+        return false;
+    }
+
+    for (const auto& dep : cachedDependencies) {
+        if (!(stampFor(SGPath::fromUtf8(dep.path)) == dep)) {
+            SG_LOG(SG_AI, SG_INFO, "traffic cache " << _cachePath << " is out of date: " << dep.path << " changed");
+            return false;
+        }
+    }
+
+    uint32_t stringCount;
+    if (!reader.read(stringCount)) {
+        return false;
+    }
+
+    clearRecords();
+    _strings.resize(stringCount);
+    for (auto& s : _strings) {
+        if (!reader.readString(s)) {
+            return false;
+        }
+    }
+
+    uint32_t recordCount;
+    if (!reader.read(recordCount)) {
+        return false;
+    }
+
+    _records.resize(recordCount);
+    if (!reader.readBytes(_records.data(), recordCount * sizeof(Record))) {
+        _records.clear();
+        return false;
+    }
+
+    // reject string references outside the table, rather than crashing
+    for (const auto& r : _records) {
+        for (uint32_t id : r.strings) {
+            if (id >= stringCount) {
+                _records.clear();
+                return false;
+            }
+        }
+    }
+
+    _dependencies = cachedDependencies;
+    return true;
+}
+
+bool FGTrafficScheduleCache::save() const
+{
+    if (!_cachePath.dirPath().exists()) {
+        // create_dir() creates the parents of the path it is given
+        SGPath(_cachePath).create_dir(0755);
+    }
+
+    // write to a temporary file first, so a crash never leaves a truncated cache
+    SGPath tmp = _cachePath;
+    tmp.concat(".tmp");
+
+    {
+        sg_ofstream out(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            SG_LOG(SG_AI, SG_WARN, "unable to write traffic cache " << tmp);
+            return false;
+        }
+
+        writeValue(out, CACHE_MAGIC);
+        writeValue(out, CACHE_VERSION);
+
+        for (const auto* stamps : {&_sources, &_dependencies}) {
+            writeValue(out, static_cast<uint32_t>(stamps->size()));
+            for (const auto& stamp : *stamps) {
+                writeString(out, stamp.path);
+                writeValue(out, stamp.modTime);
+                writeValue(out, stamp.size);
+            }
+        }
+
+        writeValue(out, static_cast<uint32_t>(_strings.size()));
+        for (const auto& s : _strings) {
+            writeString(out, s);
+        }
+
+        writeValue(out, static_cast<uint32_t>(_records.size()));
+        out.write(reinterpret_cast<const char*>(_records.data()), _records.size() * sizeof(Record));
+
+        if (!out) {
+            SG_LOG(SG_AI, SG_WARN, "failed writing traffic cache " << tmp);
+            return false;
+        }
+    }
+
+    SGPath target = _cachePath;
+    if (target.exists()) {
+        target.remove();
+    }
+    return tmp.rename(target);
+}
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileName: ScheduleCache.hxx
+ * SPDX-FileComment: binary cache of parsed traffic schedule files
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <simgear/misc/sg_path.hxx>
+
+/**
+ * Binary cache of the aircraft and flight records found in the traffic XML
+ * files of one traffic directory, so later launches can skip XML parsing.
+ *
+ * The records are stored raw, in document order, exactly as the parser saw
+ * them at the end of each <aircraft> and <flight> element; everything that
+ * depends on the rest of the installation (model availability, the traffic
+ * proportion, generated aircraft ids) is still decided when the records are
+ * replayed.
+ *
+ * The file is stamped with the path, size and modification time of every
+ * source XML file and every file they include, and is only used when all
+ * stamps still match. Strings are interned into a single table; records are
+ * fixed-size and refer to strings by index, so the whole cache is loaded
+ * with one read.
+ */
+class FGTrafficScheduleCache
+{
+public:
+    enum RecordKind : uint8_t {
+        Aircraft = 0,
+        Flight = 1
+    };
+
+    // string slots of an aircraft record
+    enum AircraftString {
+        AcModel = 0,
+        AcLivery,
+        AcHomePort,
+        AcRegistration,
+        AcRequiredAircraft,
+        AcType,
+        AcAirline,
+        AcPerformanceClass,
+        AcFlightType,
+        NumAircraftStrings
+    };
+
+    // string slots of a flight record
+    enum FlightString {
+        FlCallsign = 0,
+        FlRules,
+        FlDeparturePort,
+        FlArrivalPort,
+        FlDepartureTime,
+        FlArrivalTime,
+        FlRepeat,
+        FlRequiredAircraft,
+        NumFlightStrings
+    };
+
+    struct Record {
+        uint8_t kind;
+        uint8_t heavy;
+        int32_t cruiseAlt;
+        double radius;
+        double offset;
+        uint32_t strings[NumAircraftStrings];
+    };
+
+    /**
+     * @param trafficDir the traffic directory the cache is for; the cache
+     * file name is derived from it
+     */
+    explicit FGTrafficScheduleCache(const SGPath& trafficDir);
+
+    /// register a traffic XML file found in the directory
+    void addSourceFile(const SGPath& path);
+    /// register a file pulled in through an include attribute
+    void addDependency(const SGPath& path);
+
+    /**
+     * Load the cache file. Fails if it does not exist, has another format
+     * version, or if any source file or dependency changed.
+     */
+    bool load();
+    bool save() const;
+
+    void clearRecords();
+    void addAircraft(const std::string strings[NumAircraftStrings], bool heavy, double radius, double offset);
+    void addFlight(const std::string strings[NumFlightStrings], int cruiseAlt);
+
+    const std::vector<Record>& records() const { return _records; }
+    const std::string& stringAt(uint32_t id) const { return _strings[id]; }
+
+    const SGPath& cachePath() const { return _cachePath; }
+
+private:
+    struct FileStamp {
+        std::string path;
+        int64_t modTime;
+        int64_t size;
+
+        bool operator==(const FileStamp& other) const
+        {
+            return (path == other.path) && (modTime == other.modTime) && (size == other.size);
+        }
+    };
+
+    static FileStamp stampFor(const SGPath& path);
+    uint32_t intern(const std::string& s);
+
+    SGPath _cachePath;
+    std::vector<FileStamp> _sources;
+    std::vector<FileStamp> _dependencies;
+
+    std::vector<std::string> _strings;
+    std::unordered_map<std::string, uint32_t> _stringIds;
+    std::vector<Record> _records;
+};
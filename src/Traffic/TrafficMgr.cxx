@@ -45,6 +45,7 @@
 #include <cstring>
 #include <iostream>
 #include <fstream>
+#include <map>
 #include <mutex>
 
 
@@ -62,6 +63,7 @@
 #include <simgear/structure/subsystem_mgr.hxx>
 #include <simgear/threads/SGThread.hxx>
 #include <simgear/timing/sg_time.hxx>
+#include <simgear/timing/timestamp.hxx>
 
 #include <simgear/xml/easyxml.hxx>
 #include <simgear/scene/tsync/terrasync.hxx>
@@ -77,6 +79,7 @@
 #include <Main/fg_props.hxx>
 #include <Main/sentryIntegration.hxx>
 
+#include "ScheduleCache.hxx"
 #include "TrafficMgr.hxx"
 
 using std::sort;
@@ -100,7 +103,9 @@ public:
     acCounter(0),
     radius(0),
     offset(0),
-    heavy(false)
+    heavy(false),
+    _recordCache(nullptr),
+    _parseFailed(false)
   {
 
   }
@@ -142,6 +147,49 @@ public:
     _isFinished = true;
   }
 
+    /**
+     * Parse traffic XML files, or replay their records from the cache
+     * belonging to cacheKey when none of the files changed since.
+     */
+    void parseFiles(const SGPath& cacheKey, const simgear::PathList& trafficFiles)
+    {
+        FGTrafficScheduleCache cache(cacheKey);
+        for (const auto& xml : trafficFiles) {
+            cache.addSourceFile(xml);
+        }
+
+        if (cache.load()) {
+            SG_LOG(SG_AI, SG_DEBUG, "using cached traffic schedules for " << cacheKey);
+            replayCache(cache);
+            return;
+        }
+
+        cache.clearRecords();
+        _recordCache = &cache;
+        _parseFailed = false;
+        for (const auto& xml : trafficFiles) {
+            _currentFile = xml;
+            try {
+                readXML(xml, *this);
+                if (_cancelThread) {
+                    _recordCache = nullptr;
+                    return;
+                }
+            } catch (sg_exception& e) {
+                _parseFailed = true;
+                simgear::reportFailure(simgear::LoadFailure::BadData, simgear::ErrorCode::AITrafficSchedule,
+                                       "XML errors parsing traffic:" + e.getFormattedMessage(), xml);
+            }
+        }
+        _recordCache = nullptr;
+
+        // don't cache broken data: the errors should be reported again
+        // on the next launch, until the files are fixed
+        if (!_parseFailed) {
+            cache.save();
+        }
+    }
+
     void startXML()
     {
         //cout << "Start XML" << endl;
@@ -168,6 +216,9 @@ public:
             SGPath path = globals->get_fg_root();
             path.append("/Traffic/");
             path.append(attval);
+            if (_recordCache) {
+                _recordCache->addDependency(path);
+            }
             readXML(path, *this);
         }
         elementValueStack.push_back("");
@@ -225,59 +276,7 @@ public:
         } else if (!strcmp(name, "repeat"))
             repeat = value;
         else if (!strcmp(name, "flight")) {
-            // We have loaded and parsed all the information belonging to this flight
-            // so we temporarily store it.
-            //cerr << "Pushing back flight " << callsign << endl;
-            //cerr << callsign  <<  " " << fltrules     << " "<< departurePort << " " <<  arrivalPort << " "
-            //   << cruiseAlt <<  " " << departureTime<< " "<< arrivalTime   << " " << repeat << endl;
-
-            //Prioritize aircraft
-            // string apt = fgGetString("/sim/presets/airport-id");
-            // cerr << "Airport information: " << apt << " " << departurePort << " " << arrivalPort << endl;
-            // if (departurePort == apt) score++;
-            // flights.push_back(new FGScheduledFlight(callsign,
-            //                                fltrules,
-            //                                departurePort,
-            //                                arrivalPort,
-            //                                cruiseAlt,
-            //                                departureTime,
-            //                                arrivalTime,
-            //                                repeat));
-
-            if (requiredAircraft == "") {
-                char buffer[16];
-                snprintf(buffer, 16, "%d", acCounter);
-                requiredAircraft = buffer;
-            }
-            SG_LOG(SG_AI, SG_BULK, "Adding flight: " << callsign << " "
-                   << fltrules << " "
-                   << departurePort << " "
-                   << arrivalPort << " "
-                   << cruiseAlt << " "
-                   << departureTime << " "
-                   << arrivalTime << " " << repeat << " " << requiredAircraft);
-            // For database maintenance purposes, it may be convenient to
-            //
-            if (fgGetBool("/sim/traffic-manager/dumpdata") == true) {
-                SG_LOG(SG_AI, SG_ALERT, "Traffic Dump FLIGHT," << callsign << ","
-                       << fltrules << ","
-                       << departurePort << ","
-                       << arrivalPort << ","
-                       << cruiseAlt << ","
-                       << departureTime << ","
-                       << arrivalTime << "," << repeat << "," << requiredAircraft);
-            }
-
-            _trafficManager->flights[requiredAircraft].push_back(new FGScheduledFlight(callsign,
-                                                                      fltrules,
-                                                                      departurePort,
-                                                                      arrivalPort,
-                                                                      cruiseAlt,
-                                                                      departureTime,
-                                                                      arrivalTime,
-                                                                      repeat,
-                                                                      requiredAircraft));
-            requiredAircraft = "";
+            endFlight();
         } else if (!strcmp(name, "aircraft")) {
             endAircraft();
         }
@@ -311,10 +310,64 @@ public:
     }
 
 private:
+    void endFlight()
+    {
+        if (_recordCache) {
+            const string strings[FGTrafficScheduleCache::NumFlightStrings] = {
+                callsign, fltrules, departurePort, arrivalPort,
+                departureTime, arrivalTime, repeat, requiredAircraft};
+            _recordCache->addFlight(strings, cruiseAlt);
+        }
+
+        if (requiredAircraft == "") {
+            char buffer[16];
+            snprintf(buffer, 16, "%d", acCounter);
+            requiredAircraft = buffer;
+        }
+        SG_LOG(SG_AI, SG_BULK, "Adding flight: " << callsign << " "
+               << fltrules << " "
+               << departurePort << " "
+               << arrivalPort << " "
+               << cruiseAlt << " "
+               << departureTime << " "
+               << arrivalTime << " " << repeat << " " << requiredAircraft);
+        // For database maintenance purposes, it may be convenient to
+        //
+        if (fgGetBool("/sim/traffic-manager/dumpdata") == true) {
+            SG_LOG(SG_AI, SG_ALERT, "Traffic Dump FLIGHT," << callsign << ","
+                   << fltrules << ","
+                   << departurePort << ","
+                   << arrivalPort << ","
+                   << cruiseAlt << ","
+                   << departureTime << ","
+                   << arrivalTime << "," << repeat << "," << requiredAircraft);
+        }
+
+        _trafficManager->flights[requiredAircraft].push_back(new FGScheduledFlight(callsign,
+                                                                  fltrules,
+                                                                  departurePort,
+                                                                  arrivalPort,
+                                                                  cruiseAlt,
+                                                                  departureTime,
+                                                                  arrivalTime,
+                                                                  repeat,
+                                                                  requiredAircraft));
+        requiredAircraft = "";
+    }
+
     void endAircraft()
     {
         string isHeavy = heavy ? "true" : "false";
 
+        if (_recordCache) {
+            // the home port fallback depends on the parse order, so store
+            // it already resolved
+            const string strings[FGTrafficScheduleCache::NumAircraftStrings] = {
+                mdl, livery, homePort.empty() ? departurePort : homePort,
+                registration, requiredAircraft, acType, airline, m_class, flighttype};
+            _recordCache->addAircraft(strings, heavy, radius, offset);
+        }
+
         if (missingModels.find(mdl) != missingModels.end()) {
             // don't stat() or warn again
             requiredAircraft = homePort = "";
@@ -379,28 +432,63 @@ private:
 
         simgear::Dir trafficDir(path);
         simgear::PathList d = trafficDir.children(simgear::Dir::TYPE_DIR | simgear::Dir::NO_DOT_OR_DOTDOT);
+        // a fixed order keeps the cache valid across directory listings
+        auto byPath = [](const SGPath& a, const SGPath& b) { return a.utf8Str() < b.utf8Str(); };
+        std::sort(d.begin(), d.end(), byPath);
 
         simgear::ErrorReportContext("ai-traffic-dir", path.utf8Str());
 
+        simgear::PathList trafficFiles;
         for (const auto& p : d) {
-            simgear::Dir d2(p);
-            SG_LOG(SG_AI, SG_DEBUG, "parsing traffic in:" << p);
-            simgear::PathList trafficFiles = d2.children(simgear::Dir::TYPE_FILE, ".xml");
-            for (const auto& xml : trafficFiles) {
-                _currentFile = xml;
-                try {
-                    readXML(xml, *this);
-                    if (_cancelThread) {
-                        return;
-                    }
-                } catch (sg_exception& e) {
-                    simgear::reportFailure(simgear::LoadFailure::BadData, simgear::ErrorCode::AITrafficSchedule,
-                                           "XML errors parsing traffic:" + e.getFormattedMessage(), xml);
-                }
+            simgear::PathList files = simgear::Dir(p).children(simgear::Dir::TYPE_FILE, ".xml");
+            std::sort(files.begin(), files.end(), byPath);
+            trafficFiles.insert(trafficFiles.end(), files.begin(), files.end());
+        }
+
+        parseFiles(path, trafficFiles);
+        SG_LOG(SG_AI, SG_INFO, "reading traffic schedules took:" << st.elapsedMSec() << "msec");
+    }
+
+    /**
+     * Feed the cached records through the same end-of-element logic the
+     * XML parser uses, so filtering and id assignment behave identically.
+     */
+    void replayCache(const FGTrafficScheduleCache& cache)
+    {
+        typedef FGTrafficScheduleCache C;
+        _currentFile = cache.cachePath();
+        for (const auto& r : cache.records()) {
+            if (_cancelThread) {
+                return;
             }
-        } // of sub-directories iteration
 
-        SG_LOG(SG_AI, SG_INFO, "parsing traffic schedules took:" << st.elapsedMSec() << "msec");
+            if (r.kind == C::Flight) {
+                callsign = cache.stringAt(r.strings[C::FlCallsign]);
+                fltrules = cache.stringAt(r.strings[C::FlRules]);
+                departurePort = cache.stringAt(r.strings[C::FlDeparturePort]);
+                arrivalPort = cache.stringAt(r.strings[C::FlArrivalPort]);
+                departureTime = cache.stringAt(r.strings[C::FlDepartureTime]);
+                arrivalTime = cache.stringAt(r.strings[C::FlArrivalTime]);
+                repeat = cache.stringAt(r.strings[C::FlRepeat]);
+                requiredAircraft = cache.stringAt(r.strings[C::FlRequiredAircraft]);
+                cruiseAlt = r.cruiseAlt;
+                endFlight();
+            } else {
+                mdl = cache.stringAt(r.strings[C::AcModel]);
+                livery = cache.stringAt(r.strings[C::AcLivery]);
+                homePort = cache.stringAt(r.strings[C::AcHomePort]);
+                registration = cache.stringAt(r.strings[C::AcRegistration]);
+                requiredAircraft = cache.stringAt(r.strings[C::AcRequiredAircraft]);
+                acType = cache.stringAt(r.strings[C::AcType]);
+                airline = cache.stringAt(r.strings[C::AcAirline]);
+                m_class = cache.stringAt(r.strings[C::AcPerformanceClass]);
+                flighttype = cache.stringAt(r.strings[C::AcFlightType]);
+                heavy = (r.heavy != 0);
+                radius = r.radius;
+                offset = r.offset;
+                endAircraft();
+            }
+        }
     }
 
   FGTrafficManager* _trafficManager;
@@ -425,6 +513,10 @@ private:
   double radius, offset;
   bool heavy;
 
+  // non-null while parsing XML: every record is also stored in the cache
+  FGTrafficScheduleCache* _recordCache;
+  bool _parseFailed;
+
 };
 
 /******************************************************************************
@@ -440,7 +532,8 @@ FGTrafficManager::FGTrafficManager() :
   realWxEnabled("/environment/realwx/enabled"),
   metarValid("/environment/metar/valid"),
   active("/sim/traffic-manager/active"),
-  aiDataUpdateNow("/sim/terrasync/ai-data-update-now")
+  aiDataUpdateNow("/sim/terrasync/ai-data-update-now"),
+  updateBudgetMs("/sim/traffic-manager/update-budget-ms")
 {
 }
 
@@ -505,6 +598,9 @@ void FGTrafficManager::shutdown()
         cachefile.close();
     }
     scheduledAircraft.clear();
+    scheduleQueue = decltype(scheduleQueue)();
+    scheduleDue.clear();
+    schedulesByHomePort.clear();
 
     for (auto flight : flights) {
         for (auto scheduled : flight.second)
@@ -590,7 +686,7 @@ void FGTrafficManager::init()
                 // use a SchedulerParser to parse, but run it in this thread,
                 // i.e don't start it
                 ScheduleParseThread parser(this);
-                readXML(path, parser);
+                parser.parseFiles(path, {path});
             }
         } else if (path.extension() == "conf") {
             if (path.exists()) {
@@ -625,6 +721,7 @@ void FGTrafficManager::finishInit()
     sort(scheduledAircraft.begin(), scheduledAircraft.end(), FGAISchedule::compareSchedules);
     currAircraft = scheduledAircraft.begin();
     currAircraftClosest = scheduledAircraft.begin();
+    initScheduleQueue();
 
     doingInit = false;
     inited = true;
@@ -755,35 +852,178 @@ void FGTrafficManager::update(double dt)
     }
 
     SGVec3d userCart = globals->get_aircraft_position_cart();
+    time_t now = globals->get_time_params()->get_cur_time();
 
-    if (currAircraft == scheduledAircraft.end()) {
-        currAircraft = scheduledAircraft.begin();
+    // a large jump in position means the user relocated, and a jump of the
+    // time of day (backwards, or further than any schedule is deferred)
+    // leaves the due times meaningless: everything needs to be looked at
+    // again, nearby schedules first
+    const double relocationDistanceNm = 20.0;
+    const bool relocated = dist(userCart, lastUserCart) * SG_METER_TO_NM > relocationDistanceNm;
+    const bool timeJumped = (now < lastUpdateTime) ||
+                            (now - lastUpdateTime > MAX_SCHEDULE_DELAY_SEC);
+    if (relocated || timeJumped) {
+        expediteAllSchedules(globals->get_aircraft_position(), now);
     }
+    lastUserCart = userCart;
+    lastUpdateTime = now;
 
-    time_t now = globals->get_time_params()->get_cur_time();
+    double budgetMs = updateBudgetMs;
+    if (budgetMs <= 0.0) {
+        budgetMs = 2.0;
+    }
+
+    // evaluate due schedules until the budget is used up, but always at
+    // least one per frame
+    SGTimeStamp st;
+    st.stamp();
+    std::vector<size_t> unfinished;
+    while (!scheduleQueue.empty() && (scheduleQueue.top().first <= now)) {
+        const ScheduleQueueEntry entry = scheduleQueue.top();
+        scheduleQueue.pop();
+        if (entry.first != scheduleDue[entry.second]) {
+            continue; // stale entry, the schedule was re-queued since
+        }
+        scheduleDue[entry.second] = NOT_QUEUED;
+
+        //cerr << "Processing << " << scheduledAircraft[entry.second]->getRegistration() << endl;
+        if (scheduledAircraft[entry.second]->update(now, userCart)) {
+            rescheduleAfterUpdate(entry.second, now);
+        } else {
+            // not ready yet, continue processing in the next frame
+            unfinished.push_back(entry.second);
+        }
+
+        if (st.elapsedUSec() >= budgetMs * 1000.0) {
+            break;
+        }
+    }
+
+    for (size_t i : unfinished) {
+        setScheduleDue(i, now);
+    }
+}
+
+void FGTrafficManager::initScheduleQueue()
+{
+    scheduleQueue = decltype(scheduleQueue)();
+    scheduleDue.assign(scheduledAircraft.size(), NOT_QUEUED);
+    schedulesByHomePort.clear();
 
-    //cerr << "Processing << " << (*currAircraft)->getRegistration() << " with score " << (*currAircraft)->getScore() << endl;
-    if ((*currAircraft)->update(now, userCart)) {
-        // schedule is done - process another aircraft in next iteration
-        ++currAircraft;
+    // everything is due immediately, in order of score
+    for (size_t i = 0; i < scheduledAircraft.size(); ++i) {
+        setScheduleDue(i, 0);
+    }
+
+    std::map<std::string, FGAirport*> homePorts;
+    for (size_t i = 0; i < scheduledAircraft.size(); ++i) {
+        const std::string& ident = scheduledAircraft[i]->getHomePort();
+        auto it = homePorts.find(ident);
+        if (it == homePorts.end()) {
+            it = homePorts.insert(std::make_pair(ident, FGAirport::findByIdent(ident).ptr())).first;
+        }
+
+        if (it->second) {
+            schedulesByHomePort[it->second].push_back(i);
+        }
+    }
+
+    lastUserCart = globals->get_aircraft_position_cart();
+    lastUpdateTime = globals->get_time_params()->get_cur_time();
+}
+
+time_t FGTrafficManager::getNextScheduleDue() const
+{
+    time_t next = NOT_QUEUED;
+    for (time_t due : scheduleDue) {
+        if ((due != NOT_QUEUED) && ((next == NOT_QUEUED) || (due < next))) {
+            next = due;
+        }
+    }
+    return next;
+}
+
+void FGTrafficManager::setScheduleDue(size_t index, time_t due)
+{
+    if (scheduleDue[index] == due) {
+        return; // already queued for that time
+    }
+
+    scheduleDue[index] = due;
+    scheduleQueue.push(ScheduleQueueEntry(due, index));
+}
+
+void FGTrafficManager::rescheduleAfterUpdate(size_t index, time_t now)
+{
+    // Until it is within TRAFFIC_TO_AI_DIST_TO_START of the user, a schedule
+    // cannot spawn an aircraft, and the gap can close at most at the combined
+    // speed of the user and the traffic. Re-check once it could possibly be
+    // in range, but at least every few seconds (aircraft in AI mode need to
+    // notice when they are removed) and at most every few minutes.
+    const double closingSpeedNmPerSec = 1200.0 / 3600.0;
+    const double minDelaySec = 5.0;
+
+    FGAISchedule* schedule = scheduledAircraft[index];
+    double delay;
+    if (schedule->isDistanceUpdated()) {
+        const double gapNm = schedule->getDistanceToUser() - TRAFFIC_TO_AI_DIST_TO_START;
+        delay = gapNm / closingSpeedNmPerSec;
+    } else if (schedule->isAIMode()) {
+        delay = minDelaySec;
+    } else {
+        // update() returned before positioning the aircraft: it has no
+        // flights, or just dropped one which was in the past. Nothing
+        // changes before the next departure.
+        const time_t departure = schedule->getDepartureTime();
+        delay = departure ? static_cast<double>(departure - now) : MAX_SCHEDULE_DELAY_SEC;
+    }
+    delay = SGMiscd::clip(delay, minDelaySec, MAX_SCHEDULE_DELAY_SEC);
+    setScheduleDue(index, now + static_cast<time_t>(delay));
+}
+
+void FGTrafficManager::expediteAllSchedules(const SGGeod& userPos, time_t now)
+{
+    SG_LOG(SG_AI, SG_DEBUG, "Traffic manager: user relocated or time jumped, re-evaluating all schedules");
+
+    for (size_t i = 0; i < scheduledAircraft.size(); ++i) {
+        setScheduleDue(i, now);
+    }
+
+    // schedules based at airports around the new position jump the queue
+    FGAirport::AirportFilter filter;
+    FGPositionedList nearby = FGPositioned::findWithinRange(userPos, TRAFFIC_TO_AI_DIST_TO_START, &filter);
+    for (const auto& pos : nearby) {
+        auto it = schedulesByHomePort.find(static_cast<FGAirport*>(pos.ptr()));
+        if (it == schedulesByHomePort.end()) {
+            continue;
+        }
+
+        for (size_t i : it->second) {
+            setScheduleDue(i, now - 1);
+        }
     }
 }
 
 void FGTrafficManager::readTimeTableFromFile(SGPath infileName)
 {
-    string model;
-    string livery;
-    string homePort;
-    string registration;
-    string flightReq;
-    bool   isHeavy;
-    string acType;
-    string airline;
-    string m_class;
-    string FlightType;
-    double radius;
-    double offset;
+    // the timetable is cached like the XML traffic, and only parsed again
+    // when the file changes
+    FGTrafficScheduleCache cache(infileName);
+    cache.addSourceFile(infileName);
+    if (!cache.load()) {
+        cache.clearRecords();
+        parseTimeTable(infileName, cache);
+        cache.save();
+    } else {
+        SG_LOG(SG_AI, SG_DEBUG, "using cached traffic schedules for " << infileName);
+    }
 
+    addTimeTable(infileName, cache);
+}
+
+void FGTrafficManager::parseTimeTable(const SGPath& infileName, FGTrafficScheduleCache& cache)
+{
+    typedef FGTrafficScheduleCache C;
     char buffer[256];
     vector <string> tokens, depTime,arrTime;
 
@@ -807,40 +1047,20 @@ void FGTrafficManager::readTimeTableFromFile(SGPath infileName)
                      throw sg_io_exception("Error parsing traffic file @ " + buffString, infileName);
                  }
 
-                 model          = tokens[12];
-                 livery         = tokens[6];
-                 homePort       = tokens[1];
-                 registration   = tokens[2];
-                 if (tokens[11] == string("false")) {
-                     isHeavy = false;
-                 } else {
-                     isHeavy = true;
-                 }
-                 acType         = tokens[4];
-                 airline        = tokens[5];
-                 flightReq      = tokens[3] + tokens[5];
-                 m_class        = tokens[10];
-                 FlightType     = tokens[9];
-                 radius         = atof(tokens[8].c_str());
-                 offset         = atof(tokens[7].c_str());;
-
-                 if (!FGAISchedule::validModelPath(model)) {
-                     simgear::reportFailure(simgear::LoadFailure::NotFound, simgear::ErrorCode::AITrafficSchedule, "Missing traffic model path:" + model, infileName);
-                 } else {
-                     SG_LOG(SG_AI, SG_DEBUG, "Adding Aircraft" << model << " " << livery << " " << homePort << " " << registration << " " << flightReq << " " << isHeavy << " " << acType << " " << airline << " " << m_class << " " << FlightType << " " << radius << " " << offset);
-                     scheduledAircraft.push_back(new FGAISchedule(model,
-                                                                  livery,
-                                                                  homePort,
-                                                                  registration,
-                                                                  flightReq,
-                                                                  isHeavy,
-                                                                  acType,
-                                                                  airline,
-                                                                  m_class,
-                                                                  FlightType,
-                                                                  radius,
-                                                                  offset));
-                 } // of valid model path
+                 string strings[C::NumAircraftStrings];
+                 strings[C::AcModel]            = tokens[12];
+                 strings[C::AcLivery]           = tokens[6];
+                 strings[C::AcHomePort]         = tokens[1];
+                 strings[C::AcRegistration]     = tokens[2];
+                 strings[C::AcType]             = tokens[4];
+                 strings[C::AcAirline]          = tokens[5];
+                 strings[C::AcRequiredAircraft] = tokens[3] + tokens[5];
+                 strings[C::AcPerformanceClass] = tokens[10];
+                 strings[C::AcFlightType]       = tokens[9];
+                 const bool isHeavy = (tokens[11] != string("false"));
+                 const double radius = atof(tokens[8].c_str());
+                 const double offset = atof(tokens[7].c_str());
+                 cache.addAircraft(strings, isHeavy, radius, offset);
              }
              if (tokens[0] == string("FLIGHT")) {
                  //cerr << "Found flight " << buffString << " size is : " << tokens.size() << endl;
@@ -892,25 +1112,11 @@ void FGTrafficManager::readTimeTableFromFile(SGPath infileName)
                              snprintf(l_buffer, 4, "%d/", 0);
                              arrivalTime   = string(l_buffer) + arrTimeGen  + string(":00");
                          }
-                         SG_LOG(SG_AI, SG_ALERT, "Adding flight " << callsign       << " "
-                                                      << fltrules       << " "
-                                                      <<  departurePort << " "
-                                                      <<  arrivalPort   << " "
-                                                      <<  cruiseAlt     << " "
-                                                      <<  departureTime << " "
-                                                      <<  arrivalTime   << " "
-                                                      << repeat        << " "
-                                                      <<  requiredAircraft);
-
-                         flights[requiredAircraft].push_back(new FGScheduledFlight(callsign,
-                                                                 fltrules,
-                                                                 departurePort,
-                                                                 arrivalPort,
-                                                                 cruiseAlt,
-                                                                 departureTime,
-                                                                 arrivalTime,
-                                                                 repeat,
-                                                                 requiredAircraft));
+
+                         const string strings[C::NumFlightStrings] = {
+                             callsign, fltrules, departurePort, arrivalPort,
+                             departureTime, arrivalTime, repeat, requiredAircraft};
+                         cache.addFlight(strings, cruiseAlt);
                     }
                 }
              }
@@ -920,6 +1126,55 @@ void FGTrafficManager::readTimeTableFromFile(SGPath infileName)
     //exit(1);
 }
 
+void FGTrafficManager::addTimeTable(const SGPath& infileName, const FGTrafficScheduleCache& cache)
+{
+    typedef FGTrafficScheduleCache C;
+    for (const auto& r : cache.records()) {
+        if (r.kind == C::Aircraft) {
+            const string& model = cache.stringAt(r.strings[C::AcModel]);
+            if (!FGAISchedule::validModelPath(model)) {
+                simgear::reportFailure(simgear::LoadFailure::NotFound, simgear::ErrorCode::AITrafficSchedule, "Missing traffic model path:" + model, infileName);
+                continue;
+            }
+
+            SG_LOG(SG_AI, SG_DEBUG, "Adding Aircraft" << model << " " << cache.stringAt(r.strings[C::AcRegistration]));
+            scheduledAircraft.push_back(new FGAISchedule(model,
+                                                         cache.stringAt(r.strings[C::AcLivery]),
+                                                         cache.stringAt(r.strings[C::AcHomePort]),
+                                                         cache.stringAt(r.strings[C::AcRegistration]),
+                                                         cache.stringAt(r.strings[C::AcRequiredAircraft]),
+                                                         r.heavy != 0,
+                                                         cache.stringAt(r.strings[C::AcType]),
+                                                         cache.stringAt(r.strings[C::AcAirline]),
+                                                         cache.stringAt(r.strings[C::AcPerformanceClass]),
+                                                         cache.stringAt(r.strings[C::AcFlightType]),
+                                                         r.radius,
+                                                         r.offset));
+        } else {
+            const string& requiredAircraft = cache.stringAt(r.strings[C::FlRequiredAircraft]);
+            SG_LOG(SG_AI, SG_ALERT, "Adding flight " << cache.stringAt(r.strings[C::FlCallsign]) << " "
+                                         << cache.stringAt(r.strings[C::FlRules]) << " "
+                                         << cache.stringAt(r.strings[C::FlDeparturePort]) << " "
+                                         << cache.stringAt(r.strings[C::FlArrivalPort]) << " "
+                                         << r.cruiseAlt << " "
+                                         << cache.stringAt(r.strings[C::FlDepartureTime]) << " "
+                                         << cache.stringAt(r.strings[C::FlArrivalTime]) << " "
+                                         << cache.stringAt(r.strings[C::FlRepeat]) << " "
+                                         << requiredAircraft);
+
+            flights[requiredAircraft].push_back(new FGScheduledFlight(cache.stringAt(r.strings[C::FlCallsign]),
+                                                    cache.stringAt(r.strings[C::FlRules]),
+                                                    cache.stringAt(r.strings[C::FlDeparturePort]),
+                                                    cache.stringAt(r.strings[C::FlArrivalPort]),
+                                                    r.cruiseAlt,
+                                                    cache.stringAt(r.strings[C::FlDepartureTime]),
+                                                    cache.stringAt(r.strings[C::FlArrivalTime]),
+                                                    cache.stringAt(r.strings[C::FlRepeat]),
+                                                    requiredAircraft));
+        }
+    }
+}
+
 
 void FGTrafficManager::Tokenize(const string& str,
                       vector<string>& tokens,
@@ -47,6 +47,10 @@
 
 #include <set>
 #include <memory>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <simgear/structure/subsystem_mgr.hxx>
 #include <simgear/props/propertyObject.hxx>
@@ -73,6 +77,7 @@ typedef HeuristicMap::iterator             HeuristicMapIterator;
 
 
 class ScheduleParseThread;
+class FGTrafficScheduleCache;
 
 class FGTrafficManager : public SGSubsystem
 {
@@ -87,12 +92,37 @@ private:
     ScheduleVector scheduledAircraft;
     ScheduleVectorIterator currAircraft, currAircraftClosest;
 
+    // Schedules are evaluated in order of the (simulation) time at which
+    // they are next due, within a per-frame time budget. Distant schedules
+    // are pushed back in proportion to their distance from the user; when
+    // the user relocates or the time of day jumps, everything is made due
+    // again, the schedules based around the user's position first. Entries
+    // in the queue whose time no longer matches scheduleDue[] are stale and
+    // skipped.
+    typedef std::pair<time_t, size_t> ScheduleQueueEntry;
+    std::priority_queue<ScheduleQueueEntry, std::vector<ScheduleQueueEntry>,
+                        std::greater<ScheduleQueueEntry> > scheduleQueue;
+    std::vector<time_t> scheduleDue;
+    static constexpr time_t NOT_QUEUED = -1;
+    static constexpr double MAX_SCHEDULE_DELAY_SEC = 300.0;
+    std::unordered_map<const FGAirport*, std::vector<size_t> > schedulesByHomePort;
+    SGVec3d lastUserCart;
+    time_t lastUpdateTime = 0;
+
+    void initScheduleQueue();
+    void setScheduleDue(size_t index, time_t due);
+    void rescheduleAfterUpdate(size_t index, time_t now);
+    void expediteAllSchedules(const SGGeod& userPos, time_t now);
+
     FGScheduledFlightMap flights;
 
     void readTimeTableFromFile(SGPath infilename);
+    void parseTimeTable(const SGPath& infileName, FGTrafficScheduleCache& cache);
+    void addTimeTable(const SGPath& infileName, const FGTrafficScheduleCache& cache);
     void Tokenize(const std::string& str, std::vector<std::string>& tokens, const std::string& delimiters = " ");
 
     simgear::PropertyObject<bool> enabled, aiEnabled, realWxEnabled, metarValid, active, aiDataUpdateNow;
+    simgear::PropertyObject<double> updateBudgetMs;
 
     void loadHeuristics();
 
@@ -123,4 +153,8 @@ public:
 
     FGScheduledFlightVecIterator getFirstFlight(const std::string &ref) { return flights[ref].begin(); }
     FGScheduledFlightVecIterator getLastFlight(const std::string &ref) { return flights[ref].end(); }
+
+    // earliest time at which a schedule is due to be evaluated, or -1 if
+    // none is queued
+    time_t getNextScheduleDue() const;
 };
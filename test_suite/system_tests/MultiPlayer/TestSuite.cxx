@@ -0,0 +1,11 @@
+/*
+ * SPDX-FileName: TestSuite.cxx
+ * SPDX-FileComment: multiplayer system test registration
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "test_mpLoad.hxx"
+
+
+// Set up the system tests.
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(MPLoadTests, "System tests");
@@ -0,0 +1,282 @@
+/*
+ * SPDX-FileName: test_mpLoad.cxx
+ * SPDX-FileComment: multiplayer receive path under synthetic load
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_mpLoad.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/io/raw_socket.hxx>
+#include <simgear/timing/timestamp.hxx>
+
+#include <AIModel/AIManager.hxx>
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
+#include <MultiPlayer/MPLoadGenerator.hxx>
+#include <MultiPlayer/multiplaymgr.hxx>
+
+namespace {
+
+// picked per test, so parallel runs don't clash
+int rxPort = 0;
+// nobody listens there; our own position messages are simply lost
+int txPort = 0;
+
+const double TICK_SEC = 1.0 / 30.0;
+const double RUN_SEC = 4.0;
+
+// resident set size in bytes, or 0 where we don't know how to get it
+size_t residentBytes()
+{
+#if defined(__linux__)
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (!f) {
+        return 0;
+    }
+    unsigned long size = 0, resident = 0;
+    const int n = fscanf(f, "%lu %lu", &size, &resident);
+    fclose(f);
+    return (n == 2) ? resident * sysconf(_SC_PAGESIZE) : 0;
+#else
+    return 0;
+#endif
+}
+
+size_t multiplayerCount()
+{
+    SGPropertyNode* models = fgGetNode("/ai/models", true);
+    return models->getChildren("multiplayer").size();
+}
+
+// a UDP port nobody uses right now: the one the system picks for port 0
+int freeUdpPort()
+{
+    simgear::Socket socket;
+    if (!socket.open(false) || (socket.bind("127.0.0.1", 0) != 0)) {
+        return 0;
+    }
+    sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    if (getsockname(socket.getHandle(), reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+// Let the receive thread finish decoding what was sent, however slow the
+// machine: wait until the decoded count stops growing, for at most 10 seconds.
+void drainReceived(FGMultiplayMgr* mp)
+{
+    int decoded = -1;
+    for (int i = 0; i < 100; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        mp->update(0.0);
+        const int now = fgGetInt("/sim/multiplay/rx-decoded-packets");
+        if (now == decoded) {
+            return;
+        }
+        decoded = now;
+    }
+}
+
+} // of anonymous namespace
+
+void MPLoadTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("mpload");
+
+    rxPort = freeUdpPort();
+    do {
+        txPort = freeUdpPort();
+    } while (txPort == rxPort);
+    CPPUNIT_ASSERT(rxPort > 0);
+    CPPUNIT_ASSERT(txPort > 0);
+
+    fgSetBool("/sim/ai/enabled", true);
+    fgSetString("/sim/multiplay/callsign", "BENCH");
+    fgSetString("/sim/multiplay/rxhost", "127.0.0.1");
+    fgSetInt("/sim/multiplay/rxport", rxPort);
+    fgSetString("/sim/multiplay/txhost", "127.0.0.1");
+    fgSetInt("/sim/multiplay/txport", txPort);
+
+    globals->get_subsystem_mgr()->add<FGAIManager>();
+    globals->get_subsystem_mgr()->add<FGMultiplayMgr>();
+
+    globals->get_subsystem_mgr()->bind();
+    globals->get_subsystem_mgr()->init();
+    globals->get_subsystem_mgr()->postinit();
+}
+
+void MPLoadTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+// Drive FGMultiplayMgr with an increasing number of synthetic pilots over
+// loopback, and report where the time and memory go.
+void MPLoadTests::testScaling()
+{
+    CPPUNIT_ASSERT(fgGetBool("/sim/multiplay/online"));
+
+    auto mp = globals->get_subsystem<FGMultiplayMgr>();
+    auto aim = globals->get_subsystem<FGAIManager>();
+    CPPUNIT_ASSERT(mp);
+    CPPUNIT_ASSERT(aim);
+
+    // measure the full decode of every peer
+    fgSetDouble("/sim/multiplay/lod-full-detail-range-nm", 0.0);
+    fgSetBool("/sim/multiplay/rx-decode-timing", true);
+
+    simgear::Socket socket;
+    CPPUNIT_ASSERT(socket.open(false));
+    socket.setBlocking(false);
+    const std::vector<simgear::IPAddress> destinations{simgear::IPAddress("127.0.0.1", rxPort)};
+
+    std::cout << std::endl
+              << "  peers   msgs/s  decode us/msg  apply us/tick  interp us/tick  KiB/peer" << std::endl;
+
+    double mpTime = 0.0;
+    for (int numPilots : {50, 100, 250, 500}) {
+        MPLoadGenerator::Options options;
+        options.numPilots = numPilots;
+        MPLoadGenerator generator(options);
+
+        const size_t rssBefore = residentBytes();
+        const size_t peersBefore = multiplayerCount();
+        const int decodedBefore = fgGetInt("/sim/multiplay/rx-decoded-packets");
+        const double decodeUSecBefore = fgGetDouble("/sim/multiplay/rx-decode-time-usec");
+
+        int64_t applyUSec = 0, interpUSec = 0;
+        int sent = 0;
+        const int ticks = static_cast<int>(RUN_SEC / TICK_SEC);
+        for (int t = 0; t < ticks; ++t) {
+            mpTime += TICK_SEC;
+            sent += generator.sendDue(mpTime, socket, destinations);
+
+            // give the receive thread a chance to catch up, as the
+            // rendering of a real frame would
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+            globals->inc_sim_time_sec(TICK_SEC);
+
+            SGTimeStamp st;
+            st.stamp();
+            mp->update(TICK_SEC);
+            applyUSec += st.elapsedUSec();
+
+            st.stamp();
+            aim->update(TICK_SEC);
+            interpUSec += st.elapsedUSec();
+        }
+        drainReceived(mp);
+
+        const int decoded = fgGetInt("/sim/multiplay/rx-decoded-packets") - decodedBefore;
+        const double decodeUSec = fgGetDouble("/sim/multiplay/rx-decode-time-usec") - decodeUSecBefore;
+        const size_t peers = multiplayerCount();
+        const size_t newPeers = peers - peersBefore;
+        const size_t rssAfter = residentBytes();
+
+        std::cout << std::setw(7) << peers
+                  << std::setw(9) << static_cast<int>(sent / RUN_SEC)
+                  << std::setw(15) << std::fixed << std::setprecision(2) << (decoded ? decodeUSec / decoded : 0.0)
+                  << std::setw(15) << std::setprecision(0) << static_cast<double>(applyUSec) / ticks
+                  << std::setw(16) << static_cast<double>(interpUSec) / ticks
+                  << std::setw(10) << std::setprecision(1)
+                  << ((newPeers && rssAfter > rssBefore) ? (rssAfter - rssBefore) / 1024.0 / newPeers : 0.0)
+                  << std::endl;
+
+        CPPUNIT_ASSERT(decoded > 0);
+        // UDP over loopback may drop a few packets, but every pilot
+        // sends many times during the run
+        CPPUNIT_ASSERT(peers >= static_cast<size_t>(numPilots) * 9 / 10);
+    }
+
+    std::cout << "  messages dropped by the receive queue: "
+              << fgGetInt("/sim/multiplay/rx-dropped-packets") << std::endl;
+}
+
+// Peers beyond the full detail range only get their position decoded.
+void MPLoadTests::testLevelOfDetail()
+{
+    auto mp = globals->get_subsystem<FGMultiplayMgr>();
+    CPPUNIT_ASSERT(mp);
+
+    simgear::Socket socket;
+    CPPUNIT_ASSERT(socket.open(false));
+    socket.setBlocking(false);
+    const std::vector<simgear::IPAddress> destinations{simgear::IPAddress("127.0.0.1", rxPort)};
+
+    MPLoadGenerator::Options options;
+    options.numPilots = 20;
+    MPLoadGenerator generator(options);
+
+    // send a second of traffic, and return the peer messages decoded
+    // position-only meanwhile
+    double mpTime = 0.0;
+    auto run = [&]() {
+        const int before = fgGetInt("/sim/multiplay/rx-position-only-packets");
+        for (int t = 0; t < 30; ++t) {
+            mpTime += TICK_SEC;
+            generator.sendDue(mpTime, socket, destinations);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            globals->inc_sim_time_sec(TICK_SEC);
+            mp->update(TICK_SEC);
+        }
+        drainReceived(mp);
+        return fgGetInt("/sim/multiplay/rx-position-only-packets") - before;
+    };
+
+    // we look from far away from the pilots circling KSFO
+    fgSetDouble("/sim/current-view/viewer-lon-deg", 10.0);
+    fgSetDouble("/sim/current-view/viewer-lat-deg", 50.0);
+    fgSetDouble("/sim/multiplay/lod-full-detail-range-nm", 60.0);
+    run(); // let the receive thread pick up the range
+    CPPUNIT_ASSERT(run() > 0);
+
+    fgSetDouble("/sim/multiplay/lod-full-detail-range-nm", 0.0);
+    run();
+    CPPUNIT_ASSERT_EQUAL(0, run());
+}
+
+// In delta mode, only the keyframes carry the unchanged properties.
+void MPLoadTests::testDeltaSend()
+{
+    fgSetBool("/sim/multiplay/delta-send", true);
+    fgSetDouble("/sim/multiplay/delta-keyframe-interval-sec", 1.0);
+
+    int minLen = 1 << 30, maxLen = 0;
+    for (int i = 0; i < 30; ++i) {
+        FGTestApi::runForTime(0.1);
+        const int len = fgGetInt("/sim/multiplay/last-xmit-packet-len");
+        minLen = std::min(minLen, len);
+        maxLen = std::max(maxLen, len);
+    }
+
+    CPPUNIT_ASSERT(minLen > 0);
+    CPPUNIT_ASSERT(minLen < maxLen);
+    std::cout << "delta send: keyframe " << maxLen << " bytes, delta " << minLen << " bytes" << std::endl;
+}
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileName: test_mpLoad.hxx
+ * SPDX-FileComment: multiplayer receive path under synthetic load
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The system tests.
+class MPLoadTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(MPLoadTests);
+    CPPUNIT_TEST(testScaling);
+    CPPUNIT_TEST(testLevelOfDetail);
+    CPPUNIT_TEST(testDeltaSend);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testScaling();
+    void testLevelOfDetail();
+    void testDeltaSend();
+};
@@ -30,6 +30,7 @@
 #include <AIModel/AIAircraft.hxx>
 #include <AIModel/AIFlightPlan.hxx>
 #include <AIModel/AIManager.hxx>
+#include <AIModel/AIMultiplayer.hxx>
 
 #include <Airports/airport.hxx>
 #include <Main/fg_props.hxx>
@@ -129,3 +130,117 @@ void AIManagerTests::testAircraftWaypoints()
     std::unique_ptr<FGAIFlightPlan> aiFP(new FGAIFlightPlan);
     ai->setFlightPlan(std::move(aiFP));    
 }
+
+void AIManagerTests::testTrafficSnapshot()
+{
+    auto aim = globals->get_subsystem<FGAIManager>();
+
+    auto eggd = FGAirport::findByIdent("EGGD");
+    FGTestApi::setPositionAndStabilise(eggd->geod());
+
+    // one aircraft 5nm north of the airport, one 50nm north
+    auto addAircraft = [aim, eggd](const std::string& callsign, double distanceNm) {
+        const SGGeod pos = SGGeodesy::direct(eggd->geod(), 0.0, distanceNm * SG_NM_TO_METER);
+        SGPropertyNode_ptr def(new SGPropertyNode);
+        def->setStringValue("type", "aircraft");
+        def->setStringValue("callsign", callsign);
+        def->setDoubleValue("heading", 90.0);
+        def->setDoubleValue("latitude", pos.getLatitudeDeg());
+        def->setDoubleValue("longitude", pos.getLongitudeDeg());
+        def->setDoubleValue("altitude", 6000.0);
+        def->setDoubleValue("speed", 250.0);
+        return aim->addObject(def);
+    };
+
+    auto nearAI = addAircraft("NEAR1", 5.0);
+    auto farAI = addAircraft("FAR1", 50.0);
+    CPPUNIT_ASSERT(nearAI);
+    CPPUNIT_ASSERT(farAI);
+
+    FGTestApi::runForTime(0.5);
+
+    const FGAITrafficSnapshot& traffic = aim->trafficSnapshot();
+    CPPUNIT_ASSERT_EQUAL(size_t{2}, traffic.size());
+
+    const SGVec3d center = SGVec3d::fromGeod(eggd->geod());
+    std::vector<size_t> found;
+    traffic.findWithinRange(center, 10.0, found);
+    CPPUNIT_ASSERT_EQUAL(size_t{1}, found.size());
+    CPPUNIT_ASSERT_EQUAL(std::string{"NEAR1"}, traffic.callsign(found.front()));
+    CPPUNIT_ASSERT_EQUAL(nearAI->getID(), traffic.id(found.front()));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(250.0, traffic.speedKts(found.front()), 1.0);
+
+    found.clear();
+    traffic.findWithinRange(center, 100.0, found);
+    CPPUNIT_ASSERT_EQUAL(size_t{2}, found.size());
+
+    found.clear();
+    traffic.findWithinRange(center, 1.0, found);
+    CPPUNIT_ASSERT(found.empty());
+}
+
+void AIManagerTests::testUpdateTiers()
+{
+    auto aim = globals->get_subsystem<FGAIManager>();
+
+    auto eggd = FGAirport::findByIdent("EGGD");
+    FGTestApi::setPositionAndStabilise(eggd->geod());
+
+    auto addAircraft = [aim, eggd](const std::string& callsign, double distanceNm) {
+        const SGGeod pos = SGGeodesy::direct(eggd->geod(), 0.0, distanceNm * SG_NM_TO_METER);
+        SGPropertyNode_ptr def(new SGPropertyNode);
+        def->setStringValue("type", "aircraft");
+        def->setStringValue("callsign", callsign);
+        def->setDoubleValue("heading", 90.0);
+        def->setDoubleValue("latitude", pos.getLatitudeDeg());
+        def->setDoubleValue("longitude", pos.getLongitudeDeg());
+        def->setDoubleValue("altitude", 6000.0);
+        def->setDoubleValue("speed", 250.0);
+        return aim->addObject(def);
+    };
+
+    // the default tiers: near within 20nm, far beyond 60nm
+    auto nearAI = addAircraft("NEAR1", 5.0);
+    auto midAI = addAircraft("MID1", 40.0);
+    auto farAI = addAircraft("FAR1", 100.0);
+
+    // tiers are measured from the view, not the user aircraft
+    auto setView = [](const SGGeod& pos) {
+        fgSetDouble("/sim/current-view/viewer-lon-deg", pos.getLongitudeDeg());
+        fgSetDouble("/sim/current-view/viewer-lat-deg", pos.getLatitudeDeg());
+        fgSetDouble("/sim/current-view/viewer-elev-ft", 6000.0);
+    };
+    setView(eggd->geod());
+
+    const SGVec3d view = globals->get_view_position_cart();
+    CPPUNIT_ASSERT_EQUAL(0.0, aim->updateIntervalSec(nearAI.get(), view));
+    CPPUNIT_ASSERT_EQUAL(0.1, aim->updateIntervalSec(midAI.get(), view));
+    CPPUNIT_ASSERT_EQUAL(0.5, aim->updateIntervalSec(farAI.get(), view));
+
+    // multiplayer aircraft are updated every frame, wherever they are
+    SGSharedPtr<FGAIMultiplayer> mp = new FGAIMultiplayer;
+    mp->setGeodPos(farAI->getGeodPos());
+    CPPUNIT_ASSERT_EQUAL(0.0, aim->updateIntervalSec(mp.get(), view));
+
+    // skipped time is accumulated until the interval has passed
+    FGTestApi::runForTime(0.05);
+    CPPUNIT_ASSERT_EQUAL(0.0, nearAI->getSkippedUpdateDt());
+    CPPUNIT_ASSERT(midAI->getSkippedUpdateDt() > 0.0);
+    CPPUNIT_ASSERT(farAI->getSkippedUpdateDt() > 0.0);
+
+    FGTestApi::runForTime(1.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, nearAI->getSkippedUpdateDt());
+    CPPUNIT_ASSERT(midAI->getSkippedUpdateDt() < 0.1);
+    CPPUNIT_ASSERT(farAI->getSkippedUpdateDt() < 0.5);
+
+    // a view next to the far aircraft puts it in the near tier
+    setView(farAI->getGeodPos());
+    CPPUNIT_ASSERT_EQUAL(0.0, aim->updateIntervalSec(farAI.get(), globals->get_view_position_cart()));
+    CPPUNIT_ASSERT_EQUAL(0.5, aim->updateIntervalSec(nearAI.get(), globals->get_view_position_cart()));
+
+    // with the tiers disabled, every object is updated every frame
+    fgSetBool("/sim/ai/update-tiers/enabled", false);
+    FGTestApi::runForTime(0.05);
+    CPPUNIT_ASSERT_EQUAL(0.0, midAI->getSkippedUpdateDt());
+    CPPUNIT_ASSERT_EQUAL(0.0, farAI->getSkippedUpdateDt());
+}
@@ -35,6 +35,8 @@ class AIManagerTests : public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(AIManagerTests);
     CPPUNIT_TEST(testBasic);
     CPPUNIT_TEST(testAircraftWaypoints);
+    CPPUNIT_TEST(testTrafficSnapshot);
+    CPPUNIT_TEST(testUpdateTiers);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -49,4 +51,6 @@ public:
     // The tests.
     void testBasic();
     void testAircraftWaypoints();
+    void testTrafficSnapshot();
+    void testUpdateTiers();
 };
@@ -150,3 +150,36 @@ void TrafficMgrTests::testTrafficManager()
     }
    CPPUNIT_ASSERT_EQUAL(25, counter);
 }
+
+void TrafficMgrTests::testTimeJump()
+{
+    FGAirportRef egeo = FGAirport::getByIdent("EGEO");
+    fgSetString("/sim/presets/airport-id", "EGEO");
+    fgSetBool("/sim/traffic-manager/active", false);
+    fgSetBool("/sim/terrasync/ai-data-update-now", false);
+    fgSetBool("/sim/traffic-manager/heuristics", false);
+    FGTestApi::setPositionAndStabilise(egeo->geod());
+
+    auto tmgr = globals->get_subsystem_mgr()->add<FGTrafficManager>();
+    tmgr->bind();
+    tmgr->init();
+
+    // the schedules are queued once the asynchronous parser has finished
+    for (int i = 0; i < 30 && tmgr->getNextScheduleDue() == -1; i++) {
+        FGTestApi::runForTime(5.0);
+    }
+    CPPUNIT_ASSERT(tmgr->getNextScheduleDue() != -1);
+    FGTestApi::runForTime(30.0);
+
+    // Going back in time must not leave the schedules due hours ahead, with
+    // no traffic until the clock catches up.
+    const time_t before = globals->get_time_params()->get_cur_time();
+    FGTestApi::adjustSimulationWorldTime(before - 6 * 3600);
+    FGTestApi::runForTime(1.0);
+
+    const time_t now = globals->get_time_params()->get_cur_time();
+    CPPUNIT_ASSERT(now < before - 3600);
+    const time_t next = tmgr->getNextScheduleDue();
+    CPPUNIT_ASSERT(next != -1);
+    CPPUNIT_ASSERT(next <= now + 300);
+}
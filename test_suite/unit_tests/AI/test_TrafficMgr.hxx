@@ -37,6 +37,7 @@ class TrafficMgrTests : public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(TrafficMgrTests);
     CPPUNIT_TEST(testParse);
     CPPUNIT_TEST(testTrafficManager);
+    CPPUNIT_TEST(testTimeJump);
     CPPUNIT_TEST_SUITE_END();
 
 
@@ -50,4 +51,5 @@ public:
     // The tests.
     void testTrafficManager();
     void testParse();
+    void testTimeJump();
 };
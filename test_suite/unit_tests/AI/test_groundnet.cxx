@@ -21,6 +21,7 @@
 
 #include "test_groundnet.hxx"
 
+#include <cfloat>
 #include <cstring>
 #include <memory>
 #include <iostream>
@@ -45,6 +46,8 @@
 #include <Main/fg_props.hxx>
 #include <Main/globals.hxx>
 
+#include <simgear/timing/timestamp.hxx>
+
 /////////////////////////////////////////////////////////////////////////////
 
 // Set up function for each test.
@@ -64,6 +67,9 @@ void GroundnetTests::setUp()
     FGAirportRef egph = FGAirport::getByIdent("EGPH");
     egph->testSuiteInjectGroundnetXML(SGPath::fromUtf8(FG_TEST_SUITE_DATA) / "EGPH.groundnet.xml");
 
+    FGAirportRef eddf = FGAirport::getByIdent("EDDF");
+    eddf->testSuiteInjectGroundnetXML(SGPath::fromUtf8(FG_TEST_SUITE_DATA) / "EDDF.groundnet.xml");
+
     FGAirportRef ybbn = FGAirport::getByIdent("YBBN");
     ybbn->testSuiteInjectGroundnetXML(SGPath::fromUtf8(FG_TEST_SUITE_DATA) / "YBBN.groundnet.xml");
 
@@ -97,6 +103,41 @@ void GroundnetTests::testShortestRoute()
     CPPUNIT_ASSERT_EQUAL(29, route.size());
 }
 
+/**
+ * Repeated route requests are served from the route cache, and must still
+ * give the same answer after the segment blocks have changed.
+ */
+void GroundnetTests::testShortestRouteCache()
+{
+    FGAirportRef egph = FGAirport::getByIdent("EGPH");
+
+    FGGroundNetwork* network = egph->groundNetwork();
+    FGParkingRef startParking = network->findParkingByName("main-apron10");
+    FGRunwayRef runway = egph->getRunwayByIndex(0);
+    FGTaxiNodeRef end = network->findNearestNodeOnRunwayEntry(runway->threshold());
+
+    FGTaxiRoute route = network->findShortestRoute(startParking, end);
+    FGTaxiRoute cached = network->findShortestRoute(startParking, end);
+    CPPUNIT_ASSERT_EQUAL(29, route.size());
+    CPPUNIT_ASSERT_EQUAL(route.size(), cached.size());
+
+    FGTaxiNodeRef node;
+    int segmentIndex = 0;
+    cached.first();
+    cached.next(node, &segmentIndex);
+    cached.next(node, &segmentIndex);
+    FGTaxiSegment* segment = network->findSegment(segmentIndex);
+    CPPUNIT_ASSERT(segment);
+    segment->block(1, 0, 0);
+
+    FGTaxiRoute afterBlock = network->findShortestRoute(startParking, end);
+    CPPUNIT_ASSERT_EQUAL(29, afterBlock.size());
+
+    // a node routes to itself with a single-node route
+    FGTaxiRoute self = network->findShortestRoute(startParking, startParking);
+    CPPUNIT_ASSERT_EQUAL(1, self.size());
+}
+
 /**
  * Tests various find methods.
  */
@@ -120,3 +161,78 @@ void GroundnetTests::testFind()
     CPPUNIT_ASSERT(pushForwardSegment);
     CPPUNIT_ASSERT_EQUAL(1027, pushForwardSegment->getEnd()->getIndex());
 }
+
+/**
+ * The spatial grid must give the same answers as a linear scan over all
+ * nodes; also reports the speed-up on a large ground network.
+ */
+void GroundnetTests::testNearestNodeLookup()
+{
+    FGAirportRef eddf = FGAirport::getByIdent("EDDF");
+    FGGroundNetwork* network = eddf->groundNetwork();
+    CPPUNIT_ASSERT_EQUAL(true, network->exists());
+
+    // every node reachable through the segments
+    FGTaxiNodeVector nodes;
+    for (const auto& parking : network->allParkings()) {
+        nodes.push_back(parking);
+    }
+    for (unsigned int i = 1; network->findSegment(i); ++i) {
+        nodes.push_back(network->findSegment(i)->getStart());
+        nodes.push_back(network->findSegment(i)->getEnd());
+    }
+
+    auto linearNearest = [&nodes](const SGGeod& pos, bool onRunway) {
+        const SGVec3d cartPos = SGVec3d::fromGeod(pos);
+        FGTaxiNodeRef result;
+        double d = DBL_MAX;
+        for (const auto& n : nodes) {
+            if (onRunway && !n->getIsOnRunway())
+                continue;
+            const double localDistanceSqr = distSqr(cartPos, n->cart());
+            if (localDistanceSqr < d) {
+                d = localDistanceSqr;
+                result = n;
+            }
+        }
+        return result;
+    };
+
+    // sample a grid of positions around (and well beyond) the airport
+    std::vector<SGGeod> queries;
+    const SGGeod center = eddf->geod();
+    for (int i = -20; i <= 20; ++i) {
+        for (int j = -20; j <= 20; ++j) {
+            queries.push_back(SGGeod::fromDegM(center.getLongitudeDeg() + i * 0.002,
+                                               center.getLatitudeDeg() + j * 0.002, 100.0));
+        }
+    }
+    queries.push_back(SGGeod::fromDegM(center.getLongitudeDeg() + 2.0, center.getLatitudeDeg() - 1.0, 0.0));
+
+    for (const auto& q : queries) {
+        const double expected = dist(SGVec3d::fromGeod(q), linearNearest(q, false)->cart());
+        const double actual = dist(SGVec3d::fromGeod(q), network->findNearestNode(q)->cart());
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, actual, 1e-6);
+
+        const double expectedRwy = dist(SGVec3d::fromGeod(q), linearNearest(q, true)->cart());
+        const double actualRwy = dist(SGVec3d::fromGeod(q), network->findNearestNodeOnRunwayEntry(q)->cart());
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedRwy, actualRwy, 1e-6);
+    }
+
+    SGTimeStamp st;
+    st.stamp();
+    for (const auto& q : queries) {
+        linearNearest(q, false);
+    }
+    const int linearUSec = st.elapsedUSec();
+
+    st.stamp();
+    for (const auto& q : queries) {
+        network->findNearestNode(q);
+    }
+    const int gridUSec = st.elapsedUSec();
+
+    std::cout << "EDDF nearest node, " << queries.size() << " queries over "
+              << nodes.size() << " node refs: linear " << linearUSec
+              << "us, grid " << gridUSec << "us" << std::endl;
+}
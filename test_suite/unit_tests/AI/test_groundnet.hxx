@@ -34,7 +34,9 @@ class GroundnetTests : public CppUnit::TestFixture
     // Set up the test suite.
     CPPUNIT_TEST_SUITE(GroundnetTests);
     CPPUNIT_TEST(testShortestRoute);
+    CPPUNIT_TEST(testShortestRouteCache);
     CPPUNIT_TEST(testFind);
+    CPPUNIT_TEST(testNearestNodeLookup);
     
     CPPUNIT_TEST_SUITE_END();
 
@@ -48,5 +50,7 @@ public:
 
     // The tests.
     void testShortestRoute();
+    void testShortestRouteCache();
     void testFind();
+    void testNearestNodeLookup();
 };
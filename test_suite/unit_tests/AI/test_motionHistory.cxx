@@ -0,0 +1,275 @@
+/*
+ * SPDX-FileName: test_motionHistory.cxx
+ * SPDX-FileComment: unit tests and benchmark for the MP motion history buffer
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_motionHistory.hxx"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <simgear/timing/timestamp.hxx>
+
+#include <AIModel/AIMotionHistory.hxx>
+
+namespace {
+
+FGExternalMotionData makeSample(double time)
+{
+    FGExternalMotionData data;
+    data.time = time;
+    data.lag = 0.1;
+    data.position = SGVec3d(time, 0, 0);
+    data.orientation = SGQuatf::unit();
+    data.linearVel = data.angularVel = SGVec3f::zeros();
+    data.linearAccel = data.angularAccel = SGVec3f::zeros();
+    return data;
+}
+
+void insertSample(FGAIMotionHistory& history, double time)
+{
+    FGExternalMotionData data = makeSample(time);
+    history.insert(time, data);
+}
+
+typedef std::map<double, FGExternalMotionData> MotionMap;
+
+} // of anonymous namespace
+
+// Counts the heap allocations of the benchmark thread while enabled, for the
+// std::map and the ring buffer alike.
+static thread_local bool t_countAllocations = false;
+static size_t s_allocations = 0;
+
+void* operator new(size_t size)
+{
+    if (t_countAllocations) {
+        ++s_allocations;
+    }
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void MotionHistoryTests::testOrdering()
+{
+    FGAIMotionHistory history(8);
+    CPPUNIT_ASSERT(history.empty());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), history.upperBound(1.0));
+
+    for (double t : {1.0, 2.0, 4.0, 3.0, 0.5, 5.0}) {
+        insertSample(history, t);
+    }
+
+    const double expected[] = {0.5, 1.0, 2.0, 3.0, 4.0, 5.0};
+    CPPUNIT_ASSERT_EQUAL(size_t(6), history.size());
+    for (size_t i = 0; i < history.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(expected[i], history.key(i));
+        CPPUNIT_ASSERT_EQUAL(expected[i], history[i].time);
+    }
+
+    // same semantics as std::map::upper_bound
+    CPPUNIT_ASSERT_EQUAL(size_t(0), history.upperBound(0.1));
+    CPPUNIT_ASSERT_EQUAL(size_t(3), history.upperBound(2.0));
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.upperBound(3.5));
+    CPPUNIT_ASSERT_EQUAL(size_t(6), history.upperBound(9.0));
+
+    // a duplicate time replaces the sample
+    FGExternalMotionData dup = makeSample(3.0);
+    dup.lag = 0.7;
+    history.insert(3.0, dup);
+    CPPUNIT_ASSERT_EQUAL(size_t(6), history.size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.7, history[3].lag, 1e-9);
+
+    history.eraseFront(2);
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.size());
+    CPPUNIT_ASSERT_EQUAL(2.0, history.key(0));
+
+    history.clear();
+    CPPUNIT_ASSERT(history.empty());
+}
+
+void MotionHistoryTests::testOverflow()
+{
+    FGAIMotionHistory history(4);
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.capacity());
+
+    // many wraps of the ring, with the oldest samples dropped
+    for (int i = 0; i < 21; ++i) {
+        insertSample(history, i);
+    }
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.size());
+    for (size_t i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT_EQUAL(17.0 + i, history.key(i));
+    }
+
+    // too old to fit
+    insertSample(history, 1.0);
+    CPPUNIT_ASSERT_EQUAL(17.0, history.key(0));
+
+    // late, but newer than the oldest: that one goes
+    insertSample(history, 17.5);
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.size());
+    CPPUNIT_ASSERT_EQUAL(17.5, history.key(0));
+    CPPUNIT_ASSERT_EQUAL(18.0, history.key(1));
+    CPPUNIT_ASSERT_EQUAL(20.0, history.key(3));
+}
+
+void MotionHistoryTests::testPropertyOwnership()
+{
+    FGAIMotionHistory history(4);
+
+    for (int i = 0; i < 10; ++i) {
+        FGExternalMotionData data = makeSample(9 - i); // worst case: reversed
+        auto prop = new FGPropertyData;
+        prop->id = 100 + i;
+        prop->type = simgear::props::STRING;
+        prop->string_value = new char[8];
+        strcpy(prop->string_value, "engaged");
+        data.properties.push_back(prop);
+
+        history.insert(data.time, data);
+        // the history took the properties, so data won't delete them
+        CPPUNIT_ASSERT(data.properties.empty());
+    }
+
+    // only 9, 8, 7, 6 were kept, as the rest were older
+    CPPUNIT_ASSERT_EQUAL(size_t(4), history.size());
+    for (size_t i = 0; i < history.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(size_t(1), history[i].properties.size());
+        CPPUNIT_ASSERT_EQUAL(unsigned(100 + 3 - i), history[i].properties.front()->id);
+        CPPUNIT_ASSERT_EQUAL(std::string("engaged"), std::string(history[i].properties.front()->string_value));
+    }
+}
+
+// Feed both containers the same jittered, partly out of order stream, and
+// check the interpolation brackets match.
+void MotionHistoryTests::testMatchesMap()
+{
+    FGAIMotionHistory history;
+    MotionMap map;
+
+    unsigned rng = 12345;
+    double t = 0.0, tInterp = -0.3;
+    for (int i = 0; i < 2000; ++i) {
+        rng = rng * 1103515245 + 12345;
+        double packetTime = t + ((rng >> 16) % 100) * 0.001;
+        if ((rng >> 8) % 10 == 0) {
+            packetTime -= 0.15; // a late packet
+        }
+        t += 0.05;
+
+        insertSample(history, packetTime);
+        map[packetTime] = makeSample(packetTime);
+
+        tInterp += 0.05;
+        size_t next = history.upperBound(tInterp);
+        auto nextIt = map.upper_bound(tInterp);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(std::distance(map.begin(), nextIt)), next);
+        if (next > 0) {
+            --next;
+            --nextIt;
+        }
+        history.eraseFront(next);
+        map.erase(map.begin(), nextIt);
+
+        CPPUNIT_ASSERT_EQUAL(map.size(), history.size());
+        size_t j = 0;
+        for (const auto& entry : map) {
+            CPPUNIT_ASSERT_EQUAL(entry.first, history.key(j++));
+        }
+    }
+}
+
+// The update pattern of FGAIMultiplayer: 20 Hz packets, 60 Hz frames, for
+// a few hundred aircraft. The properties are left out, as their cost is
+// the same for both containers.
+void MotionHistoryTests::testBenchmark()
+{
+    const int aircraft = 500;
+    const int frames = 600;
+    const int framesPerPacket = 3;
+    const double frameSec = 1.0 / 60.0;
+
+    std::vector<MotionMap> maps(aircraft);
+    std::vector<std::unique_ptr<FGAIMotionHistory>> histories;
+    for (int a = 0; a < aircraft; ++a) {
+        histories.emplace_back(new FGAIMotionHistory);
+    }
+
+    FGExternalMotionData sample = makeSample(0.0);
+
+    s_allocations = 0;
+    t_countAllocations = true;
+    SGTimeStamp st;
+    st.stamp();
+    for (int f = 0; f < frames; ++f) {
+        const double now = f * frameSec;
+        for (auto& map : maps) {
+            if (f % framesPerPacket == 0) {
+                sample.time = now;
+                map[now] = sample;
+            }
+            auto nextIt = map.upper_bound(now - 0.1);
+            if (nextIt != map.begin()) {
+                --nextIt;
+            }
+            map.erase(map.begin(), nextIt);
+        }
+    }
+    const int mapUSec = st.elapsedUSec();
+    const size_t mapAllocations = s_allocations;
+
+    s_allocations = 0;
+    st.stamp();
+    for (int f = 0; f < frames; ++f) {
+        const double now = f * frameSec;
+        for (auto& history : histories) {
+            if (f % framesPerPacket == 0) {
+                sample.time = now;
+                history->insert(now, sample);
+            }
+            size_t next = history->upperBound(now - 0.1);
+            if (next > 0) {
+                --next;
+            }
+            history->eraseFront(next);
+        }
+    }
+    const int ringUSec = st.elapsedUSec();
+    t_countAllocations = false;
+    const size_t ringAllocations = s_allocations;
+
+    // the ring never grows, so it never allocates after construction
+    CPPUNIT_ASSERT_EQUAL(size_t(0), ringAllocations);
+    for (const auto& history : histories) {
+        CPPUNIT_ASSERT_EQUAL(FGAIMotionHistory::DEFAULT_CAPACITY, history->capacity());
+        CPPUNIT_ASSERT_EQUAL(maps.front().size(), history->size());
+    }
+
+    std::cout << "MP motion history, " << aircraft << " aircraft, " << frames
+              << " frames: std::map " << mapUSec << "us, " << mapAllocations
+              << " allocations; ring buffer " << ringUSec << "us, " << ringAllocations
+              << " allocations" << std::endl;
+}
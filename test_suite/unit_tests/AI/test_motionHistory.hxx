@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileName: test_motionHistory.hxx
+ * SPDX-FileComment: unit tests and benchmark for the MP motion history buffer
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class MotionHistoryTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(MotionHistoryTests);
+    CPPUNIT_TEST(testOrdering);
+    CPPUNIT_TEST(testOverflow);
+    CPPUNIT_TEST(testPropertyOwnership);
+    CPPUNIT_TEST(testMatchesMap);
+    CPPUNIT_TEST(testBenchmark);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // The tests.
+    void testOrdering();
+    void testOverflow();
+    void testPropertyOwnership();
+    void testMatchesMap();
+    void testBenchmark();
+};
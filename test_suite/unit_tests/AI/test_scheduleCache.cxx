@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileName: test_scheduleCache.cxx
+ * SPDX-FileComment: unit tests for the binary traffic schedule cache
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_scheduleCache.hxx"
+
+#include <string>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/io/iostreams/sgstream.hxx>
+
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
+#include <Traffic/ScheduleCache.hxx>
+#include <Traffic/TrafficMgr.hxx>
+
+namespace {
+
+typedef FGTrafficScheduleCache C;
+
+// the test home persists between runs: start without a cache
+void removeCache(const SGPath& key)
+{
+    SGPath cachePath = FGTrafficScheduleCache(key).cachePath();
+    if (cachePath.exists()) {
+        cachePath.remove();
+    }
+}
+
+SGPath writeFile(const std::string& name, const std::string& contents)
+{
+    SGPath path = globals->get_fg_home() / name;
+    sg_ofstream out(path, std::ios::out | std::ios::trunc);
+    out << contents;
+    return path;
+}
+
+void addRecords(FGTrafficScheduleCache& cache)
+{
+    const std::string aircraft[C::NumAircraftStrings] = {
+        "Aircraft/A320/Models/A320.xml", "TST", "EGPH", "G-TEST", "TST_BN",
+        "A320", "TST", "jet_transport", "gate"};
+    cache.addAircraft(aircraft, true, 19.0, 0.5);
+
+    const std::string flight[C::NumFlightStrings] = {
+        "TST123", "IFR", "EGPH", "EGLL", "0/07:00:00", "0/08:30:00", "WEEK", "TST_BN"};
+    cache.addFlight(flight, 330);
+}
+
+} // of anonymous namespace
+
+
+void ScheduleCacheTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("schedule-cache");
+}
+
+void ScheduleCacheTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void ScheduleCacheTests::testMissThenHit()
+{
+    SGPath source = writeFile("traffic.xml", "<trafficlist/>");
+    removeCache(source);
+
+    FGTrafficScheduleCache first(source);
+    first.addSourceFile(source);
+    CPPUNIT_ASSERT(!first.load());
+    addRecords(first);
+    CPPUNIT_ASSERT(first.save());
+    CPPUNIT_ASSERT(first.cachePath().exists());
+
+    FGTrafficScheduleCache second(source);
+    second.addSourceFile(source);
+    CPPUNIT_ASSERT(second.load());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), second.records().size());
+
+    const auto& aircraft = second.records()[0];
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(C::Aircraft), static_cast<int>(aircraft.kind));
+    CPPUNIT_ASSERT_EQUAL(1, static_cast<int>(aircraft.heavy));
+    CPPUNIT_ASSERT_EQUAL(19.0, aircraft.radius);
+    CPPUNIT_ASSERT_EQUAL(0.5, aircraft.offset);
+    CPPUNIT_ASSERT_EQUAL(std::string("G-TEST"), second.stringAt(aircraft.strings[C::AcRegistration]));
+
+    const auto& flight = second.records()[1];
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(C::Flight), static_cast<int>(flight.kind));
+    CPPUNIT_ASSERT_EQUAL(330, static_cast<int>(flight.cruiseAlt));
+    CPPUNIT_ASSERT_EQUAL(std::string("EGLL"), second.stringAt(flight.strings[C::FlArrivalPort]));
+    // shared strings are only stored once
+    CPPUNIT_ASSERT_EQUAL(aircraft.strings[C::AcRequiredAircraft], flight.strings[C::FlRequiredAircraft]);
+
+    // another set of source files is a miss
+    SGPath other = writeFile("other.xml", "<trafficlist/>");
+    FGTrafficScheduleCache third(source);
+    third.addSourceFile(source);
+    third.addSourceFile(other);
+    CPPUNIT_ASSERT(!third.load());
+}
+
+void ScheduleCacheTests::testSourceChanged()
+{
+    SGPath source = writeFile("traffic.xml", "<trafficlist/>");
+    removeCache(source);
+
+    FGTrafficScheduleCache first(source);
+    first.addSourceFile(source);
+    addRecords(first);
+    CPPUNIT_ASSERT(first.save());
+
+    // a different size is noticed even within the mtime resolution
+    writeFile("traffic.xml", "<trafficlist></trafficlist>");
+    FGTrafficScheduleCache second(source);
+    second.addSourceFile(source);
+    CPPUNIT_ASSERT(!second.load());
+}
+
+void ScheduleCacheTests::testDependencyChanged()
+{
+    SGPath source = writeFile("traffic.xml", "<trafficlist/>");
+    removeCache(source);
+    SGPath include = writeFile("include.xml", "<aircraft/>");
+
+    FGTrafficScheduleCache first(source);
+    first.addSourceFile(source);
+    first.addDependency(include);
+    addRecords(first);
+    CPPUNIT_ASSERT(first.save());
+
+    FGTrafficScheduleCache second(source);
+    second.addSourceFile(source);
+    CPPUNIT_ASSERT(second.load());
+
+    writeFile("include.xml", "<aircraft></aircraft>");
+    FGTrafficScheduleCache third(source);
+    third.addSourceFile(source);
+    CPPUNIT_ASSERT(!third.load());
+}
+
+// A .conf timetable is cached too, and gives the same flights when read
+// back from the cache.
+void ScheduleCacheTests::testTimeTable()
+{
+    SGPath conf = writeFile("traffic.conf",
+                            "AC EGPH G-TEST TST A320 TST TST 0.5 19 gate jet_transport true Aircraft/A320/Models/A320.xml\n"
+                            "FLIGHT TST123 IFR 1.3.5.7 07:00 EGPH 08:30 EGLL 330 TSTTST\n");
+    fgSetString("/sim/traffic-manager/datafile", conf.utf8Str());
+    fgSetBool("/sim/traffic-manager/enabled", true);
+    fgSetBool("/sim/signals/fdm-initialized", true);
+
+    removeCache(conf);
+    const SGPath cachePath = FGTrafficScheduleCache(conf).cachePath();
+
+    for (int run = 0; run < 2; ++run) {
+        FGTrafficManager tmgr;
+        tmgr.init();
+        // written on the first run, used on the second
+        CPPUNIT_ASSERT(cachePath.exists());
+
+        int count = 0;
+        for (auto i = tmgr.getFirstFlight("TSTTST"); i != tmgr.getLastFlight("TSTTST"); ++i) {
+            CPPUNIT_ASSERT_EQUAL(std::string("TST123"), (*i)->getCallSign());
+            ++count;
+        }
+        // one flight per day of the week it operates
+        CPPUNIT_ASSERT_EQUAL(4, count);
+    }
+
+    FGTrafficScheduleCache cache(conf);
+    cache.addSourceFile(conf);
+    CPPUNIT_ASSERT(cache.load());
+}
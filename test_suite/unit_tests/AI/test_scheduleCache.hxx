@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileName: test_scheduleCache.hxx
+ * SPDX-FileComment: unit tests for the binary traffic schedule cache
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class ScheduleCacheTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(ScheduleCacheTests);
+    CPPUNIT_TEST(testMissThenHit);
+    CPPUNIT_TEST(testSourceChanged);
+    CPPUNIT_TEST(testDependencyChanged);
+    CPPUNIT_TEST(testTimeTable);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testMissThenHit();
+    void testSourceChanged();
+    void testDependencyChanged();
+    void testTimeTable();
+};
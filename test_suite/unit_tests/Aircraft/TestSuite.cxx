@@ -0,0 +1,16 @@
+/*
+ * SPDX-FileName: TestSuite.cxx
+ * SPDX-FileComment: unit tests of the Aircraft directory
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "test_continuous.hxx"
+#include "test_continuousReader.hxx"
+#include "test_flightRecorder.hxx"
+#include "test_replayStore.hxx"
+
+// Set up the unit tests.
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ContinuousRecordingTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ContinuousReaderTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(FlightRecorderTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ReplayStoreTests, "Unit tests");
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileName: test_continuous.cxx
+ * SPDX-FileComment: unit tests for writing and indexing Continuous recordings
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_continuous.hxx"
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <Aircraft/continuous.hxx>
+#include <Main/fg_props.hxx>
+
+namespace {
+
+const int NUM_FRAMES = 1000;
+
+SGPropertyNode_ptr makeConfig(int compression)
+{
+    SGPropertyNode_ptr config = new SGPropertyNode;
+    config->setIntValue("meta/continuous-compression", compression);
+    config->setIntValue("meta/continuous-index", 1);
+    config->addChild("data")->setStringValue("signals");
+    return config;
+}
+
+/* Writes NUM_FRAMES frames with ContinuousWriter, and returns the data
+following the header. */
+std::string writeRecording(SGPropertyNode_ptr config)
+{
+    std::stringstream out;
+    // Something in place of the header, so that no frame is at offset zero.
+    out.write("header", 6);
+
+    ContinuousWriter writer;
+    writer.start(out, config);
+    FGReplayData frame;
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        frame.sim_time = i * 0.02;
+        frame.raw_data.assign(64, static_cast<char>(i));
+        writer.push(&frame);
+    }
+    CPPUNIT_ASSERT(writer.stop());
+    return out.str();
+}
+
+void checkIndex(const std::string& recording, const std::map<double, FGFrameInfo>& index, bool compressed)
+{
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(NUM_FRAMES), index.size());
+    int i = 0;
+    for (auto& it : index) {
+        CPPUNIT_ASSERT_EQUAL(i * 0.02, it.first);
+        CPPUNIT_ASSERT(it.second.has_signals);
+        CPPUNIT_ASSERT(!it.second.has_multiplayer);
+        CPPUNIT_ASSERT(!it.second.has_extra_properties);
+
+        // Each offset is that of a frame with the indexed time.
+        double time;
+        CPPUNIT_ASSERT(it.second.offset + sizeof(time) < recording.size());
+        memcpy(&time, &recording[it.second.offset], sizeof(time));
+        CPPUNIT_ASSERT_EQUAL(it.first, time);
+        if (!compressed) {
+            const size_t data = it.second.offset + sizeof(time) + sizeof(uint32_t);
+            CPPUNIT_ASSERT_EQUAL(static_cast<char>(i), recording[data]);
+        }
+        ++i;
+    }
+}
+
+} // of anonymous namespace
+
+
+void ContinuousRecordingTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("continuous-recording");
+    fgSetInt("/sim/replay/record-continuous-index-frames", 300);
+    // A short queue, so that the main thread has to wait for the writer.
+    fgSetInt("/sim/replay/record-continuous-queue-frames", 4);
+}
+
+void ContinuousRecordingTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void ContinuousRecordingTests::testWriteAndIndex()
+{
+    const std::string recording = writeRecording(makeConfig(0));
+
+    std::istringstream in(recording);
+    std::map<double, FGFrameInfo> index;
+    CPPUNIT_ASSERT(continuousReadIndex(in, index));
+    checkIndex(recording, index, false);
+}
+
+void ContinuousRecordingTests::testCompressedIndex()
+{
+    const std::string recording = writeRecording(makeConfig(1));
+
+    std::istringstream in(recording);
+    std::map<double, FGFrameInfo> index;
+    CPPUNIT_ASSERT(continuousReadIndex(in, index));
+    checkIndex(recording, index, true);
+}
+
+void ContinuousRecordingTests::testUnterminatedRecording()
+{
+    // E.g. Flightgear was killed while recording, part way through a frame.
+    std::string recording = writeRecording(makeConfig(0));
+    recording.append(20, '\0');
+
+    std::istringstream in(recording);
+    std::map<double, FGFrameInfo> index;
+    index[1.0].offset = 1;
+    CPPUNIT_ASSERT(!continuousReadIndex(in, index));
+
+    // The index is left unchanged for the caller to build by reading frames.
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), index.size());
+}
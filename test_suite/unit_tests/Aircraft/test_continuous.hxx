@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileName: test_continuous.hxx
+ * SPDX-FileComment: unit tests for writing and indexing Continuous recordings
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class ContinuousRecordingTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(ContinuousRecordingTests);
+    CPPUNIT_TEST(testWriteAndIndex);
+    CPPUNIT_TEST(testCompressedIndex);
+    CPPUNIT_TEST(testUnterminatedRecording);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testWriteAndIndex();
+    void testCompressedIndex();
+    void testUnterminatedRecording();
+};
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileName: test_continuousReader.cxx
+ * SPDX-FileComment: unit tests for reading Continuous recordings without the rest of Flightgear
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_continuousReader.hxx"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/props/props_io.hxx>
+
+#include <Aircraft/continuous.hxx>
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
+
+namespace {
+
+const int NUM_FRAMES = 1000;
+
+/* Signals of the recordings below, as written by FGFlightRecorder::getConfig().
+Doubles come first in each frame's signals data, whatever the order here. */
+SGPropertyNode_ptr makeConfig(int compression)
+{
+    SGPropertyNode_ptr config = new SGPropertyNode;
+    config->setIntValue("meta/continuous-compression", compression);
+    config->setIntValue("meta/continuous-index", 1);
+    config->addChild("data")->setStringValue("signals");
+    config->addChild("data")->setStringValue("multiplayer");
+
+    SGPropertyNode* signals = config->getNode("signals/signals", true);
+    const char* layout[][2] = {
+        {"float", "/b"},
+        {"double", "/a"},
+        {"bool", "/d"},
+        {"int", "/c"},
+        {"bool", "/e"},
+    };
+    for (auto& l : layout) {
+        SGPropertyNode* signal = signals->addChild("signal");
+        signal->setStringValue("type", l[0]);
+        signal->setStringValue("property", l[1]);
+        signal->setStringValue("interpolation", "linear");
+    }
+    config->setIntValue("signals/recorder/record-size", sizeof(double) + 8 + 4 + 4 + 1);
+    return config;
+}
+
+/* Signals data of frame <i>. As in FGFlightRecorder::capture(), this is
+record-size bytes, i.e. the signals followed by space for the frame time. */
+std::vector<char> makeSignals(int i)
+{
+    std::vector<char> raw(sizeof(double) + 8 + 4 + 4 + 1);
+    const double a = i * 0.5;
+    const float b = -i;
+    const int c = i * 1000;
+    memcpy(&raw[0], &a, sizeof(a));
+    memcpy(&raw[8], &b, sizeof(b));
+    memcpy(&raw[12], &c, sizeof(c));
+    raw[16] = (i % 2) | ((i % 3 == 0) << 1);
+    return raw;
+}
+
+/* Writes a recording of NUM_FRAMES frames to a file, and returns its path. */
+SGPath writeRecording(SGPropertyNode_ptr config)
+{
+    SGPath path = globals->get_fg_home() / "test-continuous-reader.fgtape";
+    std::ofstream out(path.c_str(), std::ofstream::binary | std::ofstream::trunc);
+    out.write(FlightRecorderFileMagic, strlen(FlightRecorderFileMagic) + 1);
+    std::stringstream buffer;
+    writeProperties(buffer, config, true /*write_all*/);
+    const uint32_t length = buffer.str().size() + 1;
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(buffer.str().c_str(), length);
+
+    ContinuousWriter writer;
+    writer.start(out, config);
+    FGReplayData frame;
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        frame.sim_time = i * 0.02;
+        frame.raw_data = makeSignals(i);
+        frame.multiplayer_messages.clear();
+        if (i % 10 == 0) {
+            frame.multiplayer_messages.push_back(std::make_shared<std::vector<char>>(30, 'm'));
+        }
+        writer.push(&frame);
+    }
+    CPPUNIT_ASSERT(writer.stop());
+    return path;
+}
+
+void checkRecording(const SGPath& path)
+{
+    ContinuousTapeReader reader;
+    CPPUNIT_ASSERT_EQUAL(0, reader.open(path));
+    CPPUNIT_ASSERT_EQUAL(0, reader.dataIndex("signals"));
+    CPPUNIT_ASSERT_EQUAL(1, reader.dataIndex("multiplayer"));
+    CPPUNIT_ASSERT_EQUAL(-1, reader.dataIndex("extra-properties"));
+
+    ContinuousTapeSignals layout;
+    CPPUNIT_ASSERT(layout.init(reader.config()->getNode("signals")));
+
+    ContinuousTapeFrame frame;
+    int i = 0;
+    while (reader.next(frame)) {
+        CPPUNIT_ASSERT(i < NUM_FRAMES);
+        CPPUNIT_ASSERT_EQUAL(i * 0.02, frame.time);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), frame.items.size());
+
+        const auto& signals = frame.items[0];
+        CPPUNIT_ASSERT_EQUAL(layout.size() + sizeof(double), signals.second);
+        CPPUNIT_ASSERT(makeSignals(i) == std::vector<char>(signals.first, signals.first + signals.second));
+        CPPUNIT_ASSERT_EQUAL(i * 0.5, layout.value(signals.first, 0));
+        CPPUNIT_ASSERT_EQUAL(-1.0 * i, layout.value(signals.first, 1));
+        CPPUNIT_ASSERT_EQUAL(i * 1000.0, layout.value(signals.first, 2));
+        CPPUNIT_ASSERT_EQUAL(i % 2 * 1.0, layout.value(signals.first, 3));
+        CPPUNIT_ASSERT_EQUAL(i % 3 == 0 ? 1.0 : 0.0, layout.value(signals.first, 4));
+
+        const size_t multiplayer = (i % 10 == 0) ? sizeof(uint16_t) + 30 : 0;
+        CPPUNIT_ASSERT_EQUAL(multiplayer, frame.items[1].second);
+        ++i;
+    }
+    // Index chunks are skipped, and a complete recording isn't reported as
+    // truncated.
+    CPPUNIT_ASSERT_EQUAL(NUM_FRAMES, i);
+}
+
+} // of anonymous namespace
+
+
+void ContinuousReaderTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("continuous-reader");
+    fgSetInt("/sim/replay/record-continuous-index-frames", 300);
+}
+
+void ContinuousReaderTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void ContinuousReaderTests::testSignalLayout()
+{
+    SGPropertyNode_ptr config = makeConfig(0);
+    ContinuousTapeSignals layout;
+    CPPUNIT_ASSERT(layout.init(config->getNode("signals")));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(17), layout.size());
+
+    // Signals are ordered by type, as FGFlightRecorder::capture() stores them.
+    const auto& signals = layout.signals();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), signals.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("/a"), signals[0].property);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), signals[0].offset);
+    CPPUNIT_ASSERT_EQUAL(std::string("/b"), signals[1].property);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), signals[1].offset);
+    CPPUNIT_ASSERT_EQUAL(std::string("/c"), signals[2].property);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(12), signals[2].offset);
+    CPPUNIT_ASSERT_EQUAL(std::string("/e"), signals[4].property);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(16), signals[4].offset);
+    CPPUNIT_ASSERT_EQUAL(1, static_cast<int>(signals[4].bit));
+
+    // A record size that doesn't match the signals is rejected.
+    config->setIntValue("signals/recorder/record-size", 100);
+    CPPUNIT_ASSERT(!layout.init(config->getNode("signals")));
+}
+
+void ContinuousReaderTests::testReadFrames()
+{
+    checkRecording(writeRecording(makeConfig(0)));
+}
+
+void ContinuousReaderTests::testReadCompressedFrames()
+{
+    checkRecording(writeRecording(makeConfig(1)));
+}
+
+void ContinuousReaderTests::testNotContinuous()
+{
+    SGPath path = globals->get_fg_home() / "test-continuous-reader.fgtape";
+    {
+        std::ofstream out(path.c_str(), std::ofstream::binary | std::ofstream::trunc);
+        out << "This is not a recording, but is longer than the magic string.";
+    }
+    ContinuousTapeReader reader;
+    CPPUNIT_ASSERT_EQUAL(-1, reader.open(path));
+
+    ContinuousTapeFrame frame;
+    CPPUNIT_ASSERT(!reader.next(frame));
+}
@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileName: test_continuousReader.hxx
+ * SPDX-FileComment: unit tests for reading Continuous recordings without the rest of Flightgear
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class ContinuousReaderTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(ContinuousReaderTests);
+    CPPUNIT_TEST(testSignalLayout);
+    CPPUNIT_TEST(testReadFrames);
+    CPPUNIT_TEST(testReadCompressedFrames);
+    CPPUNIT_TEST(testNotContinuous);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testSignalLayout();
+    void testReadFrames();
+    void testReadCompressedFrames();
+    void testNotContinuous();
+};
@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileName: test_flightRecorder.cxx
+ * SPDX-FileComment: unit tests for replaying flight recorder signals
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_flightRecorder.hxx"
+
+#include <cstring>
+#include <vector>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/constants.h>
+
+#include <Aircraft/flightrecorder.hxx>
+#include <Main/fg_props.hxx>
+
+namespace {
+
+/* Signals of the recorder configuration below, in the order in which they
+are stored in each frame. */
+struct Frame {
+    double a;
+    double heading;
+    double discrete;
+    float f;
+    int i;
+    bool b;
+};
+
+SGPropertyNode_ptr makeConfig()
+{
+    SGPropertyNode_ptr config = new SGPropertyNode;
+    config->setStringValue("name", "test");
+    const char* signals[][3] = {
+        {"double", "/test/a", "linear"},
+        {"double", "/test/heading-deg", "angular-deg"},
+        {"double", "/test/discrete", "discrete"},
+        {"float", "/test/f", "linear"},
+        {"int", "/test/i", "linear"},
+        {"bool", "/test/b", "discrete"},
+    };
+    for (auto& s : signals) {
+        SGPropertyNode* signal = config->addChild("signal");
+        signal->setStringValue("type", s[0]);
+        signal->setStringValue("property", s[1]);
+        signal->setStringValue("interpolation", s[2]);
+    }
+    return config;
+}
+
+void makeFrame(double sim_time, const Frame& values, FGReplayData& frame)
+{
+    frame.sim_time = sim_time;
+    frame.raw_data.assign(3 * sizeof(double) + sizeof(float) + sizeof(int) + 1, 0);
+    char* p = frame.raw_data.data();
+    memcpy(p, &values.a, sizeof(double));
+    memcpy(p + 8, &values.heading, sizeof(double));
+    memcpy(p + 16, &values.discrete, sizeof(double));
+    memcpy(p + 24, &values.f, sizeof(float));
+    memcpy(p + 28, &values.i, sizeof(int));
+    p[32] = values.b ? 1 : 0;
+}
+
+} // of anonymous namespace
+
+
+void FlightRecorderTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("flight-recorder");
+}
+
+void FlightRecorderTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void FlightRecorderTests::testRecordSize()
+{
+    FGFlightRecorder recorder("replay-config");
+    recorder.reinit(makeConfig());
+    // The record size includes the frame time.
+    CPPUNIT_ASSERT_EQUAL(8 + 3 * 8 + 4 + 4 + 1, recorder.getRecordSize());
+}
+
+void FlightRecorderTests::testReplayInterpolation()
+{
+    FGFlightRecorder recorder("replay-config");
+    recorder.reinit(makeConfig());
+
+    FGReplayData last;
+    FGReplayData next;
+    makeFrame(1.0, {10.0, 350.0, 1.0, 2.0f, 5, true}, last);
+    makeFrame(2.0, {20.0, 10.0, 2.0, 3.0f, 7, false}, next);
+
+    recorder.replay(1.25, &next, &last, nullptr, nullptr, nullptr, nullptr);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.5, fgGetDouble("/test/a"), 1e-12);
+    // Angular interpolation goes the short way round, through 360.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(355.0, fgGetDouble("/test/heading-deg"), 1e-12);
+    CPPUNIT_ASSERT_EQUAL(2.0, fgGetDouble("/test/discrete"));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.25, fgGetDouble("/test/f"), 1e-6);
+    CPPUNIT_ASSERT_EQUAL(7, fgGetInt("/test/i"));
+    CPPUNIT_ASSERT_EQUAL(false, fgGetBool("/test/b"));
+
+    // Times past the next frame don't extrapolate.
+    recorder.replay(3.0, &next, &last, nullptr, nullptr, nullptr, nullptr);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, fgGetDouble("/test/a"), 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, fgGetDouble("/test/f"), 1e-6);
+}
+
+void FlightRecorderTests::testReplayWithoutLastFrame()
+{
+    FGFlightRecorder recorder("replay-config");
+    recorder.reinit(makeConfig());
+
+    FGReplayData next;
+    makeFrame(2.0, {20.0, 10.0, 2.0, 3.0f, 7, true}, next);
+    recorder.replay(1.5, &next, nullptr, nullptr, nullptr, nullptr, nullptr);
+    CPPUNIT_ASSERT_EQUAL(20.0, fgGetDouble("/test/a"));
+    CPPUNIT_ASSERT_EQUAL(10.0, fgGetDouble("/test/heading-deg"));
+    CPPUNIT_ASSERT_EQUAL(3.0, fgGetDouble("/test/f"));
+    CPPUNIT_ASSERT_EQUAL(true, fgGetBool("/test/b"));
+}
+
+void FlightRecorderTests::testReplayManySignals()
+{
+    // Enough signals for the interpolation loop to have a remainder after
+    // any vectorised part, with angular signals mixed in.
+    const int count = 37;
+    SGPropertyNode_ptr config = new SGPropertyNode;
+    config->setIntValue("count", count);
+    SGPropertyNode* signal = config->addChild("signal");
+    signal->setStringValue("type", "float");
+    signal->setStringValue("property", "/test/v[%i]");
+    signal->setStringValue("interpolation", "linear");
+    signal = config->addChild("signal");
+    signal->setStringValue("type", "float");
+    signal->setStringValue("property", "/test/w[%i]");
+    signal->setStringValue("interpolation", "angular-rad");
+
+    FGFlightRecorder recorder("replay-config");
+    recorder.reinit(config);
+    CPPUNIT_ASSERT_EQUAL(8 + 2 * count * 4, recorder.getRecordSize());
+
+    FGReplayData last;
+    FGReplayData next;
+    last.sim_time = 0.0;
+    next.sim_time = 1.0;
+    std::vector<float> lastValues;
+    std::vector<float> nextValues;
+    for (int i = 0; i < count; ++i) {
+        lastValues.push_back(i);
+        nextValues.push_back(2 * i);
+    }
+    for (int i = 0; i < count; ++i) {
+        lastValues.push_back(3.0f);
+        nextValues.push_back(-3.0f);
+    }
+    last.raw_data.resize(lastValues.size() * sizeof(float));
+    next.raw_data.resize(nextValues.size() * sizeof(float));
+    memcpy(last.raw_data.data(), lastValues.data(), last.raw_data.size());
+    memcpy(next.raw_data.data(), nextValues.data(), next.raw_data.size());
+
+    recorder.replay(0.5, &next, &last, nullptr, nullptr, nullptr, nullptr);
+    for (int i = 0; i < count; ++i) {
+        const std::string index = "[" + std::to_string(i) + "]";
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5 * i, fgGetDouble(("/test/v" + index).c_str()), 1e-5);
+        // From 3 to -3 radians the short way is through pi.
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(static_cast<float>(3.0 + (SGD_2PI - 6.0) / 2),
+                                     fgGetDouble(("/test/w" + index).c_str()), 1e-5);
+    }
+}
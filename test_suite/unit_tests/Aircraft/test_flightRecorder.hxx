@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileName: test_flightRecorder.hxx
+ * SPDX-FileComment: unit tests for replaying flight recorder signals
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class FlightRecorderTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(FlightRecorderTests);
+    CPPUNIT_TEST(testRecordSize);
+    CPPUNIT_TEST(testReplayInterpolation);
+    CPPUNIT_TEST(testReplayWithoutLastFrame);
+    CPPUNIT_TEST(testReplayManySignals);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testRecordSize();
+    void testReplayInterpolation();
+    void testReplayWithoutLastFrame();
+    void testReplayManySignals();
+};
@@ -0,0 +1,263 @@
+/*
+ * SPDX-FileName: test_replayStore.cxx
+ * SPDX-FileComment: unit tests for the compressed in-memory replay store
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_replayStore.hxx"
+
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <Aircraft/replay-internal.hxx>
+#include <Aircraft/replay-store.hxx>
+
+namespace {
+
+const double FRAME_DT = 0.01;
+
+/* Makes frame <i> of a recording whose signals are a mix of constants,
+slowly changing values and noise, roughly like a real flight recorder
+record. */
+std::vector<char> makeRecord(int i, size_t size)
+{
+    std::vector<char> raw(size);
+    const size_t doubles = size / sizeof(double) / 2;
+    for (size_t j = 0; j < doubles; ++j) {
+        double d;
+        if (j % 3 == 0) {
+            d = 1000.0 + j;
+        } else if (j % 3 == 1) {
+            d = sin(i * 0.001 * j);
+        } else {
+            d = i * 0.5;
+        }
+        memcpy(&raw[j * sizeof(double)], &d, sizeof(d));
+    }
+    raw[size - 1] = static_cast<char>(i & 0xff);
+    return raw;
+}
+
+FGReplayData* makeFrame(int i, size_t size, std::deque<FGReplayData*>& recycler)
+{
+    FGReplayData* frame;
+    if (recycler.empty()) {
+        frame = new FGReplayData;
+    } else {
+        frame = recycler.front();
+        recycler.pop_front();
+    }
+    frame->sim_time = i * FRAME_DT;
+    frame->raw_data = makeRecord(i, size);
+    frame->multiplayer_messages.clear();
+    if (i % 7 == 0) {
+        frame->multiplayer_messages.push_back(std::make_shared<std::vector<char>>(10, 'a'));
+    }
+    return frame;
+}
+
+void deleteAll(std::deque<FGReplayData*>& recycler)
+{
+    for (auto frame : recycler) {
+        delete frame;
+    }
+    recycler.clear();
+}
+
+} // of anonymous namespace
+
+
+void ReplayStoreTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("replay-store");
+}
+
+void ReplayStoreTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void ReplayStoreTests::testRoundTrip()
+{
+    const size_t recordSize = 1024;
+    const int count = 1000;
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        for (int i = 0; i < count; ++i) {
+            store.push_back(makeFrame(i, recordSize, recycler), recycler);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(count), store.size());
+
+        for (int i = 0; i < count; ++i) {
+            CPPUNIT_ASSERT_EQUAL(i * FRAME_DT, store.sim_time(i));
+            CPPUNIT_ASSERT(store[i]->raw_data == makeRecord(i, recordSize));
+            CPPUNIT_ASSERT_EQUAL(i % 7 == 0, !store[i]->multiplayer_messages.empty());
+        }
+
+        // random access, alternating between far apart blocks
+        for (int k = 0; k < 200; ++k) {
+            const int i = (k * 7919) % count;
+            CPPUNIT_ASSERT(store[i]->raw_data == makeRecord(i, recordSize));
+        }
+
+        // the recording above compresses well
+        CPPUNIT_ASSERT(store.bytes() < count * recordSize / 2);
+
+        store.clear(recycler);
+        CPPUNIT_ASSERT(store.empty());
+    }
+    deleteAll(recycler);
+}
+
+void ReplayStoreTests::testLowerBound()
+{
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), store.lower_bound(1.0));
+
+        for (int i = 0; i < 500; ++i) {
+            store.push_back(makeFrame(i, 64, recycler), recycler);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), store.lower_bound(-1.0));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(124), store.lower_bound(1.235));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(499), store.lower_bound(4.985));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(500), store.lower_bound(10.0));
+
+        store.clear(recycler);
+    }
+    deleteAll(recycler);
+}
+
+void ReplayStoreTests::testPopFront()
+{
+    const size_t recordSize = 256;
+    const int count = 300;
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        FGReplayStore other;
+        for (int i = 0; i < count; ++i) {
+            store.push_back(makeFrame(i, recordSize, recycler), recycler);
+        }
+
+        // move the older half into another store, as decimation does
+        for (int i = 0; i < count / 2; ++i) {
+            FGReplayData* frame = store.pop_front(recycler);
+            CPPUNIT_ASSERT_EQUAL(i * FRAME_DT, frame->sim_time);
+            CPPUNIT_ASSERT(frame->raw_data == makeRecord(i, recordSize));
+            other.push_back(frame, recycler);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(count / 2), store.size());
+        CPPUNIT_ASSERT_EQUAL(count / 2 * FRAME_DT, store.sim_time(0));
+
+        for (int i = 0; i < count / 2; ++i) {
+            CPPUNIT_ASSERT(other[i]->raw_data == makeRecord(i, recordSize));
+            CPPUNIT_ASSERT(store[i]->raw_data == makeRecord(count / 2 + i, recordSize));
+        }
+
+        while (!store.empty()) {
+            recycler.push_back(store.pop_front(recycler));
+        }
+        other.clear(recycler);
+    }
+
+    // sealed frames are reused rather than leaked or duplicated
+    CPPUNIT_ASSERT(recycler.size() <= static_cast<size_t>(count + 2 * (FGReplayStore::s_block_frames + 1)));
+    deleteAll(recycler);
+}
+
+void ReplayStoreTests::testMultiplayerMessages()
+{
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        for (int i = 0; i < 200; ++i) {
+            store.push_back(makeFrame(i, 64, recycler), recycler);
+        }
+
+        // frame 1 is sealed and has no messages; decode its block first so
+        // that the change has to reach the cached copy
+        CPPUNIT_ASSERT(store[1]->multiplayer_messages.empty());
+        store.multiplayer_messages(1).push_back(std::make_shared<std::vector<char>>(3, 'b'));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), store[1]->multiplayer_messages.size());
+
+        // moving messages out, as MoveFrontMultiplayerPackets() does
+        auto& messages = store.multiplayer_messages(0);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), messages.size());
+        messages.clear();
+        CPPUNIT_ASSERT(store[0]->multiplayer_messages.empty());
+
+        FGReplayData* frame = store.pop_front(recycler);
+        CPPUNIT_ASSERT(frame->multiplayer_messages.empty());
+        recycler.push_back(frame);
+        frame = store.pop_front(recycler);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), frame->multiplayer_messages.size());
+        recycler.push_back(frame);
+
+        store.clear(recycler);
+    }
+    deleteAll(recycler);
+}
+
+void ReplayStoreTests::testVaryingRecordSize()
+{
+    // the record layout changes when a recording with a different signal
+    // set is loaded, or an aircraft adds signals
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        for (int i = 0; i < 300; ++i) {
+            const size_t size = (i / 50 % 2) ? 128 : 96;
+            store.push_back(makeFrame(i, size, recycler), recycler);
+        }
+        for (int i = 0; i < 300; ++i) {
+            const size_t size = (i / 50 % 2) ? 128 : 96;
+            CPPUNIT_ASSERT(store[i]->raw_data == makeRecord(i, size));
+        }
+        store.clear(recycler);
+    }
+    deleteAll(recycler);
+}
+
+// Records that are all zeros, or end in zeros, decode as a final run with no
+// literals.
+void ReplayStoreTests::testZeroRuns()
+{
+    const size_t recordSize = 128;
+    auto record = [recordSize](int i) {
+        std::vector<char> raw(recordSize, 0);
+        if (i % 3 == 1) {
+            raw[0] = static_cast<char>(i & 0x7f) | 1;
+            raw[1] = 2;
+        } else if (i % 3 == 2) {
+            raw[recordSize - 1] = 3;
+        }
+        return raw;
+    };
+
+    std::deque<FGReplayData*> recycler;
+    {
+        FGReplayStore store;
+        for (int i = 0; i < 300; ++i) {
+            FGReplayData* frame = makeFrame(i, recordSize, recycler);
+            frame->raw_data = record(i);
+            store.push_back(frame, recycler);
+        }
+
+        for (int i = 0; i < 300; ++i) {
+            CPPUNIT_ASSERT(store[i]->raw_data == record(i));
+        }
+
+        store.clear(recycler);
+    }
+    deleteAll(recycler);
+}
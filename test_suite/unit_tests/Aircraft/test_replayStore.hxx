@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileName: test_replayStore.hxx
+ * SPDX-FileComment: unit tests for the compressed in-memory replay store
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class ReplayStoreTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(ReplayStoreTests);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST(testLowerBound);
+    CPPUNIT_TEST(testPopFront);
+    CPPUNIT_TEST(testMultiplayerMessages);
+    CPPUNIT_TEST(testVaryingRecordSize);
+    CPPUNIT_TEST(testZeroRuns);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testRoundTrip();
+    void testLowerBound();
+    void testPopFront();
+    void testMultiplayerMessages();
+    void testVaryingRecordSize();
+    void testZeroRuns();
+};
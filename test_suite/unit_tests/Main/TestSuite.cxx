@@ -20,6 +20,7 @@
 #include "test_autosaveMigration.hxx"
 #include "test_commands.hxx"
 #include "test_posinit.hxx"
+#include "test_spscQueue.hxx"
 #include "test_timeManager.hxx"
 
 // Set up the unit tests.
@@ -27,3 +28,4 @@ CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(AutosaveMigrationTests, "Unit tests");
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(PosInitTests, "Unit tests");
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(TimeManagerTests, "Unit tests");
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(CommandsTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(SPSCQueueTests, "Unit tests");
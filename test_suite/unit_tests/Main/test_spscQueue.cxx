@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileName: test_spscQueue.cxx
+ * SPDX-FileComment: unit tests for the lock-free SPSC queue
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_spscQueue.hxx"
+
+#include <memory>
+#include <thread>
+
+#include <Main/SPSCQueue.hxx>
+
+using namespace flightgear;
+
+void SPSCQueueTests::testFifoAndCapacity()
+{
+    SPSCQueue<std::unique_ptr<int>> queue(5);
+    CPPUNIT_ASSERT_EQUAL(size_t(8), queue.capacity());
+    CPPUNIT_ASSERT(queue.empty());
+
+    std::unique_ptr<int> value;
+    CPPUNIT_ASSERT(!queue.pop(value));
+
+    for (int i = 0; i < 8; ++i) {
+        CPPUNIT_ASSERT(queue.push(std::make_unique<int>(i)));
+    }
+
+    // full: the value must be left untouched
+    auto extra = std::make_unique<int>(99);
+    CPPUNIT_ASSERT(!queue.push(std::move(extra)));
+    CPPUNIT_ASSERT(extra);
+
+    // wrap around the end of the ring
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            CPPUNIT_ASSERT(queue.pop(value));
+            CPPUNIT_ASSERT_EQUAL(round * 8 + i, *value);
+            CPPUNIT_ASSERT(queue.push(std::make_unique<int>((round + 1) * 8 + i)));
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        CPPUNIT_ASSERT(queue.pop(value));
+    }
+    CPPUNIT_ASSERT(queue.empty());
+    CPPUNIT_ASSERT(!queue.pop(value));
+}
+
+void SPSCQueueTests::testTwoThreads()
+{
+    const int count = 200000;
+    SPSCQueue<int> queue(64);
+
+    std::thread producer([&queue, count]() {
+        for (int i = 0; i < count;) {
+            if (queue.push(int(i))) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool inOrder = true;
+    while (expected < count) {
+        int value;
+        if (queue.pop(value)) {
+            inOrder &= (value == expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    CPPUNIT_ASSERT(inOrder);
+    CPPUNIT_ASSERT(queue.empty());
+}
@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileName: test_spscQueue.hxx
+ * SPDX-FileComment: unit tests for the lock-free SPSC queue
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class SPSCQueueTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(SPSCQueueTests);
+    CPPUNIT_TEST(testFifoAndCapacity);
+    CPPUNIT_TEST(testTwoThreads);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // The tests.
+    void testFifoAndCapacity();
+    void testTwoThreads();
+};
@@ -365,6 +365,62 @@ void FlightplanTests::testRoutePathTrivialFlightPlan()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(19.5, fp1->totalDistanceNm(), 0.1);
 }
 
+void FlightplanTests::testRoutePathIncremental()
+{
+    FlightPlanRef fp1 = makeTestFP("EGHI"s, "20"s, "EDDM"s, "08L"s,
+                                   "SFD LYD BNE CIV ELLX LUX SAA KRH WLD"s);
+
+    // the owned path must match a freshly computed one after each change
+    auto checkMatchesFresh = [&fp1]() {
+        const RoutePath& cached = fp1->routePath();
+        RoutePath fresh(fp1);
+        const int legCount = fp1->numLegs();
+        for (int leg = 0; leg < legCount; ++leg) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(fresh.trackForIndex(leg), cached.trackForIndex(leg), 1e-9);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(fresh.distanceForIndex(leg), cached.distanceForIndex(leg), 1e-6);
+            CPPUNIT_ASSERT_EQUAL(fresh.pathForIndex(leg).size(), cached.pathForIndex(leg).size());
+
+            const double d = SGGeodesy::distanceM(fresh.positionForDistanceFrom(leg, 5000.0),
+                                                  cached.positionForDistanceFrom(leg, 5000.0));
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, d, 0.01);
+        }
+
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(fresh.distanceBetweenIndices(0, legCount - 1),
+                                     cached.distanceBetweenIndices(0, legCount - 1), 1e-3);
+    };
+
+    checkMatchesFresh();
+
+    // insert in the middle, and at both ends
+    fp1->insertWayptAtIndex(new BasicWaypt(SGGeod::fromDeg(3.0, 50.5), "MID1"s, fp1), 5);
+    checkMatchesFresh();
+    fp1->insertWayptAtIndex(new BasicWaypt(SGGeod::fromDeg(-1.5, 50.9), "START"s, fp1), 1);
+    checkMatchesFresh();
+    fp1->insertWayptAtIndex(new BasicWaypt(SGGeod::fromDeg(11.5, 48.4), "END"s, fp1), -1);
+    checkMatchesFresh();
+
+    // deletions
+    fp1->deleteIndex(5);
+    checkMatchesFresh();
+    fp1->deleteIndex(3);
+    checkMatchesFresh();
+
+    // a waypoint converted to a hold in place
+    CPPUNIT_ASSERT(fp1->legAtIndex(4)->setHoldCount(2));
+    checkMatchesFresh();
+
+    // several removals notified together
+    fp1->legAtIndex(2)->waypoint()->setFlag(WPT_PSEUDO);
+    fp1->legAtIndex(6)->waypoint()->setFlag(WPT_PSEUDO);
+    CPPUNIT_ASSERT_EQUAL(2, fp1->clearWayptsWithFlag(WPT_PSEUDO));
+    checkMatchesFresh();
+
+    // modified in place, without going through the leg
+    fp1->routePath();
+    fp1->legAtIndex(3)->waypoint()->setFlag(WPT_OVERFLIGHT);
+    checkMatchesFresh();
+}
+
 void FlightplanTests::testRoutePathVec()
 {
     FlightPlanRef fp1 = makeTestFP("KNUQ"s, "14L"s, "PHNL"s, "22R"s,
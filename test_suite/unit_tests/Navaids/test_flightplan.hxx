@@ -35,6 +35,7 @@ class FlightplanTests : public CppUnit::TestFixture
     CPPUNIT_TEST(testRoutePathBasic);
     CPPUNIT_TEST(testRoutePathSkipped);
     CPPUNIT_TEST(testRoutePathTrivialFlightPlan);
+    CPPUNIT_TEST(testRoutePathIncremental);
     CPPUNIT_TEST(testBasicAirways);
     CPPUNIT_TEST(testAirwayNetworkRoute);
     CPPUNIT_TEST(testBug1814);
@@ -104,6 +105,7 @@ public:
     void loadFGFPAsRoute();
     void testLoadSaveBetweenRestriction();
     void testRestrictionUnits();
+    void testRoutePathIncremental();
 };
 
 #endif  // FG_FLIGHTPLAN_UNIT_TESTS_HXX
@@ -489,3 +489,32 @@ void FPNasalTests::testTotalDistanceAPI()
     auto fp = rm->flightPlan();
     CPPUNIT_ASSERT_DOUBLES_EQUAL(fp->totalDistanceNm(), 1025.9, 0.1);
 }
+
+void FPNasalTests::testModifySharedWaypoint()
+{
+    FlightPlanRef fp1 = makeTestFP("EGCC", "23L", "EHAM", "24",
+                                   "TNT CLN");
+    auto rm = globals->get_subsystem<FGRouteMgr>();
+    rm->setFlightPlan(fp1);
+    rm->activate();
+
+    // the waypoint ghost and the leg share the waypoint, which has no owner
+    bool ok = FGTestApi::executeNasal(R"(
+        var fp = flightplan();
+        var wp = createWP(52.9, -0.5, 'SHARED');
+        fp.insertWP(wp, 2);
+        fp.getWP(2).path(); # computes the route path
+        wp.fly_type = 'flyOver';
+    )");
+    CPPUNIT_ASSERT(ok);
+
+    CPPUNIT_ASSERT(fp1->legAtIndex(2)->waypoint()->flag(WPT_OVERFLIGHT));
+
+    // the owned path must not be stale
+    const RoutePath& cached = fp1->routePath();
+    RoutePath fresh(fp1);
+    for (int leg = 0; leg < fp1->numLegs(); ++leg) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(fresh.distanceForIndex(leg), cached.distanceForIndex(leg), 1e-6);
+        CPPUNIT_ASSERT_EQUAL(fresh.pathForIndex(leg).size(), cached.pathForIndex(leg).size());
+    }
+}
@@ -38,6 +38,7 @@ class FPNasalTests : public CppUnit::TestFixture
     CPPUNIT_TEST(testApproachTransitionAPIWithCloning);
     CPPUNIT_TEST(testAirwaysAPI);
     CPPUNIT_TEST(testTotalDistanceAPI);
+    CPPUNIT_TEST(testModifySharedWaypoint);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -58,4 +59,5 @@ public:
     void testApproachTransitionAPIWithCloning();
     void testAirwaysAPI();
     void testTotalDistanceAPI();
+    void testModifySharedWaypoint();
 };
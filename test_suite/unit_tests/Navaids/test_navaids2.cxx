@@ -1,9 +1,17 @@
 #include "test_navaids2.hxx"
 
+#include <algorithm>
+
 #include "test_suite/FGTestApi/testGlobals.hxx"
 #include "test_suite/FGTestApi/NavDataCache.hxx"
 
+#include <simgear/constants.h>
+
+#include <Airports/airport.hxx>
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
 #include <Navaids/NavDataCache.hxx>
+#include <Navaids/PositionedOctree.hxx>
 #include <Navaids/navrecord.hxx>
 #include <Navaids/navlist.hxx>
 
@@ -34,3 +42,164 @@ void NavaidsTests::testBasic()
     CPPUNIT_ASSERT_EQUAL(tla->get_freq(), 11570);
     CPPUNIT_ASSERT_EQUAL(tla->get_range(), 130);
 }
+
+
+void NavaidsTests::testLookupIndices()
+{
+    auto cache = flightgear::NavDataCache::instance();
+    SGGeod egccPos = SGGeod::fromDeg(-2.27, 53.35);
+
+    // nearest first, whatever the filter range
+    FGPositioned::TypeFilter vorFilter(FGPositioned::VOR);
+    auto ids = cache->findNavaidsByFreq(11570, egccPos, &vorFilter);
+    CPPUNIT_ASSERT(!ids.empty());
+    CPPUNIT_ASSERT(FGPositioned::loadById<FGPositioned>(ids.front())->ident() == "TNT");
+
+    SGVec3d cart = SGVec3d::fromGeod(egccPos);
+    for (size_t i = 1; i < ids.size(); ++i) {
+        CPPUNIT_ASSERT(distSqr(cart, FGPositioned::loadById<FGPositioned>(ids[i - 1])->cart()) <=
+                       distSqr(cart, FGPositioned::loadById<FGPositioned>(ids[i])->cart()));
+    }
+
+    // the position-less variant returns the same set
+    auto unordered = cache->findNavaidsByFreq(11570, &vorFilter);
+    std::sort(ids.begin(), ids.end());
+    CPPUNIT_ASSERT(ids == unordered);
+
+    FGAirportRef egcc = FGAirport::findByIdent("EGCC");
+    CPPUNIT_ASSERT_EQUAL(egcc->getRunwayByIdent("23R")->guid(),
+                         cache->airportItemWithIdent(egcc->guid(), FGPositioned::RUNWAY, "23R"));
+    CPPUNIT_ASSERT_EQUAL(PositionedID(0), cache->airportItemWithIdent(egcc->guid(), FGPositioned::RUNWAY, "18"));
+
+    CPPUNIT_ASSERT(fgGetInt("/sim/navdb/stats/index-builds") >= 1);
+    CPPUNIT_ASSERT(fgGetInt("/sim/navdb/stats/index-hits") >= 4);
+
+    // user waypoints aren't indexed, so creating them at runtime doesn't
+    // force a rebuild
+    const int builds = fgGetInt("/sim/navdb/stats/index-builds");
+    FGPositionedRef wpt = FGPositioned::createUserWaypoint("TESTWP", egccPos);
+    CPPUNIT_ASSERT(wpt);
+    CPPUNIT_ASSERT(!cache->findNavaidsByFreq(11570, egccPos, &vorFilter).empty());
+    CPPUNIT_ASSERT(FGPositioned::deleteUserWaypoint("TESTWP"));
+    CPPUNIT_ASSERT_EQUAL(egcc->getRunwayByIdent("23R")->guid(),
+                         cache->airportItemWithIdent(egcc->guid(), FGPositioned::RUNWAY, "23R"));
+    CPPUNIT_ASSERT_EQUAL(builds, fgGetInt("/sim/navdb/stats/index-builds"));
+
+    // lookups the indices don't cover are counted as misses
+    const int misses = fgGetInt("/sim/navdb/stats/index-misses");
+    cache->airportItemWithIdent(egcc->guid(), FGPositioned::FREQ_TOWER, "");
+    CPPUNIT_ASSERT_EQUAL(misses + 1, fgGetInt("/sim/navdb/stats/index-misses"));
+
+    // the statistics move to the new property tree after a reset
+    const int hits = fgGetInt("/sim/navdb/stats/index-hits");
+    globals->resetPropertyRoot();
+    cache->resetStatisticsProperties();
+    CPPUNIT_ASSERT_EQUAL(hits, fgGetInt("/sim/navdb/stats/index-hits"));
+    cache->findNavaidsByFreq(11570, &vorFilter);
+    CPPUNIT_ASSERT_EQUAL(hits + 1, fgGetInt("/sim/navdb/stats/index-hits"));
+}
+
+
+void NavaidsTests::testOctreeSnapshot()
+{
+    using namespace flightgear;
+
+    SGGeod egccPos = SGGeod::fromDeg(-2.27, 53.35);
+    FGPositioned::TypeFilter filter({FGPositioned::AIRPORT, FGPositioned::NDB, FGPositioned::VOR});
+
+    CPPUNIT_ASSERT(Octree::activeSnapshot());
+    auto nearest = FGPositioned::findClosestN(egccPos, 20, 200.0, &filter);
+    auto inRange = FGPositioned::findWithinRange(egccPos, 50.0, &filter);
+    CPPUNIT_ASSERT_EQUAL(size_t(20), nearest.size());
+    CPPUNIT_ASSERT(!inRange.empty());
+
+    // the same searches through the lazily loaded tree
+    Octree::invalidateSnapshot();
+    CPPUNIT_ASSERT(!Octree::activeSnapshot());
+    auto nearestTree = FGPositioned::findClosestN(egccPos, 20, 200.0, &filter);
+    auto inRangeTree = FGPositioned::findWithinRange(egccPos, 50.0, &filter);
+
+    CPPUNIT_ASSERT_EQUAL(nearestTree.size(), nearest.size());
+    for (size_t i = 0; i < nearest.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(nearestTree[i]->guid(), nearest[i]->guid());
+    }
+
+    CPPUNIT_ASSERT_EQUAL(inRangeTree.size(), inRange.size());
+    for (size_t i = 0; i < inRange.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(inRangeTree[i]->guid(), inRange[i]->guid());
+    }
+
+    // written on first use, so the next run maps it instead
+    auto cache = NavDataCache::instance();
+    Octree::discardSnapshot();
+    CPPUNIT_ASSERT(Octree::FlatSnapshot::load(cache->octreeSnapshotPath(), cache->octreeGeneration()));
+
+    // user waypoints created at runtime go into the snapshot's overlay
+    Octree::discardSnapshot();
+    CPPUNIT_ASSERT(Octree::activeSnapshot());
+    FGPositioned::TypeFilter waypoints(FGPositioned::WAYPOINT);
+    FGPositionedRef wpt = FGPositioned::createUserWaypoint("SNAPWP", egccPos);
+    CPPUNIT_ASSERT(Octree::activeSnapshot());
+    auto found = FGPositioned::findWithinRange(egccPos, 1.0, &waypoints);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), found.size());
+    CPPUNIT_ASSERT_EQUAL(wpt->guid(), found.front()->guid());
+    CPPUNIT_ASSERT_EQUAL(wpt->guid(), FGPositioned::findClosest(egccPos, 1.0, &waypoints)->guid());
+
+    CPPUNIT_ASSERT(FGPositioned::deleteUserWaypoint("SNAPWP"));
+    CPPUNIT_ASSERT(Octree::activeSnapshot());
+    CPPUNIT_ASSERT(FGPositioned::findWithinRange(egccPos, 1.0, &waypoints).empty());
+
+    // the snapshot on disk is outdated once per run, not per waypoint...
+    const int64_t generation = cache->octreeGeneration();
+    FGPositionedRef wpt2 = FGPositioned::createUserWaypoint("SNAPWP2", egccPos);
+    CPPUNIT_ASSERT_EQUAL(generation, cache->octreeGeneration());
+    CPPUNIT_ASSERT(!Octree::FlatSnapshot::load(cache->octreeSnapshotPath(), generation));
+
+    // ...and written back with the overlay when the cache is closed
+    Octree::saveSnapshot();
+    auto saved = Octree::FlatSnapshot::load(cache->octreeSnapshotPath(), generation);
+    CPPUNIT_ASSERT(saved);
+    FGPositionedList savedFound;
+    saved->findAllWithinRange(SGVec3d::fromGeod(egccPos), 1.0 * SG_NM_TO_METER, &waypoints, savedFound, 0xffffff);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), savedFound.size());
+    CPPUNIT_ASSERT_EQUAL(wpt2->guid(), savedFound.front()->guid());
+    CPPUNIT_ASSERT(FGPositioned::deleteUserWaypoint("SNAPWP2"));
+}
+
+void NavaidsTests::testBatchRangeSearch()
+{
+    using namespace flightgear;
+
+    SGGeod egccPos = SGGeod::fromDeg(-2.27, 53.35);
+    SGGeod egllPos = SGGeod::fromDeg(-0.46, 51.47);
+    FGPositioned::TypeFilter airports(FGPositioned::AIRPORT);
+    FGPositioned::TypeFilter navaids({FGPositioned::NDB, FGPositioned::VOR});
+
+    std::vector<FGPositioned::RangeQuery> queries = {
+        {egccPos, 40.0, &airports},
+        {egccPos, 60.0, &navaids},
+        {egllPos, 30.0, &navaids}};
+
+    auto checkBatch = [&]() {
+        FGPositioned::BatchResults results;
+        CPPUNIT_ASSERT(!FGPositioned::findWithinRangeBatch(queries, results));
+        CPPUNIT_ASSERT_EQUAL(queries.size() + 1, results.offsets.size());
+
+        for (size_t q = 0; q < queries.size(); ++q) {
+            auto single = FGPositioned::findWithinRange(queries[q].pos, queries[q].rangeNm, queries[q].filter);
+            CPPUNIT_ASSERT(!single.empty());
+            CPPUNIT_ASSERT_EQUAL(single.size(), results.count(q));
+            auto it = results.begin(q);
+            for (const auto& p : single) {
+                CPPUNIT_ASSERT_EQUAL(p->guid(), (*it++)->guid());
+            }
+        }
+    };
+
+    CPPUNIT_ASSERT(Octree::activeSnapshot());
+    checkBatch();
+
+    // and without the snapshot, one search per query
+    Octree::invalidateSnapshot();
+    checkBatch();
+}
@@ -5,12 +5,26 @@
 
 #include "config.h"
 
+#include "test_generic.hxx"
+#include "test_ioWorker.hxx"
+#include "test_messagePack.hxx"
+#include "test_mirrorWebsocket.hxx"
+#include "test_propertyChangeObserver.hxx"
+#include "test_propertyStreamWebsocket.hxx"
+
+// Set up the unit tests.
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(GenericProtocolTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IOWorkerTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(MessagePackTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(MirrorWebsocketTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(PropertyChangeObserverTests, "Unit tests");
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(PropertyStreamWebsocketTests, "Unit tests");
+
 #if defined(ENABLE_SWIFT)
 
 #include "test_swiftAircraftManager.hxx"
 #include "test_swiftService.hxx"
 
-// Set up the unit tests.
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(SwiftAircraftManagerTest, "Unit tests");
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(SwiftServiceTest, "Unit tests");
 
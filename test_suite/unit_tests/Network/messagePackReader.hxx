@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileName: messagePackReader.hxx
+ * SPDX-FileComment: MessagePack decoding for the websocket unit tests
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <cppunit/TestAssert.h>
+
+namespace MessagePackTest {
+
+struct Value {
+    enum Kind { NIL, BOOL, NUMBER, STRING } kind = NIL;
+    double number = 0.0;
+    std::string string;
+};
+
+// Just enough MessagePack decoding for the mirror and stream frames.
+class Reader
+{
+public:
+    explicit Reader(const std::string& data) : _data(data) {}
+
+    int arrayHeader()
+    {
+        const uint8_t tag = byte();
+        if ((tag & 0xf0) == 0x90) return tag & 0x0f;
+        if (tag == 0xdc) return static_cast<int>(bigEndian(2));
+        if (tag == 0xdd) return static_cast<int>(bigEndian(4));
+        CPPUNIT_FAIL("expected an array");
+        return 0;
+    }
+
+    Value value()
+    {
+        Value v;
+        const uint8_t tag = byte();
+        v.kind = Value::NUMBER;
+        if (tag < 0x80) {
+            v.number = tag;
+        } else if (tag >= 0xe0) {
+            v.number = static_cast<int8_t>(tag);
+        } else if ((tag & 0xe0) == 0xa0) {
+            v = string(tag & 0x1f);
+        } else {
+            switch (tag) {
+            case 0xc0: v.kind = Value::NIL; break;
+            case 0xc2: v.kind = Value::BOOL; v.number = 0; break;
+            case 0xc3: v.kind = Value::BOOL; v.number = 1; break;
+            case 0xcc: v.number = bigEndian(1); break;
+            case 0xcd: v.number = bigEndian(2); break;
+            case 0xce: v.number = bigEndian(4); break;
+            case 0xcf: v.number = bigEndian(8); break;
+            case 0xd0: v.number = static_cast<int8_t>(bigEndian(1)); break;
+            case 0xd1: v.number = static_cast<int16_t>(bigEndian(2)); break;
+            case 0xd2: v.number = static_cast<int32_t>(bigEndian(4)); break;
+            case 0xd3: v.number = static_cast<int64_t>(bigEndian(8)); break;
+            case 0xca: {
+                const uint32_t bits = static_cast<uint32_t>(bigEndian(4));
+                float f;
+                memcpy(&f, &bits, sizeof(f));
+                v.number = f;
+                break;
+            }
+            case 0xcb: {
+                const uint64_t bits = bigEndian(8);
+                memcpy(&v.number, &bits, sizeof(bits));
+                break;
+            }
+            case 0xd9: v = string(bigEndian(1)); break;
+            case 0xda: v = string(bigEndian(2)); break;
+            case 0xdb: v = string(bigEndian(4)); break;
+            default:
+                CPPUNIT_FAIL("unexpected MessagePack tag");
+            }
+        }
+        return v;
+    }
+
+    bool atEnd() const { return _pos == _data.size(); }
+
+private:
+    uint8_t byte()
+    {
+        CPPUNIT_ASSERT(_pos < _data.size());
+        return static_cast<uint8_t>(_data[_pos++]);
+    }
+
+    uint64_t bigEndian(int bytes)
+    {
+        uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) {
+            v = (v << 8) | byte();
+        }
+        return v;
+    }
+
+    Value string(size_t len)
+    {
+        CPPUNIT_ASSERT(_pos + len <= _data.size());
+        Value v;
+        v.kind = Value::STRING;
+        v.string = _data.substr(_pos, len);
+        _pos += len;
+        return v;
+    }
+
+    const std::string& _data;
+    size_t _pos = 0;
+};
+
+} // namespace MessagePackTest
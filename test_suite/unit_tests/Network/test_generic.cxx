@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileName: test_generic.cxx
+ * SPDX-FileComment: unit tests and benchmark for the binary generic protocol
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_generic.hxx"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/timing/timestamp.hxx>
+
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
+#include <Network/generic.hxx>
+
+namespace {
+
+const char* const NODES[] = {"int", "bool", "float", "double", "fixed",
+                             "byte", "word", "scaled", "clipped"};
+
+// Protocol/generic-plan.xml has a fixed layout and is compiled, while the
+// same chunks followed by a string in generic-plan-string.xml are
+// interpreted chunk by chunk.
+std::unique_ptr<FGGeneric> makeGeneric(const std::string& protocol)
+{
+    std::unique_ptr<FGGeneric> generic(new FGGeneric({"generic", "file", "bi", "10", "unused", protocol}));
+    CPPUNIT_ASSERT(generic->getInitOk());
+    return generic;
+}
+
+void setValues(double x)
+{
+    fgSetInt("/test/generic/int", static_cast<int>(-123456 * x));
+    fgSetBool("/test/generic/bool", x > 0.5);
+    fgSetFloat("/test/generic/float", static_cast<float>(3.25 * x));
+    fgSetDouble("/test/generic/double", -1.0e6 * x);
+    fgSetDouble("/test/generic/fixed", 12.5 * x);
+    fgSetInt("/test/generic/byte", static_cast<int>(-100 * x));
+    fgSetInt("/test/generic/word", static_cast<int>(-30000 * x));
+    fgSetDouble("/test/generic/scaled", 7.0 * x);
+    fgSetDouble("/test/generic/clipped", 4.0 * x - 2.0);
+    fgSetString("/test/generic/string", "abc");
+}
+
+std::vector<std::string> values()
+{
+    std::vector<std::string> result;
+    for (auto node : NODES) {
+        result.push_back(fgGetString(std::string("/test/generic/") + node));
+    }
+    return result;
+}
+
+} // of anonymous namespace
+
+void GenericProtocolTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("generic");
+    globals->append_data_path(SGPath::fromUtf8(FG_TEST_SUITE_DATA), false);
+}
+
+void GenericProtocolTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void GenericProtocolTests::testEncodeMatches()
+{
+    auto compiled = makeGeneric("generic-plan");
+    auto interpreted = makeGeneric("generic-plan-string");
+
+    for (double x : {0.0, 0.3, 0.7, 1.0, -0.9}) {
+        setValues(x);
+        std::string a, b;
+        CPPUNIT_ASSERT(compiled->gen_output(a));
+        CPPUNIT_ASSERT(interpreted->gen_output(b));
+
+        // 4 + 1 + 4 + 8 + 4 + 1 + 2 + 4 + 4 bytes
+        CPPUNIT_ASSERT_EQUAL(size_t(32), a.size());
+        CPPUNIT_ASSERT(b.size() > a.size());
+        CPPUNIT_ASSERT(a == b.substr(0, a.size()));
+    }
+
+    // network byte order by default
+    fgSetInt("/test/generic/int", 0x01020304);
+    std::string a;
+    compiled->gen_output(a);
+    CPPUNIT_ASSERT_EQUAL(std::string("\x01\x02\x03\x04"), a.substr(0, 4));
+}
+
+void GenericProtocolTests::testDecodeMatches()
+{
+    auto compiled = makeGeneric("generic-plan");
+    auto interpreted = makeGeneric("generic-plan-string");
+
+    for (double x : {0.0, 0.3, 0.7, 1.0, -0.9}) {
+        setValues(x);
+        std::string record;
+        compiled->gen_output(record);
+
+        setValues(0.5);
+        CPPUNIT_ASSERT(compiled->apply_input(record));
+        const auto a = values();
+
+        setValues(0.5);
+        CPPUNIT_ASSERT(interpreted->apply_input(record));
+        const auto b = values();
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(NODES[i], b[i], a[i]);
+        }
+    }
+
+    // min and max still apply
+    setValues(1.0);
+    std::string record;
+    compiled->gen_output(record);
+    compiled->apply_input(record);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fgGetDouble("/test/generic/clipped"), 1e-6);
+}
+
+void GenericProtocolTests::testBenchmark()
+{
+    const int records = 100000;
+    auto compiled = makeGeneric("generic-plan");
+    auto interpreted = makeGeneric("generic-plan-string");
+    setValues(0.7);
+
+    std::string record;
+    compiled->gen_output(record);
+
+    auto run = [&](FGGeneric* generic) {
+        std::string out;
+        SGTimeStamp st;
+        st.stamp();
+        for (int i = 0; i < records; ++i) {
+            generic->gen_output(out);
+            generic->apply_input(record);
+        }
+        return st.elapsedUSec();
+    };
+
+    const auto compiledUSec = run(compiled.get());
+    const auto interpretedUSec = run(interpreted.get());
+    std::cout << "generic binary, " << records << " records of 9 chunks encoded and decoded: "
+              << "interpreted " << interpretedUSec << "us, compiled " << compiledUSec << "us" << std::endl;
+}
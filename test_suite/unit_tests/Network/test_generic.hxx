@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileName: test_generic.hxx
+ * SPDX-FileComment: unit tests and benchmark for the binary generic protocol
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class GenericProtocolTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(GenericProtocolTests);
+    CPPUNIT_TEST(testEncodeMatches);
+    CPPUNIT_TEST(testDecodeMatches);
+    CPPUNIT_TEST(testBenchmark);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testEncodeMatches();
+    void testDecodeMatches();
+    void testBenchmark();
+};
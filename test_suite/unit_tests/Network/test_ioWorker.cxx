@@ -0,0 +1,257 @@
+/*
+ * SPDX-FileName: test_ioWorker.cxx
+ * SPDX-FileComment: unit tests for the asynchronous I/O channel worker
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_ioWorker.hxx"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include <simgear/props/props.hxx>
+#include <simgear/timing/timestamp.hxx>
+
+#include <Network/IOWorker.hxx>
+#include <Network/protocol.hxx>
+
+namespace {
+
+// A channel on a slow device: every transfer blocks for a while.
+class SlowProtocol : public FGProtocol
+{
+public:
+    SlowProtocol(const std::string& direction, int transferMSec) :
+        _transferMSec(transferMSec)
+    {
+        set_direction(direction);
+        set_hz(50);
+    }
+
+    bool supports_async() const override { return true; }
+
+    bool gen_output(std::string& out) override
+    {
+        out = std::to_string(_generated++);
+        return true;
+    }
+
+    bool transfer(const std::string& out, std::vector<std::string>& in) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(_transferMSec));
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!out.empty()) {
+            _written.push_back(out);
+        }
+        if (get_direction() == SG_IO_IN) {
+            in.push_back(std::to_string(_read++));
+        }
+        return true;
+    }
+
+    bool apply_input(const std::string& in) override
+    {
+        _applied.push_back(in);
+        return true;
+    }
+
+    std::vector<std::string> written()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _written;
+    }
+
+    std::vector<std::string> _applied;
+
+private:
+    const int _transferMSec;
+    int _generated = 0;
+    int _read = 0;
+    std::mutex _mutex;
+    std::vector<std::string> _written;
+};
+
+// A channel on a quiet device: reading blocks until the channel is closed.
+class BlockingProtocol : public FGProtocol
+{
+public:
+    BlockingProtocol()
+    {
+        set_direction("in");
+        set_hz(50);
+        set_enabled(true);
+    }
+
+    bool supports_async() const override { return true; }
+
+    bool transfer(const std::string&, std::vector<std::string>&) override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _closed.wait(lock, [this] { return !is_enabled(); });
+        return false;
+    }
+
+    bool close() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        set_enabled(false);
+        _closed.notify_all();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _closed;
+};
+
+#if !defined(_WIN32)
+// A channel on a quiet device: reading blocks in the system call.
+class QuietPipeProtocol : public FGProtocol
+{
+public:
+    explicit QuietPipeProtocol(int fd) : _fd(fd)
+    {
+        set_direction("in");
+        set_hz(50);
+        set_enabled(true);
+    }
+
+    bool supports_async() const override { return true; }
+
+    bool transfer(const std::string&, std::vector<std::string>& in) override
+    {
+        char c;
+        if (::read(_fd, &c, 1) != 1) {
+            return false;
+        }
+        in.emplace_back(1, c);
+        return true;
+    }
+
+private:
+    const int _fd;
+};
+#endif
+
+} // of anonymous namespace
+
+// The main loop hands the output over without waiting for the device.
+void IOWorkerTests::testSlowOutput()
+{
+    SlowProtocol protocol("out", 20);
+    FGIOWorker worker(&protocol);
+    worker.start();
+
+    SGTimeStamp st;
+    st.stamp();
+    for (int i = 0; i < 10; ++i) {
+        worker.exchange();
+    }
+    // writing synchronously would have taken 200ms
+    CPPUNIT_ASSERT(st.elapsedMSec() < 100);
+
+    for (int wait = 0; (wait < 100) && (protocol.written().size() < 10); ++wait) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    worker.stop();
+    worker.join();
+
+    const auto written = protocol.written();
+    CPPUNIT_ASSERT_EQUAL(size_t(10), written.size());
+    for (int i = 0; i < 10; ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::to_string(i), written[i]);
+    }
+
+    SGPropertyNode_ptr stats(new SGPropertyNode);
+    worker.publishStats(stats);
+    CPPUNIT_ASSERT(stats->getBoolValue("async"));
+    CPPUNIT_ASSERT_EQUAL(0, stats->getIntValue("dropped"));
+    // the queued messages waited for the device
+    CPPUNIT_ASSERT(stats->getDoubleValue("tx-latency-max-ms") >= 20.0);
+}
+
+// Input is read at the channel rate, and applied in order on the main loop.
+void IOWorkerTests::testInput()
+{
+    SlowProtocol protocol("in", 1);
+    FGIOWorker worker(&protocol);
+    worker.start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    worker.exchange();
+    worker.stop();
+    worker.join();
+
+    // 50 Hz for 200ms, give or take the scheduling
+    CPPUNIT_ASSERT(protocol._applied.size() >= 5);
+    CPPUNIT_ASSERT(protocol._applied.size() <= 12);
+    for (size_t i = 0; i < protocol._applied.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(std::to_string(i), protocol._applied[i]);
+    }
+
+    SGPropertyNode_ptr stats(new SGPropertyNode);
+    worker.publishStats(stats);
+    CPPUNIT_ASSERT_EQUAL(0, stats->getIntValue("errors"));
+    CPPUNIT_ASSERT(stats->getDoubleValue("rx-latency-max-ms") > 0.0);
+}
+
+// A worker blocked in the channel only exits once the channel is closed.
+void IOWorkerTests::testBlockedStop()
+{
+    BlockingProtocol protocol;
+    FGIOWorker worker(&protocol);
+    worker.start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    worker.stop();
+    CPPUNIT_ASSERT(!worker.waitForExit(std::chrono::milliseconds(50)));
+
+    protocol.close();
+    CPPUNIT_ASSERT(worker.waitForExit(std::chrono::milliseconds(5000)));
+    worker.join();
+}
+
+// A worker blocked in a system call of the channel is woken without closing
+// the channel, which stays usable.
+void IOWorkerTests::testInterrupt()
+{
+#if !defined(_WIN32)
+    int fds[2];
+    CPPUNIT_ASSERT_EQUAL(0, pipe(fds));
+
+    QuietPipeProtocol protocol(fds[0]);
+    FGIOWorker worker(&protocol);
+    worker.start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    worker.stop();
+    CPPUNIT_ASSERT(!worker.waitForExit(std::chrono::milliseconds(50)));
+
+    bool exited = false;
+    for (int i = 0; (i < 50) && !exited; ++i) {
+        worker.interrupt();
+        exited = worker.waitForExit(std::chrono::milliseconds(100));
+    }
+    CPPUNIT_ASSERT(exited);
+    worker.join();
+
+    CPPUNIT_ASSERT_EQUAL(ssize_t(1), write(fds[1], "x", 1));
+    char c = 0;
+    CPPUNIT_ASSERT_EQUAL(ssize_t(1), read(fds[0], &c, 1));
+    CPPUNIT_ASSERT_EQUAL('x', c);
+
+    close(fds[0]);
+    close(fds[1]);
+#endif
+}
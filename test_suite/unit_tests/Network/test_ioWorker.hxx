@@ -0,0 +1,30 @@
+/*
+ * SPDX-FileName: test_ioWorker.hxx
+ * SPDX-FileComment: unit tests for the asynchronous I/O channel worker
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class IOWorkerTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(IOWorkerTests);
+    CPPUNIT_TEST(testSlowOutput);
+    CPPUNIT_TEST(testInput);
+    CPPUNIT_TEST(testBlockedStop);
+    CPPUNIT_TEST(testInterrupt);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // The tests.
+    void testSlowOutput();
+    void testInput();
+    void testBlockedStop();
+    void testInterrupt();
+};
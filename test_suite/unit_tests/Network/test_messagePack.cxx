@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileName: test_messagePack.cxx
+ * SPDX-FileComment: unit tests for the MessagePack encoder of the property stream
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_messagePack.hxx"
+
+#include <cstdint>
+#include <string>
+
+#include <Network/http/MessagePack.hxx>
+
+using flightgear::http::MessagePackWriter;
+
+namespace {
+
+std::string bytes(std::initializer_list<uint8_t> b)
+{
+    return std::string(b.begin(), b.end());
+}
+
+template <typename F>
+std::string encode(F f)
+{
+    MessagePackWriter w;
+    f(w);
+    return w.data();
+}
+
+} // of anonymous namespace
+
+// The expected encodings are from the MessagePack specification.
+void MessagePackTests::testIntegers()
+{
+    CPPUNIT_ASSERT(bytes({0x00}) == encode([](MessagePackWriter& w) { w.writeInt(0); }));
+    CPPUNIT_ASSERT(bytes({0x7f}) == encode([](MessagePackWriter& w) { w.writeInt(127); }));
+    CPPUNIT_ASSERT(bytes({0xcc, 0x80}) == encode([](MessagePackWriter& w) { w.writeInt(128); }));
+    CPPUNIT_ASSERT(bytes({0xcd, 0x01, 0x00}) == encode([](MessagePackWriter& w) { w.writeInt(256); }));
+    CPPUNIT_ASSERT(bytes({0xce, 0x00, 0x01, 0x00, 0x00}) == encode([](MessagePackWriter& w) { w.writeInt(65536); }));
+    CPPUNIT_ASSERT(bytes({0xcf, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}) ==
+                   encode([](MessagePackWriter& w) { w.writeInt(INT64_C(0x100000000)); }));
+
+    CPPUNIT_ASSERT(bytes({0xff}) == encode([](MessagePackWriter& w) { w.writeInt(-1); }));
+    CPPUNIT_ASSERT(bytes({0xe0}) == encode([](MessagePackWriter& w) { w.writeInt(-32); }));
+    CPPUNIT_ASSERT(bytes({0xd0, 0xdf}) == encode([](MessagePackWriter& w) { w.writeInt(-33); }));
+    CPPUNIT_ASSERT(bytes({0xd1, 0xff, 0x7f}) == encode([](MessagePackWriter& w) { w.writeInt(-129); }));
+    CPPUNIT_ASSERT(bytes({0xd2, 0xff, 0xff, 0x7f, 0xff}) == encode([](MessagePackWriter& w) { w.writeInt(-32769); }));
+
+    CPPUNIT_ASSERT(bytes({0xc0, 0xc2, 0xc3}) == encode([](MessagePackWriter& w) {
+        w.writeNil();
+        w.writeBool(false);
+        w.writeBool(true);
+    }));
+}
+
+void MessagePackTests::testFloats()
+{
+    CPPUNIT_ASSERT(bytes({0xca, 0x3f, 0xc0, 0x00, 0x00}) == encode([](MessagePackWriter& w) { w.writeFloat(1.5f); }));
+    CPPUNIT_ASSERT(bytes({0xcb, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}) ==
+                   encode([](MessagePackWriter& w) { w.writeDouble(-2.5); }));
+}
+
+void MessagePackTests::testStringsAndArrays()
+{
+    CPPUNIT_ASSERT(bytes({0xa3, 'a', 'b', 'c'}) == encode([](MessagePackWriter& w) { w.writeString("abc"); }));
+
+    const std::string s40(40, 'x');
+    const std::string e40 = encode([&](MessagePackWriter& w) { w.writeString(s40); });
+    CPPUNIT_ASSERT(bytes({0xd9, 40}) + s40 == e40);
+
+    const std::string s300(300, 'y');
+    const std::string e300 = encode([&](MessagePackWriter& w) { w.writeString(s300); });
+    CPPUNIT_ASSERT(bytes({0xda, 0x01, 0x2c}) + s300 == e300);
+
+    CPPUNIT_ASSERT(bytes({0x93, 0x01, 0x02, 0x03}) == encode([](MessagePackWriter& w) {
+        w.writeArrayHeader(3);
+        w.writeInt(1);
+        w.writeInt(2);
+        w.writeInt(3);
+    }));
+    CPPUNIT_ASSERT(bytes({0xdc, 0x00, 0x10}) == encode([](MessagePackWriter& w) { w.writeArrayHeader(16); }));
+    CPPUNIT_ASSERT(bytes({0xdd, 0x00, 0x01, 0x00, 0x00}) == encode([](MessagePackWriter& w) { w.writeArrayHeader(65536); }));
+}
@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileName: test_messagePack.hxx
+ * SPDX-FileComment: unit tests for the MessagePack encoder of the property stream
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class MessagePackTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(MessagePackTests);
+    CPPUNIT_TEST(testIntegers);
+    CPPUNIT_TEST(testFloats);
+    CPPUNIT_TEST(testStringsAndArrays);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // The tests.
+    void testIntegers();
+    void testFloats();
+    void testStringsAndArrays();
+};
@@ -0,0 +1,322 @@
+/*
+ * SPDX-FileName: test_mirrorWebsocket.cxx
+ * SPDX-FileComment: unit tests and benchmark for the property tree mirror websocket
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_mirrorWebsocket.hxx"
+#include "messagePackReader.hxx"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <simgear/timing/timestamp.hxx>
+
+#include <Main/fg_props.hxx>
+#include <Main/globals.hxx>
+#include <Network/http/MirrorPropertyTreeWebsocket.hxx>
+
+using flightgear::http::MirrorPropertyTreeWebsocket;
+using flightgear::http::WebsocketWriter;
+using MessagePackTest::Reader;
+using MessagePackTest::Value;
+
+namespace {
+
+const char* const ROOT = "/test/canvas";
+
+class CapturingWriter : public WebsocketWriter
+{
+public:
+    int writeToWebsocket(int opcode, const char* data, size_t len) override
+    {
+        opcodes.push_back(opcode);
+        frames.push_back(std::string(data, len));
+        return static_cast<int>(len);
+    }
+
+    std::vector<int> opcodes;
+    std::vector<std::string> frames;
+};
+
+// A headless client applying binary frames, as fgqcanvas does.
+struct MirrorClient {
+    struct Node {
+        unsigned parent;
+        std::string name;
+        int index;
+        Value value;
+    };
+
+    void apply(const std::string& frame)
+    {
+        Reader r(frame);
+        CPPUNIT_ASSERT_EQUAL(3, r.arrayHeader());
+
+        const int created = r.arrayHeader();
+        CPPUNIT_ASSERT_EQUAL(0, created % 6);
+        lastCreated = created / 6;
+        for (int i = 0; i < created / 6; ++i) {
+            const unsigned id = static_cast<unsigned>(r.value().number);
+            Node n;
+            n.parent = static_cast<unsigned>(r.value().number);
+            n.name = r.value().string;
+            n.index = static_cast<int>(r.value().number);
+            r.value(); // position
+            n.value = r.value();
+            CPPUNIT_ASSERT(n.parent == 0 || nodes.count(n.parent)); // parents come first
+            CPPUNIT_ASSERT(nodes.count(id) == 0);
+            nodes[id] = n;
+        }
+
+        const int removed = r.arrayHeader();
+        for (int i = 0; i < removed; ++i) {
+            nodes.erase(static_cast<unsigned>(r.value().number));
+        }
+
+        const int changed = r.arrayHeader();
+        CPPUNIT_ASSERT_EQUAL(0, changed % 2);
+        lastChanged = changed / 2;
+        for (int i = 0; i < changed / 2; ++i) {
+            const unsigned id = static_cast<unsigned>(r.value().number);
+            CPPUNIT_ASSERT(nodes.count(id));
+            nodes[id].value = r.value();
+        }
+        CPPUNIT_ASSERT(r.atEnd());
+    }
+
+    std::string path(unsigned id) const
+    {
+        const Node& n = nodes.at(id);
+        if (n.parent == 0) {
+            return ROOT;
+        }
+        return path(n.parent) + "/" + n.name + "[" + std::to_string(n.index) + "]";
+    }
+
+    // every mirrored node has the value of the property it mirrors
+    void verify() const
+    {
+        for (const auto& it : nodes) {
+            SGPropertyNode* prop = fgGetNode(path(it.first));
+            CPPUNIT_ASSERT_MESSAGE(path(it.first), prop);
+            const Value& v = it.second.value;
+            switch (v.kind) {
+            case Value::NIL:
+                CPPUNIT_ASSERT(!prop->hasValue());
+                break;
+            case Value::BOOL:
+                CPPUNIT_ASSERT_EQUAL(prop->getBoolValue(), v.number != 0.0);
+                break;
+            case Value::NUMBER:
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(prop->getDoubleValue(), v.number, 1e-4);
+                break;
+            case Value::STRING:
+                CPPUNIT_ASSERT_EQUAL(prop->getStringValue(), v.string);
+                break;
+            }
+        }
+    }
+
+    std::map<unsigned, Node> nodes;
+    int lastCreated = 0;
+    int lastChanged = 0;
+};
+
+// Something like a canvas MFD page: groups of path and text elements.
+void buildCanvas(int elements)
+{
+    SGPropertyNode* root = fgGetNode(ROOT, true);
+    for (int g = 0; g < elements / 10; ++g) {
+        SGPropertyNode* group = root->getChild("group", g, true);
+        group->setBoolValue("visible", true);
+        for (int e = 0; e < 10; ++e) {
+            SGPropertyNode* el = group->getChild((e % 2) ? "text" : "path", e, true);
+            el->setStringValue("text", "ALT " + std::to_string(g * 10 + e));
+            el->setStringValue("fill", "#00ff00");
+            el->setDoubleValue("tf/m[4]", 12.5 * e);
+            el->setDoubleValue("tf/m[5]", -3.25 * g);
+            el->setIntValue("z-index", e);
+            el->setFloatValue("stroke-width", 1.5f);
+        }
+    }
+}
+
+void changeCanvas(int elements, int frame)
+{
+    SGPropertyNode* root = fgGetNode(ROOT);
+    for (int g = 0; g < elements / 10; ++g) {
+        SGPropertyNode* group = root->getChild("group", g);
+        // a fifth of the elements move each frame
+        for (int e = frame % 5; e < 10; e += 5) {
+            SGPropertyNode* el = group->getChild((e % 2) ? "text" : "path", e);
+            el->setDoubleValue("tf/m[5]", -3.25 * g + frame);
+            el->setStringValue("text", "ALT " + std::to_string(frame));
+        }
+    }
+}
+
+} // of anonymous namespace
+
+void MirrorWebsocketTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("mirror-websocket");
+    fgSetDouble("/sim/http/mirror-websocket/update-interval-secs", 0.0);
+}
+
+void MirrorWebsocketTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void MirrorWebsocketTests::testBinaryMirror()
+{
+    buildCanvas(20);
+    MirrorPropertyTreeWebsocket socket(ROOT, true);
+    CapturingWriter writer;
+    MirrorClient client;
+
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), writer.frames.size());
+    CPPUNIT_ASSERT_EQUAL(2, writer.opcodes.back()); // binary
+    client.apply(writer.frames.back());
+    client.verify();
+
+    // changes, a new node and a removed one
+    fgSetDouble("/test/canvas/group[1]/text[3]/tf/m[5]", 42.0);
+    fgSetString("/test/canvas/group[0]/path[0]/text", "FL350");
+    fgSetBool("/test/canvas/group[1]/visible", false);
+    fgSetInt("/test/canvas/group[1]/text[7]/new-node", 7);
+    fgGetNode("/test/canvas/group[0]/path[2]")->removeChild("fill", 0);
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), writer.frames.size());
+    client.apply(writer.frames.back());
+    CPPUNIT_ASSERT_EQUAL(1, client.lastCreated);
+    CPPUNIT_ASSERT_EQUAL(3, client.lastChanged);
+    client.verify();
+
+    // removing and re-creating a node, as Nasal often does, is a change
+    fgGetNode("/test/canvas/group[0]/path[4]")->removeChild("fill", 0);
+    fgSetString("/test/canvas/group[0]/path[4]/fill", "#ff0000");
+    socket.poll(writer);
+    client.apply(writer.frames.back());
+    CPPUNIT_ASSERT_EQUAL(0, client.lastCreated);
+    CPPUNIT_ASSERT_EQUAL(1, client.lastChanged);
+    client.verify();
+
+    socket.close();
+}
+
+void MirrorWebsocketTests::testCoalescing()
+{
+    buildCanvas(10);
+    MirrorPropertyTreeWebsocket socket(ROOT, true);
+    CapturingWriter writer;
+    MirrorClient client;
+    socket.poll(writer);
+    client.apply(writer.frames.back());
+
+    // many changes between sends make one update
+    for (int i = 0; i < 100; ++i) {
+        fgSetDouble("/test/canvas/group[0]/path[0]/tf/m[4]", i);
+    }
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), writer.frames.size());
+    client.apply(writer.frames.back());
+    CPPUNIT_ASSERT_EQUAL(1, client.lastChanged);
+    client.verify();
+
+    // and a value changing back to what the client has isn't sent at all
+    fgSetDouble("/test/canvas/group[0]/path[0]/tf/m[4]", 1.0);
+    fgSetDouble("/test/canvas/group[0]/path[0]/tf/m[4]", 99.0);
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), writer.frames.size());
+
+    socket.close();
+}
+
+// A client mirroring a tree which doesn't exist yet gets an empty update
+// right away, so it knows the binary encoding is served.
+void MirrorWebsocketTests::testMissingRoot()
+{
+    MirrorPropertyTreeWebsocket socket(ROOT, true);
+    CapturingWriter writer;
+    MirrorClient client;
+
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), writer.frames.size());
+    CPPUNIT_ASSERT_EQUAL(2, writer.opcodes.back()); // binary
+    client.apply(writer.frames.back());
+    CPPUNIT_ASSERT(client.nodes.empty());
+
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), writer.frames.size());
+
+    // the tree is mirrored once it appears
+    buildCanvas(10);
+    socket.poll(writer);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), writer.frames.size());
+    client.apply(writer.frames.back());
+    CPPUNIT_ASSERT(!client.nodes.empty());
+    client.verify();
+
+    socket.close();
+}
+
+void MirrorWebsocketTests::testBenchmark()
+{
+    const int elements = 500;
+    const int frames = 100;
+    buildCanvas(elements);
+
+    auto run = [&](bool binary) {
+        MirrorPropertyTreeWebsocket socket(ROOT, binary);
+        CapturingWriter writer;
+        MirrorClient client;
+
+        SGTimeStamp st;
+        st.stamp();
+        socket.poll(writer);
+        const auto initialUSec = st.elapsedUSec();
+        const size_t initialBytes = writer.frames.back().size();
+
+        size_t bytes = 0;
+        int64_t encodeUSec = 0, decodeUSec = 0;
+        for (int f = 0; f < frames; ++f) {
+            changeCanvas(elements, f);
+            st.stamp();
+            socket.poll(writer);
+            encodeUSec += st.elapsedUSec();
+            bytes += writer.frames.back().size();
+
+            if (binary) {
+                st.stamp();
+                client.apply(writer.frames.back());
+                decodeUSec += st.elapsedUSec();
+            }
+        }
+        socket.close();
+
+        std::cout << "mirror websocket, " << (binary ? "binary" : "JSON") << ": initial "
+                  << initialBytes << " bytes in " << initialUSec << "us, "
+                  << frames << " updates " << bytes << " bytes, encoded in " << encodeUSec << "us";
+        if (binary) {
+            client.verify();
+            std::cout << ", decoded in " << decodeUSec << "us";
+        }
+        std::cout << std::endl;
+        return bytes;
+    };
+
+    const size_t jsonBytes = run(false);
+    const size_t binaryBytes = run(true);
+    CPPUNIT_ASSERT(binaryBytes < jsonBytes);
+}
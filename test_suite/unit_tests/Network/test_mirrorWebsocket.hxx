@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileName: test_mirrorWebsocket.hxx
+ * SPDX-FileComment: unit tests and benchmark for the property tree mirror websocket
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class MirrorWebsocketTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(MirrorWebsocketTests);
+    CPPUNIT_TEST(testBinaryMirror);
+    CPPUNIT_TEST(testCoalescing);
+    CPPUNIT_TEST(testMissingRoot);
+    CPPUNIT_TEST(testBenchmark);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testBinaryMirror();
+    void testCoalescing();
+    void testMissingRoot();
+    void testBenchmark();
+};
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileName: test_propertyChangeObserver.cxx
+ * SPDX-FileComment: unit tests for watching properties from websockets
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_propertyChangeObserver.hxx"
+
+#include <limits>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <Main/fg_props.hxx>
+#include <Network/http/PropertyChangeObserver.hxx>
+
+using flightgear::http::PropertyChangeObserver;
+using flightgear::http::PropertyWatch;
+
+
+void PropertyChangeObserverTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("property-change-observer");
+}
+
+void PropertyChangeObserverTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+void PropertyChangeObserverTests::testDeadband()
+{
+    PropertyChangeObserver observer;
+    fgSetDouble("/test/double", 1.0);
+    fgSetFloat("/test/float", 1.0f);
+    PropertyWatch d(observer.addObservation("/test/double"), 0.5);
+    PropertyWatch f(observer.addObservation("/test/float"), 0.5);
+
+    // the initial value is always sent
+    CPPUNIT_ASSERT(d.needsUpdate());
+    CPPUNIT_ASSERT(f.needsUpdate());
+    CPPUNIT_ASSERT(!d.needsUpdate());
+
+    // changes within the deadband of the sent value are suppressed, and
+    // don't move the reference value
+    fgSetDouble("/test/double", 1.3);
+    fgSetFloat("/test/float", 1.3f);
+    CPPUNIT_ASSERT(!d.needsUpdate());
+    CPPUNIT_ASSERT(!f.needsUpdate());
+    fgSetDouble("/test/double", 1.6);
+    fgSetFloat("/test/float", 1.6f);
+    CPPUNIT_ASSERT(d.needsUpdate());
+    CPPUNIT_ASSERT(f.needsUpdate());
+    CPPUNIT_ASSERT_EQUAL(1.6, d._sentNumber);
+
+    fgSetDouble("/test/double", 1.2);
+    CPPUNIT_ASSERT(!d.needsUpdate());
+    fgSetDouble("/test/double", 1.0);
+    CPPUNIT_ASSERT(d.needsUpdate());
+
+    // without a deadband, every change is sent
+    PropertyWatch exact(observer.addObservation("/test/double"), 0.0);
+    CPPUNIT_ASSERT(exact.needsUpdate());
+    fgSetDouble("/test/double", 1.0 + 1e-9);
+    CPPUNIT_ASSERT(exact.needsUpdate());
+    fgSetDouble("/test/double", 1.0 + 1e-9);
+    CPPUNIT_ASSERT(!exact.needsUpdate());
+}
+
+void PropertyChangeObserverTests::testNaN()
+{
+    PropertyChangeObserver observer;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    fgSetDouble("/test/double", nan);
+    PropertyWatch d(observer.addObservation("/test/double"), 0.0);
+    CPPUNIT_ASSERT(d.needsUpdate());
+
+    // NaN again is no change
+    fgSetDouble("/test/double", nan);
+    CPPUNIT_ASSERT(!d.needsUpdate());
+
+    // but leaving or entering NaN is
+    fgSetDouble("/test/double", 2.0);
+    CPPUNIT_ASSERT(d.needsUpdate());
+    fgSetDouble("/test/double", nan);
+    CPPUNIT_ASSERT(d.needsUpdate());
+}
+
+void PropertyChangeObserverTests::testBoolAndInt()
+{
+    // a deadband, here the global default, doesn't apply to bools and integers
+    fgSetDouble("/sim/http/property-websocket/deadband", 10.0);
+    const double deadband = fgGetDouble("/sim/http/property-websocket/deadband");
+
+    PropertyChangeObserver observer;
+    fgSetBool("/test/bool", false);
+    fgSetInt("/test/int", 100);
+    fgSetLong("/test/long", 100);
+    PropertyWatch b(observer.addObservation("/test/bool"), deadband);
+    PropertyWatch i(observer.addObservation("/test/int"), deadband);
+    PropertyWatch l(observer.addObservation("/test/long"), deadband);
+    CPPUNIT_ASSERT(b.needsUpdate());
+    CPPUNIT_ASSERT(i.needsUpdate());
+    CPPUNIT_ASSERT(l.needsUpdate());
+
+    fgSetBool("/test/bool", true);
+    fgSetInt("/test/int", 101);
+    fgSetLong("/test/long", 101);
+    CPPUNIT_ASSERT(b.needsUpdate());
+    CPPUNIT_ASSERT(i.needsUpdate());
+    CPPUNIT_ASSERT(l.needsUpdate());
+
+    // writing the same value isn't a change
+    fgSetBool("/test/bool", true);
+    fgSetInt("/test/int", 101);
+    CPPUNIT_ASSERT(!b.needsUpdate());
+    CPPUNIT_ASSERT(!i.needsUpdate());
+}
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileName: test_propertyChangeObserver.hxx
+ * SPDX-FileComment: unit tests for watching properties from websockets
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class PropertyChangeObserverTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(PropertyChangeObserverTests);
+    CPPUNIT_TEST(testDeadband);
+    CPPUNIT_TEST(testNaN);
+    CPPUNIT_TEST(testBoolAndInt);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testDeadband();
+    void testNaN();
+    void testBoolAndInt();
+};
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileName: test_propertyStreamWebsocket.cxx
+ * SPDX-FileComment: unit tests for the binary property stream websocket
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "config.h"
+
+#include "test_propertyStreamWebsocket.hxx"
+#include "messagePackReader.hxx"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <cJSON.h>
+
+#include "test_suite/FGTestApi/testGlobals.hxx"
+
+#include <Main/fg_props.hxx>
+#include <Network/http/HTTPRequest.hxx>
+#include <Network/http/PropertyChangeObserver.hxx>
+#include <Network/http/PropertyStreamWebsocket.hxx>
+
+using flightgear::http::HTTPRequest;
+using flightgear::http::PropertyChangeObserver;
+using flightgear::http::PropertyStreamWebsocket;
+using flightgear::http::WebsocketWriter;
+using MessagePackTest::Reader;
+using MessagePackTest::Value;
+
+namespace {
+
+class CapturingWriter : public WebsocketWriter
+{
+public:
+    int writeToWebsocket(int opcode, const char* data, size_t len) override
+    {
+        opcodes.push_back(opcode);
+        frames.push_back(std::string(data, len));
+        return static_cast<int>(len);
+    }
+
+    std::vector<int> opcodes;
+    std::vector<std::string> frames;
+};
+
+// A headless client: subscribes with JSON commands, and decodes the binary
+// frames by the ids it was assigned.
+struct StreamClient {
+    explicit StreamClient(PropertyStreamWebsocket& socket) : _socket(socket) {}
+
+    void send(const std::string& command)
+    {
+        HTTPRequest request;
+        request.Content = command;
+        _socket.handleRequest(request, writer);
+    }
+
+    // subscribe, and return the number of nodes in the reply
+    int addListener(const std::string& nodes)
+    {
+        const size_t before = writer.frames.size();
+        send("{\"command\":\"addListener\",\"nodes\":[" + nodes + "]}");
+        CPPUNIT_ASSERT_EQUAL(before + 1, writer.frames.size());
+        CPPUNIT_ASSERT_EQUAL(1, writer.opcodes.back()); // text
+
+        cJSON* json = cJSON_Parse(writer.frames.back().c_str());
+        CPPUNIT_ASSERT(json);
+        CPPUNIT_ASSERT_EQUAL(std::string("ids"),
+                             std::string(cJSON_GetObjectItem(json, "command")->valuestring));
+        cJSON* nodes = cJSON_GetObjectItem(json, "nodes");
+        const int count = cJSON_GetArraySize(nodes);
+        for (int i = 0; i < count; ++i) {
+            cJSON* node = cJSON_GetArrayItem(nodes, i);
+            const std::string path = cJSON_GetObjectItem(node, "path")->valuestring;
+            ids[path] = static_cast<unsigned>(cJSON_GetObjectItem(node, "id")->valueint);
+            types[path] = cJSON_GetObjectItem(node, "type")->valuestring;
+        }
+        cJSON_Delete(json);
+        return count;
+    }
+
+    // poll the socket, and apply the frame sent, if any
+    bool poll()
+    {
+        const size_t before = writer.frames.size();
+        _socket.poll(writer);
+        if (writer.frames.size() == before) {
+            return false;
+        }
+        CPPUNIT_ASSERT_EQUAL(before + 1, writer.frames.size());
+        CPPUNIT_ASSERT_EQUAL(2, writer.opcodes.back()); // binary
+
+        Reader r(writer.frames.back());
+        const int items = r.arrayHeader();
+        CPPUNIT_ASSERT_EQUAL(1, items % 2);
+        elapsed = r.value().number;
+        lastChanged.clear();
+        for (int i = 0; i < items / 2; ++i) {
+            const unsigned id = static_cast<unsigned>(r.value().number);
+            values[id] = r.value();
+            lastChanged.push_back(id);
+        }
+        CPPUNIT_ASSERT(r.atEnd());
+        return true;
+    }
+
+    const Value& value(const std::string& path) { return values.at(ids.at(path)); }
+
+    CapturingWriter writer;
+    std::map<std::string, unsigned> ids;
+    std::map<std::string, std::string> types;
+    std::map<unsigned, Value> values;
+    std::vector<unsigned> lastChanged;
+    double elapsed = -1.0;
+
+private:
+    PropertyStreamWebsocket& _socket;
+};
+
+} // of anonymous namespace
+
+void PropertyStreamWebsocketTests::setUp()
+{
+    FGTestApi::setUp::initTestGlobals("property-stream-websocket");
+    fgSetDouble("/sim/http/property-websocket/update-interval-secs", 0.0);
+}
+
+void PropertyStreamWebsocketTests::tearDown()
+{
+    FGTestApi::tearDown::shutdownTestGlobals();
+}
+
+// Every subscribed node gets an id, kept when subscribing again.
+void PropertyStreamWebsocketTests::testIds()
+{
+    fgSetDouble("/test/altitude-ft", 3500.0);
+    fgSetInt("/test/gear", 1);
+    fgSetString("/test/callsign", "FGFS");
+
+    PropertyChangeObserver observer;
+    PropertyStreamWebsocket socket(&observer);
+    StreamClient client(socket);
+
+    CPPUNIT_ASSERT_EQUAL(2, client.addListener("\"/test/altitude-ft\",\"/test/gear\""));
+    CPPUNIT_ASSERT(client.ids.at("/test/altitude-ft") != client.ids.at("/test/gear"));
+    CPPUNIT_ASSERT_EQUAL(std::string("double"), client.types.at("/test/altitude-ft"));
+    CPPUNIT_ASSERT_EQUAL(std::string("int"), client.types.at("/test/gear"));
+
+    const unsigned altitudeId = client.ids.at("/test/altitude-ft");
+    CPPUNIT_ASSERT_EQUAL(2, client.addListener("\"/test/altitude-ft\",\"/test/callsign\""));
+    CPPUNIT_ASSERT_EQUAL(altitudeId, client.ids.at("/test/altitude-ft"));
+    CPPUNIT_ASSERT_EQUAL(std::string("string"), client.types.at("/test/callsign"));
+
+    // ids aren't reused after a node is removed
+    const unsigned gearId = client.ids.at("/test/gear");
+    client.send("{\"command\":\"removeListener\",\"node\":\"/test/gear\"}");
+    CPPUNIT_ASSERT_EQUAL(1, client.addListener("\"/test/gear\""));
+    CPPUNIT_ASSERT(client.ids.at("/test/gear") != gearId);
+    CPPUNIT_ASSERT(client.ids.at("/test/gear") != client.ids.at("/test/callsign"));
+
+    socket.close();
+}
+
+// Changed values come as [elapsed, id, value, ...], each node at most once.
+void PropertyStreamWebsocketTests::testStream()
+{
+    fgSetDouble("/sim/time/elapsed-sec", 12.5);
+    fgSetDouble("/test/altitude-ft", 3500.0);
+    fgSetInt("/test/gear", 1);
+    fgSetString("/test/callsign", "FGFS");
+
+    PropertyChangeObserver observer;
+    PropertyStreamWebsocket socket(&observer);
+    StreamClient client(socket);
+    client.addListener("\"/test/altitude-ft\",\"/test/gear\",\"/test/callsign\"");
+
+    // the initial values
+    CPPUNIT_ASSERT(client.poll());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.5, client.elapsed, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), client.lastChanged.size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3500.0, client.value("/test/altitude-ft").number, 1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, client.value("/test/gear").number, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(std::string("FGFS"), client.value("/test/callsign").string);
+
+    // nothing changed, nothing sent
+    CPPUNIT_ASSERT(!client.poll());
+
+    // only what changed, and only its latest value
+    fgSetDouble("/sim/time/elapsed-sec", 13.0);
+    fgSetDouble("/test/altitude-ft", 3510.0);
+    fgSetDouble("/test/altitude-ft", 3520.0);
+    CPPUNIT_ASSERT(client.poll());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(13.0, client.elapsed, 1e-9);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), client.lastChanged.size());
+    CPPUNIT_ASSERT_EQUAL(client.ids.at("/test/altitude-ft"), client.lastChanged.front());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3520.0, client.value("/test/altitude-ft").number, 1e-9);
+
+    // a removed node isn't sent any more
+    client.send("{\"command\":\"removeListener\",\"node\":\"/test/gear\"}");
+    fgSetInt("/test/gear", 0);
+    CPPUNIT_ASSERT(!client.poll());
+
+    // subscribing again resends the current value
+    client.addListener("\"/test/callsign\"");
+    CPPUNIT_ASSERT(client.poll());
+    CPPUNIT_ASSERT_EQUAL(size_t(1), client.lastChanged.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("FGFS"), client.value("/test/callsign").string);
+
+    socket.close();
+}
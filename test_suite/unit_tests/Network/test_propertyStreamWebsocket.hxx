@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileName: test_propertyStreamWebsocket.hxx
+ * SPDX-FileComment: unit tests for the binary property stream websocket
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+
+// The unit tests.
+class PropertyStreamWebsocketTests : public CppUnit::TestFixture
+{
+    // Set up the test suite.
+    CPPUNIT_TEST_SUITE(PropertyStreamWebsocketTests);
+    CPPUNIT_TEST(testIds);
+    CPPUNIT_TEST(testStream);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    // Set up function for each test.
+    void setUp();
+
+    // Clean up after each test.
+    void tearDown();
+
+    // The tests.
+    void testIds();
+    void testStream();
+};
@@ -32,6 +32,12 @@
 #include "fgqcanvasfontcache.h"
 #include "fgqcanvasimageloader.h"
 #include "jsonutils.h"
+#include "messagepackreader.h"
+
+namespace {
+const QString binaryMirrorPrefix = QStringLiteral("/PropertyTreeMirrorBinary/");
+const QString textMirrorPrefix = QStringLiteral("/PropertyTreeMirror/");
+}
 
 CanvasConnection::CanvasConnection(QObject *parent) : QObject(parent)
 {
@@ -39,6 +45,8 @@ CanvasConnection::CanvasConnection(QObject *parent) : QObject(parent)
     connect(&m_webSocket, &QWebSocket::disconnected, this, &CanvasConnection::onWebSocketClosed);
     connect(&m_webSocket, &QWebSocket::textMessageReceived,
             this, &CanvasConnection::onTextMessageReceived);
+    connect(&m_webSocket, &QWebSocket::binaryMessageReceived,
+            this, &CanvasConnection::onBinaryMessageReceived);
 
     m_destRect = QRectF(50, 50, 400, 400);
     m_reconnectTimer = new QTimer(this);
@@ -46,6 +54,14 @@ CanvasConnection::CanvasConnection(QObject *parent) : QObject(parent)
     m_reconnectTimer->setSingleShot(true);
     connect(m_reconnectTimer, &QTimer::timeout,
             this, &CanvasConnection::reconnect);
+
+    // older FlightGear versions don't serve the binary encoding: they either
+    // refuse the handshake, or accept it and never send an update
+    m_binaryProbeTimer = new QTimer(this);
+    m_binaryProbeTimer->setInterval(1000 * 5);
+    m_binaryProbeTimer->setSingleShot(true);
+    connect(m_binaryProbeTimer, &QTimer::timeout,
+            this, &CanvasConnection::onBinaryProbeTimeout);
 }
 
 CanvasConnection::~CanvasConnection()
@@ -153,9 +169,12 @@ void CanvasConnection::connectWebSocket(QByteArray hostName, int port)
     wsUrl.setScheme("ws");
     wsUrl.setHost(hostName);
     wsUrl.setPort(port);
-    wsUrl.setPath("/PropertyTreeMirror" + m_rootPropertyPath);
+    // prefer the binary encoding, falling back to the text one if the
+    // server doesn't support it
+    wsUrl.setPath("/PropertyTreeMirrorBinary" + m_rootPropertyPath);
 
     m_webSocketUrl = wsUrl;
+    m_textFallback = false;
     emit webSocketUrlChanged();
 
     m_webSocket.open(wsUrl);
@@ -212,15 +231,31 @@ void CanvasConnection::onWebSocketConnected()
     qDebug() << Q_FUNC_INFO << m_webSocketUrl;
     m_localPropertyRoot.reset(new LocalProp{nullptr, NameIndexTuple("")});
     setStatus(Connected);
+
+    if (isBinaryEncoding()) {
+        m_binaryProbeTimer->start();
+    }
+}
+
+void CanvasConnection::onBinaryProbeTimeout()
+{
+    qWarning() << "no mirror updates from" << m_webSocketUrl
+               << "- falling back to the text encoding";
+    m_retryWithText = true;
+    m_webSocket.close();
 }
 
 void CanvasConnection::onTextMessageReceived(QString message)
 {
+    // the server serves this encoding, keep using it
+    m_binaryProbeTimer->stop();
+    m_textFallback = false;
+
     QJsonDocument json = QJsonDocument::fromJson(message.toUtf8());
     if (json.isObject()) {
         // process new nodes
         QJsonArray created = json.object().value("created").toArray();
-        Q_FOREACH (QJsonValue v, created) {
+        for (const QJsonValue& v : created) {
             QJsonObject newProp = v.toObject();
 
             QByteArray nodePath = newProp.value("path").toString().toUtf8();
@@ -230,74 +265,158 @@ void CanvasConnection::onTextMessageReceived(QString message)
             }
 
             QByteArray localPath = nodePath.mid(m_rootPropertyPath.size() + 1);
-            LocalProp* newNode = propertyFromPath(localPath);
-            newNode->setPosition(newProp.value("position").toInt());
-            // store in the global dict
-            int propId = newProp.value("id").toInt();
-            if (idPropertyDict.contains(propId)) {
-                qWarning() << "duplicate add of:" << nodePath << "old is" << idPropertyDict.value(propId)->path();
-            } else {
-                idPropertyDict.insert(propId, newNode);
-            }
-
-            // set initial value
-            newNode->processChange(newProp.value("value"));
+            addProperty(newProp.value("id").toInt(), propertyFromPath(localPath),
+                        newProp.value("position").toInt(), newProp.value("value"));
         }
 
         // process removes
         QJsonArray removed = json.object().value("removed").toArray();
-        Q_FOREACH (QJsonValue v, removed) {
-            int propId = v.toInt();
-            if (!idPropertyDict.contains(propId)) {
-                continue;
-            }
-
-            auto prop = idPropertyDict.value(propId);
-            idPropertyDict.remove(propId);
-
-            // depending on the order removes are sent, the LocalProp
-            // may already have been deleted when its parent was removed,
-            // so check if the QPointer is null
-            if (!prop.isNull()) {
-                prop->parent()->removeChild(prop);
-            }
-        } // of removes processing
+        for (const QJsonValue& v : removed) {
+            removeProperty(v.toInt());
+        }
 
         // process changes
         QJsonArray changed = json.object().value("changed").toArray();
-
-        Q_FOREACH (QJsonValue v, changed) {
+        for (const QJsonValue& v : changed) {
             QJsonArray change = v.toArray();
             if (change.size() != 2) {
                 qWarning() << "malformed change notification";
                 continue;
             }
 
-            int propId = change.at(0).toInt();
-            if (!idPropertyDict.contains(propId)) {
-                qWarning() << "ignoring unknown prop ID " << propId;
-                continue;
-            }
+            changeProperty(change.at(0).toInt(), change.at(1));
+        }
+    }
 
-            LocalProp* lp = idPropertyDict.value(propId);
-            if (lp != nullptr) {
-                lp->processChange(change.at(1));
-            }
-        } // of change processing
+    emit updated();
+}
+
+void CanvasConnection::onBinaryMessageReceived(QByteArray message)
+{
+    m_binaryProbeTimer->stop();
+
+    // see MirrorPropertyTreeWebsocket.hxx for the layout
+    MessagePackReader reader(message);
+    if (reader.readArrayHeader() != 3) {
+        qWarning() << "malformed binary mirror update";
+        return;
+    }
+
+    const int createdCount = reader.readArrayHeader() / 6;
+    for (int i = 0; (i < createdCount) && !reader.atError(); ++i) {
+        const int propId = reader.readValue().toInt();
+        const int parentId = reader.readValue().toInt();
+        const QByteArray name = reader.readValue().toString().toUtf8();
+        const int index = reader.readValue().toInt();
+        const int position = reader.readValue().toInt();
+        const QJsonValue value = reader.readValue();
+
+        LocalProp* parent = (parentId == 0) ? m_localPropertyRoot.get()
+                                            : idPropertyDict.value(parentId).data();
+        if (!parent) {
+            qWarning() << "ignoring prop ID" << propId << "with unknown parent" << parentId;
+            continue;
+        }
+
+        LocalProp* node = name.isEmpty() ? parent
+                                         : parent->getOrCreateChildWithNameAndIndex(NameIndexTuple(name.constData(), index));
+        addProperty(propId, node, position, value);
+    }
+
+    const int removedCount = reader.readArrayHeader();
+    for (int i = 0; (i < removedCount) && !reader.atError(); ++i) {
+        removeProperty(reader.readValue().toInt());
+    }
+
+    const int changedCount = reader.readArrayHeader() / 2;
+    for (int i = 0; (i < changedCount) && !reader.atError(); ++i) {
+        const int propId = reader.readValue().toInt();
+        changeProperty(propId, reader.readValue());
+    }
+
+    if (reader.atError()) {
+        qWarning() << "malformed binary mirror update";
     }
 
     emit updated();
 }
 
+void CanvasConnection::addProperty(int propId, LocalProp* node, int position, const QJsonValue& value)
+{
+    node->setPosition(position);
+    // store in the global dict
+    auto it = idPropertyDict.find(propId);
+    if (it != idPropertyDict.end()) {
+        qWarning() << "duplicate add of:" << node->path() << "old is" << (*it)->path();
+    } else {
+        idPropertyDict.insert(propId, node);
+    }
+
+    // set initial value
+    node->processChange(value);
+}
+
+void CanvasConnection::removeProperty(int propId)
+{
+    auto it = idPropertyDict.find(propId);
+    if (it == idPropertyDict.end()) {
+        return;
+    }
+
+    QPointer<LocalProp> prop = *it;
+    idPropertyDict.erase(it);
+
+    // depending on the order removes are sent, the LocalProp
+    // may already have been deleted when its parent was removed,
+    // so check if the QPointer is null
+    if (!prop.isNull()) {
+        prop->parent()->removeChild(prop);
+    }
+}
+
+void CanvasConnection::changeProperty(int propId, const QJsonValue& value)
+{
+    auto it = idPropertyDict.constFind(propId);
+    if (it == idPropertyDict.constEnd()) {
+        qWarning() << "ignoring unknown prop ID " << propId;
+        return;
+    }
+
+    LocalProp* lp = *it;
+    if (lp != nullptr) {
+        lp->processChange(value);
+    }
+}
+
 void CanvasConnection::onWebSocketClosed()
 {
     if ((m_status == Connected) || (m_status == Connected)) {
         qDebug() << "saw web-socket closed";
     }
 
+    m_binaryProbeTimer->stop();
     m_localPropertyRoot.reset();
     idPropertyDict.clear();
 
+    // the server refused the handshake of the binary encoding, or never sent
+    // an update with it: retry straight away with the text one
+    if (m_retryWithText || ((m_status == Connecting) && isBinaryEncoding())) {
+        m_retryWithText = false;
+        m_textFallback = true;
+        setBinaryEncoding(false);
+        qDebug() << "retrying with the text encoding:" << m_webSocketUrl;
+        m_webSocket.open(m_webSocketUrl);
+        setStatus(Connecting);
+        return;
+    }
+
+    // the text encoding failed as well, so the server is unreachable rather
+    // than old: try the binary encoding again when reconnecting
+    if ((m_status == Connecting) && m_textFallback) {
+        m_textFallback = false;
+        setBinaryEncoding(true);
+    }
+
     setStatus(Closed);
 
     if (m_autoReconnect) {
@@ -314,6 +433,24 @@ void CanvasConnection::setStatus(CanvasConnection::Status newStatus)
     emit statusChanged(m_status);
 }
 
+bool CanvasConnection::isBinaryEncoding() const
+{
+    return m_webSocketUrl.path().startsWith(binaryMirrorPrefix);
+}
+
+void CanvasConnection::setBinaryEncoding(bool binary)
+{
+    const QString& from = binary ? textMirrorPrefix : binaryMirrorPrefix;
+    const QString& to = binary ? binaryMirrorPrefix : textMirrorPrefix;
+    const QString path = m_webSocketUrl.path();
+    if (!path.startsWith(from)) {
+        return;
+    }
+
+    m_webSocketUrl.setPath(to + path.mid(from.size()));
+    emit webSocketUrlChanged();
+}
+
 LocalProp *CanvasConnection::propertyFromPath(QByteArray path) const
 {
     return m_localPropertyRoot->getOrCreateWithPath(path);
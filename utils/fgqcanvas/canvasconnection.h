@@ -132,12 +132,21 @@ signals:
 private Q_SLOTS:
     void onWebSocketConnected();
     void onTextMessageReceived(QString message);
+    void onBinaryMessageReceived(QByteArray message);
     void onWebSocketClosed();
+    void onBinaryProbeTimeout();
 
 private:
     void setStatus(Status newStatus);
+    bool isBinaryEncoding() const;
+    void setBinaryEncoding(bool binary);
     LocalProp *propertyFromPath(QByteArray path) const;
 
+    // shared by the text and binary encodings of mirror updates
+    void addProperty(int propId, LocalProp* node, int position, const QJsonValue& value);
+    void removeProperty(int propId);
+    void changeProperty(int propId, const QJsonValue& value);
+
     QUrl m_webSocketUrl;
     QByteArray m_rootPropertyPath;
     QRectF m_destRect;
@@ -147,6 +156,9 @@ private:
     QNetworkAccessManager* m_netAccess = nullptr;
     QTimer* m_reconnectTimer = nullptr;
     bool m_autoReconnect = false;
+    QTimer* m_binaryProbeTimer = nullptr;
+    bool m_retryWithText = false; ///< close() is to fall back to the text encoding
+    bool m_textFallback = false; ///< fell back to it, but it hasn't worked yet
 
     std::unique_ptr<LocalProp> m_localPropertyRoot;
     QHash<int, QPointer<LocalProp>> idPropertyDict;
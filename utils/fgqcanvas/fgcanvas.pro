@@ -22,7 +22,8 @@ SOURCES += main.cpp\
     applicationcontroller.cpp \
     canvasdisplay.cpp \
     canvaspainteddisplay.cpp \
-    jsonutils.cpp
+    jsonutils.cpp \
+    messagepackreader.cpp
 
 
 HEADERS +=  \
@@ -42,7 +43,8 @@ HEADERS +=  \
     fgqcanvasfontcache.h \
     fgqcanvasimageloader.h \
     canvaspainteddisplay.h \
-    jsonutils.h
+    jsonutils.h \
+    messagepackreader.h
 
 RESOURCES += \
     fgqcanvas_resources.qrc
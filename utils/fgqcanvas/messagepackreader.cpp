@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileName: messagepackreader.cpp
+ * SPDX-FileComment: minimal MessagePack decoder for the binary mirror protocol
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "messagepackreader.h"
+
+#include <cstring>
+
+MessagePackReader::MessagePackReader(const QByteArray& data) :
+    m_data(data)
+{
+}
+
+quint64 MessagePackReader::readBigEndian(int bytes)
+{
+    if (m_error || (m_pos + bytes > m_data.size())) {
+        m_error = true;
+        return 0;
+    }
+
+    quint64 v = 0;
+    for (int i = 0; i < bytes; ++i) {
+        v = (v << 8) | static_cast<quint8>(m_data.at(m_pos++));
+    }
+    return v;
+}
+
+int MessagePackReader::readArrayHeader()
+{
+    const quint8 tag = static_cast<quint8>(readBigEndian(1));
+    if ((tag & 0xf0) == 0x90) {
+        return tag & 0x0f;
+    } else if (tag == 0xdc) {
+        return static_cast<int>(readBigEndian(2));
+    } else if (tag == 0xdd) {
+        return static_cast<int>(readBigEndian(4));
+    }
+
+    m_error = true;
+    return -1;
+}
+
+QJsonValue MessagePackReader::readValue()
+{
+    const quint8 tag = static_cast<quint8>(readBigEndian(1));
+    if (m_error) {
+        return QJsonValue();
+    }
+
+    int strLength = -1;
+    if (tag < 0x80) {
+        return static_cast<double>(tag); // positive fixint
+    } else if (tag >= 0xe0) {
+        return static_cast<double>(static_cast<qint8>(tag)); // negative fixint
+    } else if ((tag & 0xe0) == 0xa0) {
+        strLength = tag & 0x1f; // fixstr
+    }
+
+    switch (tag) {
+    case 0xc0: return QJsonValue();
+    case 0xc2: return false;
+    case 0xc3: return true;
+    case 0xcc: return static_cast<double>(readBigEndian(1));
+    case 0xcd: return static_cast<double>(readBigEndian(2));
+    case 0xce: return static_cast<double>(readBigEndian(4));
+    case 0xcf: return static_cast<double>(readBigEndian(8));
+    case 0xd0: return static_cast<double>(static_cast<qint8>(readBigEndian(1)));
+    case 0xd1: return static_cast<double>(static_cast<qint16>(readBigEndian(2)));
+    case 0xd2: return static_cast<double>(static_cast<qint32>(readBigEndian(4)));
+    case 0xd3: return static_cast<double>(static_cast<qint64>(readBigEndian(8)));
+    case 0xca: {
+        const quint32 bits = static_cast<quint32>(readBigEndian(4));
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return static_cast<double>(f);
+    }
+    case 0xcb: {
+        const quint64 bits = readBigEndian(8);
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        return d;
+    }
+    case 0xd9: strLength = static_cast<int>(readBigEndian(1)); break;
+    case 0xda: strLength = static_cast<int>(readBigEndian(2)); break;
+    case 0xdb: strLength = static_cast<int>(readBigEndian(4)); break;
+    default:
+        break;
+    }
+
+    if ((strLength < 0) || m_error || (m_pos + strLength > m_data.size())) {
+        m_error = true;
+        return QJsonValue();
+    }
+
+    const QByteArray s = m_data.mid(m_pos, strLength);
+    m_pos += strLength;
+    return QString::fromUtf8(s);
+}
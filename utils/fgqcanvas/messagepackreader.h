@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileName: messagepackreader.h
+ * SPDX-FileComment: minimal MessagePack decoder for the binary mirror protocol
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef MESSAGEPACKREADER_H
+#define MESSAGEPACKREADER_H
+
+#include <QByteArray>
+#include <QJsonValue>
+
+/**
+ * Reads the subset of MessagePack written by FlightGear's MessagePackWriter:
+ * nil, booleans, integers, floats, strings and arrays. Malformed or
+ * truncated input sets the error flag, after which reads return null
+ * values.
+ */
+class MessagePackReader
+{
+public:
+    explicit MessagePackReader(const QByteArray& data);
+
+    bool atError() const
+    {
+        return m_error;
+    }
+
+    bool atEnd() const
+    {
+        return m_pos >= m_data.size();
+    }
+
+    /// the number of elements following, or -1 if the next item isn't an array
+    int readArrayHeader();
+
+    /// a scalar value; integers are converted to double as in JSON
+    QJsonValue readValue();
+
+private:
+    quint64 readBigEndian(int bytes);
+
+    const QByteArray m_data;
+    int m_pos = 0;
+    bool m_error = false;
+};
+
+#endif // MESSAGEPACKREADER_H
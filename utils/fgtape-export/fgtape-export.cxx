@@ -0,0 +1,578 @@
+/*
+ * SPDX-FileName: fgtape-export.cxx
+ * SPDX-FileComment: exports signals of Continuous recordings without running Flightgear
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <simgear/misc/sg_dir.hxx>
+#include <simgear/misc/sg_path.hxx>
+
+#include <Aircraft/continuous-reader.hxx>
+
+using std::cout;
+using std::endl;
+
+namespace {
+
+enum class Format {
+    CSV,
+    COLUMNS,
+    SUMMARY
+};
+
+struct Options {
+    Format format = Format::CSV;
+    std::vector<std::string> signals; // empty means all signals
+    double interval = -1;             // <0 means the format's default
+    SGPath outputDir;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+};
+
+// number of rows in each row group of a columns file
+const uint32_t ROW_GROUP_ROWS = 65536;
+const char COLUMNS_MAGIC[8] = {'F', 'G', 'T', 'A', 'P', 'E', 'C', 'L'};
+
+// serialises messages from the worker threads
+std::mutex s_outputLock;
+
+void usage(const char* prog)
+{
+    cout << "Usage: " << prog << " [options] <tape-or-directory>..." << endl
+         << "Exports the signals of Continuous (and recovery) .fgtape recordings." << endl
+         << "Directories are searched for .fgtape files, and tapes are exported" << endl
+         << "in parallel." << endl
+         << endl
+         << "  --format <f>      csv (default), columns or summary" << endl
+         << "  --signal <path>   export only this property; a trailing * matches a" << endl
+         << "                    prefix. May be given more than once (default all)" << endl
+         << "  --interval <s>    csv and columns: export only the first frame of each" << endl
+         << "                    interval (default 0, every frame); summary: time covered by" << endl
+         << "                    each row of min/mean/max values (default 1)" << endl
+         << "  --output <dir>    directory for the exported files (default the" << endl
+         << "                    directory of each tape)" << endl
+         << "  --jobs <n>        number of tapes exported at once (default the" << endl
+         << "                    number of cores)" << endl
+         << "  --list            list the signals of each tape and exit" << endl;
+}
+
+template <typename T>
+void writeRaw(std::ostream& out, const T& data)
+{
+    out.write(reinterpret_cast<const char*>(&data), sizeof(data));
+}
+
+const char* typeName(ContinuousTapeSignals::Type type)
+{
+    switch (type) {
+    case ContinuousTapeSignals::Type_DOUBLE: return "double";
+    case ContinuousTapeSignals::Type_FLOAT: return "float";
+    case ContinuousTapeSignals::Type_INT: return "int";
+    case ContinuousTapeSignals::Type_INT16: return "int16";
+    case ContinuousTapeSignals::Type_INT8: return "int8";
+    case ContinuousTapeSignals::Type_BOOL: return "bool";
+    }
+    return "unknown";
+}
+
+bool isSelected(const Options& options, const std::string& property)
+{
+    if (options.signals.empty()) {
+        return true;
+    }
+    for (const auto& s : options.signals) {
+        if (!s.empty() && s.back() == '*') {
+            if (property.compare(0, s.size() - 1, s, 0, s.size() - 1) == 0) {
+                return true;
+            }
+        } else if (property == s) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Receives the selected signals of each exported frame. */
+class Sink
+{
+public:
+    virtual ~Sink() = default;
+
+    virtual bool open(const SGPath& path, const std::vector<std::string>& names) = 0;
+    virtual void frame(double time, const std::vector<double>& values) = 0;
+    virtual bool close() = 0;
+};
+
+/* One row per frame, with the frame time in the first column. */
+class CsvSink : public Sink
+{
+public:
+    bool open(const SGPath& path, const std::vector<std::string>& names) override
+    {
+        _out.open(path.c_str(), std::ofstream::binary | std::ofstream::trunc);
+        _out.precision(12);
+        _out << "time";
+        for (const auto& name : names) {
+            _out << ',' << name;
+        }
+        _out << '\n';
+        return _out.good();
+    }
+
+    void frame(double time, const std::vector<double>& values) override
+    {
+        _out << time;
+        for (double v : values) {
+            _out << ',' << v;
+        }
+        _out << '\n';
+    }
+
+    bool close() override
+    {
+        _out.close();
+        return !_out.fail();
+    }
+
+private:
+    std::ofstream _out;
+};
+
+/* Columnar binary file, loosely modelled on Parquet so that analysis tools
+can load single signals without parsing the whole file. All values are
+stored as native doubles:
+
+    "FGTAPECL" <columns:32> then <length:16><name> for each column, the first
+    column being the frame time.
+
+    Row groups of up to ROW_GROUP_ROWS rows: <rows:32>, then <rows> values of
+    the first column, then of the second column, and so on.
+
+    Footer: <count:32> then the <offset:64> of each row group, then
+    <offset:64>"FGTAPECL" where <offset> is that of the footer. */
+class ColumnsSink : public Sink
+{
+public:
+    bool open(const SGPath& path, const std::vector<std::string>& names) override
+    {
+        _out.open(path.c_str(), std::ofstream::binary | std::ofstream::trunc);
+        _out.write(COLUMNS_MAGIC, sizeof(COLUMNS_MAGIC));
+        writeRaw(_out, static_cast<uint32_t>(names.size() + 1));
+        writeName("time");
+        for (const auto& name : names) {
+            writeName(name);
+        }
+        _columns.resize(names.size() + 1);
+        for (auto& column : _columns) {
+            column.reserve(ROW_GROUP_ROWS);
+        }
+        return _out.good();
+    }
+
+    void frame(double time, const std::vector<double>& values) override
+    {
+        _columns[0].push_back(time);
+        for (size_t i = 0; i < values.size(); ++i) {
+            _columns[i + 1].push_back(values[i]);
+        }
+        if (_columns[0].size() == ROW_GROUP_ROWS) {
+            flush();
+        }
+    }
+
+    bool close() override
+    {
+        flush();
+        const uint64_t footer = _out.tellp();
+        writeRaw(_out, static_cast<uint32_t>(_rowGroups.size()));
+        for (uint64_t offset : _rowGroups) {
+            writeRaw(_out, offset);
+        }
+        writeRaw(_out, footer);
+        _out.write(COLUMNS_MAGIC, sizeof(COLUMNS_MAGIC));
+        _out.close();
+        return !_out.fail();
+    }
+
+private:
+    void writeName(const std::string& name)
+    {
+        writeRaw(_out, static_cast<uint16_t>(name.size()));
+        _out.write(name.data(), name.size());
+    }
+
+    void flush()
+    {
+        const uint32_t rows = _columns[0].size();
+        if (rows == 0) {
+            return;
+        }
+        _rowGroups.push_back(_out.tellp());
+        writeRaw(_out, rows);
+        for (auto& column : _columns) {
+            _out.write(reinterpret_cast<const char*>(column.data()), rows * sizeof(double));
+            column.clear();
+        }
+    }
+
+    std::ofstream _out;
+    std::vector<std::vector<double>> _columns;
+    std::vector<uint64_t> _rowGroups;
+};
+
+/* One CSV row per interval, with the minimum, mean and maximum of each
+signal over the frames in that interval. */
+class SummarySink : public Sink
+{
+public:
+    explicit SummarySink(double interval) : _interval(interval)
+    {
+    }
+
+    bool open(const SGPath& path, const std::vector<std::string>& names) override
+    {
+        _out.open(path.c_str(), std::ofstream::binary | std::ofstream::trunc);
+        _out.precision(12);
+        _out << "time-begin,time-end,frames";
+        for (const auto& name : names) {
+            _out << ',' << name << ".min," << name << ".mean," << name << ".max";
+        }
+        _out << '\n';
+        _min.resize(names.size());
+        _max.resize(names.size());
+        _sum.resize(names.size());
+        return _out.good();
+    }
+
+    void frame(double time, const std::vector<double>& values) override
+    {
+        if (_frames && time >= _begin + _interval) {
+            flush();
+        }
+        if (_frames == 0) {
+            _begin = time;
+            std::fill(_min.begin(), _min.end(), std::numeric_limits<double>::infinity());
+            std::fill(_max.begin(), _max.end(), -std::numeric_limits<double>::infinity());
+            std::fill(_sum.begin(), _sum.end(), 0.0);
+        }
+        for (size_t i = 0; i < values.size(); ++i) {
+            _min[i] = std::min(_min[i], values[i]);
+            _max[i] = std::max(_max[i], values[i]);
+            _sum[i] += values[i];
+        }
+        _end = time;
+        ++_frames;
+    }
+
+    bool close() override
+    {
+        flush();
+        _out.close();
+        return !_out.fail();
+    }
+
+private:
+    void flush()
+    {
+        if (_frames == 0) {
+            return;
+        }
+        _out << _begin << ',' << _end << ',' << _frames;
+        for (size_t i = 0; i < _sum.size(); ++i) {
+            _out << ',' << _min[i] << ',' << _sum[i] / _frames << ',' << _max[i];
+        }
+        _out << '\n';
+        _frames = 0;
+    }
+
+    double _interval;
+    std::ofstream _out;
+    double _begin = 0;
+    double _end = 0;
+    size_t _frames = 0;
+    std::vector<double> _min;
+    std::vector<double> _max;
+    std::vector<double> _sum;
+};
+
+/* Opens <path> and its signal layout, setting <message> if it fails. */
+bool openTape(const SGPath& path, ContinuousTapeReader& reader, ContinuousTapeSignals& layout,
+              int& signalsIndex, std::string& message)
+{
+    int e = reader.open(path);
+    if (e < 0) {
+        message = "not a Continuous recording";
+        return false;
+    }
+    if (e > 0) {
+        message = "failed to read recording header";
+        return false;
+    }
+    if (!layout.init(reader.config()->getNode("signals", true))) {
+        message = "unsupported signal layout";
+        return false;
+    }
+    signalsIndex = reader.dataIndex("signals");
+    if (signalsIndex < 0) {
+        message = "recording has no signals";
+        return false;
+    }
+    return true;
+}
+
+bool exportTape(const SGPath& path, const Options& options, std::string& message)
+{
+    ContinuousTapeReader reader;
+    ContinuousTapeSignals layout;
+    int signalsIndex;
+    if (!openTape(path, reader, layout, signalsIndex, message)) {
+        return false;
+    }
+
+    std::vector<size_t> selected;
+    std::vector<std::string> names;
+    for (size_t i = 0; i < layout.signals().size(); ++i) {
+        if (isSelected(options, layout.signals()[i].property)) {
+            selected.push_back(i);
+            names.push_back(layout.signals()[i].property);
+        }
+    }
+    if (selected.empty()) {
+        message = "none of the requested signals are in the recording";
+        return false;
+    }
+
+    std::unique_ptr<Sink> sink;
+    std::string suffix;
+    double interval = options.interval;
+    switch (options.format) {
+    case Format::CSV:
+        sink.reset(new CsvSink);
+        suffix = ".csv";
+        interval = std::max(interval, 0.0);
+        break;
+    case Format::COLUMNS:
+        sink.reset(new ColumnsSink);
+        suffix = ".fgcol";
+        interval = std::max(interval, 0.0);
+        break;
+    case Format::SUMMARY:
+        if (interval <= 0) {
+            interval = 1;
+        }
+        sink.reset(new SummarySink(interval));
+        suffix = "-summary.csv";
+        // every frame contributes to the summaries
+        break;
+    }
+
+    SGPath out = options.outputDir.isNull() ? path.dirPath() : options.outputDir;
+    out.append(path.file_base() + suffix);
+    if (!sink->open(out, names)) {
+        message = "failed to open " + out.utf8Str();
+        return false;
+    }
+
+    const bool decimate = options.format != Format::SUMMARY && interval > 0;
+    ContinuousTapeFrame frame;
+    std::vector<double> values(selected.size());
+    size_t frames = 0;
+    size_t exported = 0;
+    size_t badFrames = 0;
+    double lastBucket = std::numeric_limits<double>::quiet_NaN();
+    while (reader.next(frame)) {
+        ++frames;
+        const auto& signals = frame.items[signalsIndex];
+        if (signals.second == 0) {
+            // e.g. a frame with only multiplayer information
+            continue;
+        }
+        // FGFlightRecorder::capture() stores record-size bytes, which is
+        // the signals followed by space for the frame time.
+        if (signals.second < layout.size()) {
+            ++badFrames;
+            continue;
+        }
+        if (decimate) {
+            // export the first frame in each interval; the tolerance stops
+            // rounding of frame times from skipping a frame on the boundary
+            const double bucket = std::floor(frame.time / interval + 1e-6);
+            if (bucket == lastBucket) {
+                continue;
+            }
+            lastBucket = bucket;
+        }
+        for (size_t i = 0; i < selected.size(); ++i) {
+            values[i] = layout.value(signals.first, selected[i]);
+        }
+        sink->frame(frame.time, values);
+        ++exported;
+    }
+    if (!sink->close()) {
+        message = "failed to write " + out.utf8Str();
+        return false;
+    }
+
+    std::ostringstream buffer;
+    buffer << frames << " frames, exported " << exported << " with " << selected.size()
+           << " signals to " << out.utf8Str();
+    if (badFrames) {
+        buffer << " (skipped " << badFrames << " frames with unexpected signals size)";
+    }
+    message = buffer.str();
+    return true;
+}
+
+void listTape(const SGPath& path)
+{
+    ContinuousTapeReader reader;
+    ContinuousTapeSignals layout;
+    int signalsIndex;
+    std::string message;
+    if (!openTape(path, reader, layout, signalsIndex, message)) {
+        cout << path.utf8Str() << ": " << message << endl;
+        return;
+    }
+    cout << path.utf8Str() << ":" << endl;
+    for (const auto& signal : layout.signals()) {
+        cout << "    " << signal.property << " " << typeName(signal.type)
+             << " " << signal.interpolation << endl;
+    }
+}
+
+void addTapes(const SGPath& path, std::vector<SGPath>& tapes)
+{
+    if (!path.isDir()) {
+        tapes.push_back(path);
+        return;
+    }
+    for (const auto& child : simgear::Dir(path).children(simgear::Dir::TYPE_FILE)) {
+        if (child.extension() == "fgtape") {
+            tapes.push_back(child);
+        }
+    }
+}
+
+} // of anonymous namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    bool list = false;
+    std::vector<SGPath> tapes;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            usage(argv[0]);
+            return 0;
+        }
+        if (strcmp(arg, "--list") == 0) {
+            list = true;
+            continue;
+        }
+        if (strncmp(arg, "--", 2) != 0) {
+            addTapes(SGPath::fromLocal8Bit(arg), tapes);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "csv") == 0) {
+                options.format = Format::CSV;
+            } else if (strcmp(value, "columns") == 0) {
+                options.format = Format::COLUMNS;
+            } else if (strcmp(value, "summary") == 0) {
+                options.format = Format::SUMMARY;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--signal") == 0) {
+            options.signals.push_back(value);
+        } else if (strcmp(arg, "--interval") == 0) {
+            options.interval = atof(value);
+        } else if (strcmp(arg, "--output") == 0) {
+            options.outputDir = SGPath::fromLocal8Bit(value);
+        } else if (strcmp(arg, "--jobs") == 0) {
+            options.jobs = std::max(1, atoi(value));
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (tapes.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (list) {
+        for (const auto& tape : tapes) {
+            listTape(tape);
+        }
+        return 0;
+    }
+
+    if (!options.outputDir.isNull() && !options.outputDir.exists()) {
+        simgear::Dir(options.outputDir).create(0755);
+    }
+
+    // Each worker takes the next tape until there are none left, so that a
+    // few long tapes don't hold up the rest.
+    std::atomic<size_t> nextTape{0};
+    std::atomic<int> failures{0};
+    auto worker = [&]() {
+        for (;;) {
+            const size_t i = nextTape++;
+            if (i >= tapes.size()) {
+                break;
+            }
+            std::string message;
+            const bool ok = exportTape(tapes[i], options, message);
+            if (!ok) {
+                ++failures;
+            }
+            std::lock_guard<std::mutex> lock(s_outputLock);
+            cout << tapes[i].utf8Str() << ": " << (ok ? "" : "error: ") << message << endl;
+        }
+    };
+
+    const size_t numThreads = std::min<size_t>(options.jobs, tapes.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (failures) {
+        cout << failures << " of " << tapes.size() << " tapes failed" << endl;
+        return 1;
+    }
+    return 0;
+}
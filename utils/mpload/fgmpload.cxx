@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileName: fgmpload.cxx
+ * SPDX-FileComment: local multiplayer relay with synthetic pilots, for load testing
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <simgear/io/raw_socket.hxx>
+#include <simgear/timing/timestamp.hxx>
+
+#include <MultiPlayer/MPLoadGenerator.hxx>
+#include <MultiPlayer/mpmessages.hxx>
+
+using std::cout;
+using std::endl;
+
+namespace {
+
+// clients which haven't sent anything for this long are forgotten
+const double CLIENT_TIMEOUT_SEC = 10.0;
+const double STATS_INTERVAL_SEC = 5.0;
+const int POLL_INTERVAL_MSEC = 2;
+
+struct Client {
+    simgear::IPAddress address;
+    double lastSeen;
+};
+
+void usage(const char* prog)
+{
+    cout << "Usage: " << prog << " [options]" << endl
+         << "Acts as a local multiplayer server: position messages from connected" << endl
+         << "clients are relayed to each other, and a crowd of synthetic pilots is" << endl
+         << "sent to every client." << endl
+         << endl
+         << "  --port <n>       UDP port to listen on (default 5000)" << endl
+         << "  --pilots <n>     number of synthetic pilots (default 100)" << endl
+         << "  --protocol <n>   MP protocol version of the pilots, 1 or 2 (default 2)" << endl
+         << "  --rate <hz>      transmit rate of each pilot (default 10)" << endl
+         << "  --lat <deg>      latitude the pilots circle around (default KSFO)" << endl
+         << "  --lon <deg>      longitude the pilots circle around" << endl
+         << "  --radius <nm>    maximum radius of the circles (default 30)" << endl
+         << "  --seed <n>       seed of the pilot generator (default 1)" << endl;
+}
+
+bool sameAddress(const simgear::IPAddress& a, const simgear::IPAddress& b)
+{
+    return (a.getIP() == b.getIP()) && (a.getPort() == b.getPort());
+}
+
+} // of anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int port = 5000;
+    MPLoadGenerator::Options options;
+    double lat = options.center.getLatitudeDeg();
+    double lon = options.center.getLongitudeDeg();
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            usage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (strcmp(arg, "--port") == 0) {
+            port = atoi(value);
+        } else if (strcmp(arg, "--pilots") == 0) {
+            options.numPilots = atoi(value);
+        } else if (strcmp(arg, "--protocol") == 0) {
+            options.protocolVersion = atoi(value);
+        } else if (strcmp(arg, "--rate") == 0) {
+            options.txRateHz = atof(value);
+        } else if (strcmp(arg, "--lat") == 0) {
+            lat = atof(value);
+        } else if (strcmp(arg, "--lon") == 0) {
+            lon = atof(value);
+        } else if (strcmp(arg, "--radius") == 0) {
+            options.radiusNm = atof(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options.seed = static_cast<unsigned>(atoi(value));
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    options.center = SGGeod::fromDegFt(lon, lat, 0.0);
+
+    simgear::Socket::initSockets();
+
+    simgear::Socket socket;
+    if (!socket.open(false)) {
+        cout << "error opening the UDP socket" << endl;
+        return 1;
+    }
+    socket.setBlocking(false);
+    if (socket.bind("", port) != 0) {
+        perror("bind");
+        return 1;
+    }
+
+    MPLoadGenerator generator(options);
+    cout << "Listening on UDP port " << port << " with " << generator.numPilots()
+         << " synthetic pilots at " << options.txRateHz << " Hz" << endl;
+
+    std::vector<Client> clients;
+    std::vector<simgear::IPAddress> destinations;
+    char buf[MAX_PACKET_SIZE];
+
+    unsigned relayed = 0, generated = 0;
+    const SGTimeStamp start = SGTimeStamp::now();
+    double nextStats = STATS_INTERVAL_SEC;
+
+    for (;;) {
+        simgear::Socket* reads[2] = {&socket, nullptr};
+        simgear::Socket* writes[1] = {nullptr};
+        simgear::Socket::select(reads, writes, POLL_INTERVAL_MSEC);
+
+        const double now = (SGTimeStamp::now() - start).toSecs();
+
+        // relay whatever the real clients sent
+        simgear::IPAddress from;
+        int bytes;
+        while ((bytes = socket.recvfrom(buf, sizeof(buf), 0, &from)) > 0) {
+            bool known = false;
+            for (auto& c : clients) {
+                if (sameAddress(c.address, from)) {
+                    c.lastSeen = now;
+                    known = true;
+                } else {
+                    socket.sendto(buf, bytes, 0, &c.address);
+                    ++relayed;
+                }
+            }
+            if (!known) {
+                cout << "client connected: " << from.getHost() << ":" << from.getPort() << endl;
+                clients.push_back({from, now});
+            }
+        }
+
+        destinations.clear();
+        for (auto it = clients.begin(); it != clients.end();) {
+            if (now - it->lastSeen > CLIENT_TIMEOUT_SEC) {
+                cout << "client timed out: " << it->address.getHost() << ":" << it->address.getPort() << endl;
+                it = clients.erase(it);
+            } else {
+                destinations.push_back(it->address);
+                ++it;
+            }
+        }
+
+        // the pilots keep flying when nobody listens, so their
+        // positions stay continuous when a client reconnects
+        generated += generator.sendDue(now, socket, destinations);
+
+        if (now >= nextStats) {
+            cout << clients.size() << " clients, "
+                 << generated / STATS_INTERVAL_SEC << " generated and "
+                 << relayed / STATS_INTERVAL_SEC << " relayed messages/s" << endl;
+            generated = relayed = 0;
+            nextStats += STATS_INTERVAL_SEC;
+        }
+    }
+
+    return 0;
+}